@@ -0,0 +1,130 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cmake/primesieveConfig.cmake.in"
+  "/root/repo/perf/CMakeLists.txt"
+  "/root/repo/primesieve.pc.in"
+  "/root/repo/test/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-SameMajorVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePushCheckState.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "primesieveConfigVersion.cmake"
+  "primesieveConfig.cmake"
+  "primesieve.pc"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "perf/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/libprimesieve.dir/DependInfo.cmake"
+  "CMakeFiles/libprimesieve-static.dir/DependInfo.cmake"
+  "CMakeFiles/primesieve.dir/DependInfo.cmake"
+  "test/CMakeFiles/atomic.dir/DependInfo.cmake"
+  "test/CMakeFiles/calculator.dir/DependInfo.cmake"
+  "test/CMakeFiles/cancel_sieve.dir/DependInfo.cmake"
+  "test/CMakeFiles/chunked_sieve.dir/DependInfo.cmake"
+  "test/CMakeFiles/compact_iterator.dir/DependInfo.cmake"
+  "test/CMakeFiles/count_primes1.dir/DependInfo.cmake"
+  "test/CMakeFiles/count_primes2.dir/DependInfo.cmake"
+  "test/CMakeFiles/count_primes3.dir/DependInfo.cmake"
+  "test/CMakeFiles/count_primes_async.dir/DependInfo.cmake"
+  "test/CMakeFiles/count_primes_batch.dir/DependInfo.cmake"
+  "test/CMakeFiles/count_quadruplets.dir/DependInfo.cmake"
+  "test/CMakeFiles/count_quintuplets.dir/DependInfo.cmake"
+  "test/CMakeFiles/count_sextuplets.dir/DependInfo.cmake"
+  "test/CMakeFiles/count_triplets.dir/DependInfo.cmake"
+  "test/CMakeFiles/count_twins.dir/DependInfo.cmake"
+  "test/CMakeFiles/cpu_info.dir/DependInfo.cmake"
+  "test/CMakeFiles/fastdiv.dir/DependInfo.cmake"
+  "test/CMakeFiles/floorPow2.dir/DependInfo.cmake"
+  "test/CMakeFiles/gap_stream_reader.dir/DependInfo.cmake"
+  "test/CMakeFiles/generate_ktuplets.dir/DependInfo.cmake"
+  "test/CMakeFiles/generate_n_primes1.dir/DependInfo.cmake"
+  "test/CMakeFiles/generate_n_primes2.dir/DependInfo.cmake"
+  "test/CMakeFiles/generate_primes1.dir/DependInfo.cmake"
+  "test/CMakeFiles/generate_primes2.dir/DependInfo.cmake"
+  "test/CMakeFiles/generate_primes_uint32.dir/DependInfo.cmake"
+  "test/CMakeFiles/generate_twin_primes.dir/DependInfo.cmake"
+  "test/CMakeFiles/generator.dir/DependInfo.cmake"
+  "test/CMakeFiles/histogram.dir/DependInfo.cmake"
+  "test/CMakeFiles/ilog2.dir/DependInfo.cmake"
+  "test/CMakeFiles/isqrt.dir/DependInfo.cmake"
+  "test/CMakeFiles/isqrt_constexpr.dir/DependInfo.cmake"
+  "test/CMakeFiles/iterator_cache_size.dir/DependInfo.cmake"
+  "test/CMakeFiles/iterator_flip.dir/DependInfo.cmake"
+  "test/CMakeFiles/milestone_cache.dir/DependInfo.cmake"
+  "test/CMakeFiles/next_prime1.dir/DependInfo.cmake"
+  "test/CMakeFiles/next_prime2.dir/DependInfo.cmake"
+  "test/CMakeFiles/next_primes1.dir/DependInfo.cmake"
+  "test/CMakeFiles/next_primes2.dir/DependInfo.cmake"
+  "test/CMakeFiles/nth_prime1.dir/DependInfo.cmake"
+  "test/CMakeFiles/nth_prime2.dir/DependInfo.cmake"
+  "test/CMakeFiles/nth_prime3.dir/DependInfo.cmake"
+  "test/CMakeFiles/number_of_bits.dir/DependInfo.cmake"
+  "test/CMakeFiles/prev_prime1.dir/DependInfo.cmake"
+  "test/CMakeFiles/prev_prime2.dir/DependInfo.cmake"
+  "test/CMakeFiles/prime_gaps.dir/DependInfo.cmake"
+  "test/CMakeFiles/prime_range.dir/DependInfo.cmake"
+  "test/CMakeFiles/resize_sieve.dir/DependInfo.cmake"
+  "test/CMakeFiles/running_count.dir/DependInfo.cmake"
+  "test/CMakeFiles/segment_export.dir/DependInfo.cmake"
+  "test/CMakeFiles/sieve_bitmap.dir/DependInfo.cmake"
+  "test/CMakeFiles/sieving_primes_cache.dir/DependInfo.cmake"
+  "test/CMakeFiles/skipto_reposition.dir/DependInfo.cmake"
+  "test/CMakeFiles/split_range.dir/DependInfo.cmake"
+  "test/CMakeFiles/store_primes_parallel.dir/DependInfo.cmake"
+  "perf/CMakeFiles/perf_count.dir/DependInfo.cmake"
+  "perf/CMakeFiles/perf_fill.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,48 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/BucketArena.cpp" "CMakeFiles/libprimesieve-static.dir/src/BucketArena.cpp.o" "gcc" "CMakeFiles/libprimesieve-static.dir/src/BucketArena.cpp.o.d"
+  "/root/repo/src/ChunkedSieve.cpp" "CMakeFiles/libprimesieve-static.dir/src/ChunkedSieve.cpp.o" "gcc" "CMakeFiles/libprimesieve-static.dir/src/ChunkedSieve.cpp.o.d"
+  "/root/repo/src/CountBatch.cpp" "CMakeFiles/libprimesieve-static.dir/src/CountBatch.cpp.o" "gcc" "CMakeFiles/libprimesieve-static.dir/src/CountBatch.cpp.o.d"
+  "/root/repo/src/CpuInfo.cpp" "CMakeFiles/libprimesieve-static.dir/src/CpuInfo.cpp.o" "gcc" "CMakeFiles/libprimesieve-static.dir/src/CpuInfo.cpp.o.d"
+  "/root/repo/src/Erat.cpp" "CMakeFiles/libprimesieve-static.dir/src/Erat.cpp.o" "gcc" "CMakeFiles/libprimesieve-static.dir/src/Erat.cpp.o.d"
+  "/root/repo/src/EratBig.cpp" "CMakeFiles/libprimesieve-static.dir/src/EratBig.cpp.o" "gcc" "CMakeFiles/libprimesieve-static.dir/src/EratBig.cpp.o.d"
+  "/root/repo/src/EratMedium.cpp" "CMakeFiles/libprimesieve-static.dir/src/EratMedium.cpp.o" "gcc" "CMakeFiles/libprimesieve-static.dir/src/EratMedium.cpp.o.d"
+  "/root/repo/src/EratSmall.cpp" "CMakeFiles/libprimesieve-static.dir/src/EratSmall.cpp.o" "gcc" "CMakeFiles/libprimesieve-static.dir/src/EratSmall.cpp.o.d"
+  "/root/repo/src/GapFinder.cpp" "CMakeFiles/libprimesieve-static.dir/src/GapFinder.cpp.o" "gcc" "CMakeFiles/libprimesieve-static.dir/src/GapFinder.cpp.o.d"
+  "/root/repo/src/IteratorHelper.cpp" "CMakeFiles/libprimesieve-static.dir/src/IteratorHelper.cpp.o" "gcc" "CMakeFiles/libprimesieve-static.dir/src/IteratorHelper.cpp.o.d"
+  "/root/repo/src/MilestoneCache.cpp" "CMakeFiles/libprimesieve-static.dir/src/MilestoneCache.cpp.o" "gcc" "CMakeFiles/libprimesieve-static.dir/src/MilestoneCache.cpp.o.d"
+  "/root/repo/src/ParallelSieve.cpp" "CMakeFiles/libprimesieve-static.dir/src/ParallelSieve.cpp.o" "gcc" "CMakeFiles/libprimesieve-static.dir/src/ParallelSieve.cpp.o.d"
+  "/root/repo/src/PiTable.cpp" "CMakeFiles/libprimesieve-static.dir/src/PiTable.cpp.o" "gcc" "CMakeFiles/libprimesieve-static.dir/src/PiTable.cpp.o.d"
+  "/root/repo/src/PreSieve.cpp" "CMakeFiles/libprimesieve-static.dir/src/PreSieve.cpp.o" "gcc" "CMakeFiles/libprimesieve-static.dir/src/PreSieve.cpp.o.d"
+  "/root/repo/src/PrimeGenerator.cpp" "CMakeFiles/libprimesieve-static.dir/src/PrimeGenerator.cpp.o" "gcc" "CMakeFiles/libprimesieve-static.dir/src/PrimeGenerator.cpp.o.d"
+  "/root/repo/src/PrimeSieve.cpp" "CMakeFiles/libprimesieve-static.dir/src/PrimeSieve.cpp.o" "gcc" "CMakeFiles/libprimesieve-static.dir/src/PrimeSieve.cpp.o.d"
+  "/root/repo/src/PrintPrimes.cpp" "CMakeFiles/libprimesieve-static.dir/src/PrintPrimes.cpp.o" "gcc" "CMakeFiles/libprimesieve-static.dir/src/PrintPrimes.cpp.o.d"
+  "/root/repo/src/SieveBitmap.cpp" "CMakeFiles/libprimesieve-static.dir/src/SieveBitmap.cpp.o" "gcc" "CMakeFiles/libprimesieve-static.dir/src/SieveBitmap.cpp.o.d"
+  "/root/repo/src/SievingPrimes.cpp" "CMakeFiles/libprimesieve-static.dir/src/SievingPrimes.cpp.o" "gcc" "CMakeFiles/libprimesieve-static.dir/src/SievingPrimes.cpp.o.d"
+  "/root/repo/src/SievingPrimesCache.cpp" "CMakeFiles/libprimesieve-static.dir/src/SievingPrimesCache.cpp.o" "gcc" "CMakeFiles/libprimesieve-static.dir/src/SievingPrimesCache.cpp.o.d"
+  "/root/repo/src/Stats.cpp" "CMakeFiles/libprimesieve-static.dir/src/Stats.cpp.o" "gcc" "CMakeFiles/libprimesieve-static.dir/src/Stats.cpp.o.d"
+  "/root/repo/src/ThreadPool.cpp" "CMakeFiles/libprimesieve-static.dir/src/ThreadPool.cpp.o" "gcc" "CMakeFiles/libprimesieve-static.dir/src/ThreadPool.cpp.o.d"
+  "/root/repo/src/Wheel.cpp" "CMakeFiles/libprimesieve-static.dir/src/Wheel.cpp.o" "gcc" "CMakeFiles/libprimesieve-static.dir/src/Wheel.cpp.o.d"
+  "/root/repo/src/api-c.cpp" "CMakeFiles/libprimesieve-static.dir/src/api-c.cpp.o" "gcc" "CMakeFiles/libprimesieve-static.dir/src/api-c.cpp.o.d"
+  "/root/repo/src/api.cpp" "CMakeFiles/libprimesieve-static.dir/src/api.cpp.o" "gcc" "CMakeFiles/libprimesieve-static.dir/src/api.cpp.o.d"
+  "/root/repo/src/iterator-c.cpp" "CMakeFiles/libprimesieve-static.dir/src/iterator-c.cpp.o" "gcc" "CMakeFiles/libprimesieve-static.dir/src/iterator-c.cpp.o.d"
+  "/root/repo/src/iterator.cpp" "CMakeFiles/libprimesieve-static.dir/src/iterator.cpp.o" "gcc" "CMakeFiles/libprimesieve-static.dir/src/iterator.cpp.o.d"
+  "/root/repo/src/nthPrime.cpp" "CMakeFiles/libprimesieve-static.dir/src/nthPrime.cpp.o" "gcc" "CMakeFiles/libprimesieve-static.dir/src/nthPrime.cpp.o.d"
+  "/root/repo/src/popcount.cpp" "CMakeFiles/libprimesieve-static.dir/src/popcount.cpp.o" "gcc" "CMakeFiles/libprimesieve-static.dir/src/popcount.cpp.o.d"
+  "/root/repo/src/tune.cpp" "CMakeFiles/libprimesieve-static.dir/src/tune.cpp.o" "gcc" "CMakeFiles/libprimesieve-static.dir/src/tune.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
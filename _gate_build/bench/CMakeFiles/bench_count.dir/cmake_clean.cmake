@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_count.dir/bench_count.cpp.o"
+  "CMakeFiles/bench_count.dir/bench_count.cpp.o.d"
+  "bench_count"
+  "bench_count.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_count.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_erat.dir/bench_erat.cpp.o"
+  "CMakeFiles/bench_erat.dir/bench_erat.cpp.o.d"
+  "bench_erat"
+  "bench_erat.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_erat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
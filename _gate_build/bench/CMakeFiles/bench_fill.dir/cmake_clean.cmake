@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_fill.dir/bench_fill.cpp.o"
+  "CMakeFiles/bench_fill.dir/bench_fill.cpp.o.d"
+  "bench_fill"
+  "bench_fill.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_fill.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
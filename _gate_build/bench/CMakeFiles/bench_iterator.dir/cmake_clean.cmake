@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_iterator.dir/bench_iterator.cpp.o"
+  "CMakeFiles/bench_iterator.dir/bench_iterator.cpp.o.d"
+  "bench_iterator"
+  "bench_iterator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_iterator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
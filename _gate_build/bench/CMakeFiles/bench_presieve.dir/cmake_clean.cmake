@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_presieve.dir/bench_presieve.cpp.o"
+  "CMakeFiles/bench_presieve.dir/bench_presieve.cpp.o.d"
+  "bench_presieve"
+  "bench_presieve.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_presieve.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
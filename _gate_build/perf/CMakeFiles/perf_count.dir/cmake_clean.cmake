@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/perf_count.dir/perf_count.cpp.o"
+  "CMakeFiles/perf_count.dir/perf_count.cpp.o.d"
+  "perf_count"
+  "perf_count.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/perf_count.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/perf_fill.dir/perf_fill.cpp.o"
+  "CMakeFiles/perf_fill.dir/perf_fill.cpp.o.d"
+  "perf_fill"
+  "perf_fill.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/perf_fill.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
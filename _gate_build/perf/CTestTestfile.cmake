@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/perf
+# Build directory: /root/repo/_gate_build/perf
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(perf_count "/root/repo/_gate_build/perf/perf_count" "/root/repo/perf/baseline.json")
+set_tests_properties(perf_count PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/perf/CMakeLists.txt;10;add_test;/root/repo/perf/CMakeLists.txt;0;")
+add_test(perf_fill "/root/repo/_gate_build/perf/perf_fill" "/root/repo/perf/baseline.json")
+set_tests_properties(perf_fill PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/perf/CMakeLists.txt;10;add_test;/root/repo/perf/CMakeLists.txt;0;")
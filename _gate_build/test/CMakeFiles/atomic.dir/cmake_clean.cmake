@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/atomic.dir/atomic.cpp.o"
+  "CMakeFiles/atomic.dir/atomic.cpp.o.d"
+  "atomic"
+  "atomic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/atomic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cancel_sieve.dir/cancel_sieve.cpp.o"
+  "CMakeFiles/cancel_sieve.dir/cancel_sieve.cpp.o.d"
+  "cancel_sieve"
+  "cancel_sieve.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cancel_sieve.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
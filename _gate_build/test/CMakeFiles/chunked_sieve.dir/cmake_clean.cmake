@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/chunked_sieve.dir/chunked_sieve.cpp.o"
+  "CMakeFiles/chunked_sieve.dir/chunked_sieve.cpp.o.d"
+  "chunked_sieve"
+  "chunked_sieve.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/chunked_sieve.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compact_iterator.dir/compact_iterator.cpp.o"
+  "CMakeFiles/compact_iterator.dir/compact_iterator.cpp.o.d"
+  "compact_iterator"
+  "compact_iterator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compact_iterator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/count_primes1.dir/count_primes1.cpp.o"
+  "CMakeFiles/count_primes1.dir/count_primes1.cpp.o.d"
+  "count_primes1"
+  "count_primes1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/count_primes1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/count_primes3.dir/count_primes3.cpp.o"
+  "CMakeFiles/count_primes3.dir/count_primes3.cpp.o.d"
+  "count_primes3"
+  "count_primes3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/count_primes3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/count_quintuplets.dir/count_quintuplets.cpp.o"
+  "CMakeFiles/count_quintuplets.dir/count_quintuplets.cpp.o.d"
+  "count_quintuplets"
+  "count_quintuplets.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/count_quintuplets.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/count_sextuplets.dir/count_sextuplets.cpp.o"
+  "CMakeFiles/count_sextuplets.dir/count_sextuplets.cpp.o.d"
+  "count_sextuplets"
+  "count_sextuplets.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/count_sextuplets.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cpu_info.dir/cpu_info.cpp.o"
+  "CMakeFiles/cpu_info.dir/cpu_info.cpp.o.d"
+  "cpu_info"
+  "cpu_info.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cpu_info.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fastdiv.dir/fastdiv.cpp.o"
+  "CMakeFiles/fastdiv.dir/fastdiv.cpp.o.d"
+  "fastdiv"
+  "fastdiv.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fastdiv.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/generate_ktuplets.dir/generate_ktuplets.cpp.o"
+  "CMakeFiles/generate_ktuplets.dir/generate_ktuplets.cpp.o.d"
+  "generate_ktuplets"
+  "generate_ktuplets.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/generate_ktuplets.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/generate_primes2.dir/generate_primes2.c.o"
+  "CMakeFiles/generate_primes2.dir/generate_primes2.c.o.d"
+  "generate_primes2"
+  "generate_primes2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/generate_primes2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
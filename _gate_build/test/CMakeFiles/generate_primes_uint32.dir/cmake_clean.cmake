@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/generate_primes_uint32.dir/generate_primes_uint32.cpp.o"
+  "CMakeFiles/generate_primes_uint32.dir/generate_primes_uint32.cpp.o.d"
+  "generate_primes_uint32"
+  "generate_primes_uint32.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/generate_primes_uint32.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
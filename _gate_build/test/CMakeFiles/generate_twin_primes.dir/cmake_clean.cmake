@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/generate_twin_primes.dir/generate_twin_primes.cpp.o"
+  "CMakeFiles/generate_twin_primes.dir/generate_twin_primes.cpp.o.d"
+  "generate_twin_primes"
+  "generate_twin_primes.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/generate_twin_primes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ilog2.dir/ilog2.cpp.o"
+  "CMakeFiles/ilog2.dir/ilog2.cpp.o.d"
+  "ilog2"
+  "ilog2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ilog2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/isqrt_constexpr.dir/isqrt_constexpr.cpp.o"
+  "CMakeFiles/isqrt_constexpr.dir/isqrt_constexpr.cpp.o.d"
+  "isqrt_constexpr"
+  "isqrt_constexpr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/isqrt_constexpr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/iterator_cache_size.dir/iterator_cache_size.cpp.o"
+  "CMakeFiles/iterator_cache_size.dir/iterator_cache_size.cpp.o.d"
+  "iterator_cache_size"
+  "iterator_cache_size.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/iterator_cache_size.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
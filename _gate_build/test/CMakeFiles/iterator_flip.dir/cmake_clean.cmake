@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/iterator_flip.dir/iterator_flip.cpp.o"
+  "CMakeFiles/iterator_flip.dir/iterator_flip.cpp.o.d"
+  "iterator_flip"
+  "iterator_flip.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/iterator_flip.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
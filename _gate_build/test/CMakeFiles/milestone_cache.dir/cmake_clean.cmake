@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/milestone_cache.dir/milestone_cache.cpp.o"
+  "CMakeFiles/milestone_cache.dir/milestone_cache.cpp.o.d"
+  "milestone_cache"
+  "milestone_cache.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/milestone_cache.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/next_primes2.dir/next_primes2.c.o"
+  "CMakeFiles/next_primes2.dir/next_primes2.c.o.d"
+  "next_primes2"
+  "next_primes2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/next_primes2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nth_prime2.dir/nth_prime2.cpp.o"
+  "CMakeFiles/nth_prime2.dir/nth_prime2.cpp.o.d"
+  "nth_prime2"
+  "nth_prime2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nth_prime2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nth_prime3.dir/nth_prime3.cpp.o"
+  "CMakeFiles/nth_prime3.dir/nth_prime3.cpp.o.d"
+  "nth_prime3"
+  "nth_prime3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nth_prime3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
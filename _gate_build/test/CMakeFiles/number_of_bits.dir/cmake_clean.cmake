@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/number_of_bits.dir/number_of_bits.cpp.o"
+  "CMakeFiles/number_of_bits.dir/number_of_bits.cpp.o.d"
+  "number_of_bits"
+  "number_of_bits.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/number_of_bits.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
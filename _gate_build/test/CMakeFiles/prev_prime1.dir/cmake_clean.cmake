@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/prev_prime1.dir/prev_prime1.cpp.o"
+  "CMakeFiles/prev_prime1.dir/prev_prime1.cpp.o.d"
+  "prev_prime1"
+  "prev_prime1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/prev_prime1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/prime_gaps.dir/prime_gaps.cpp.o"
+  "CMakeFiles/prime_gaps.dir/prime_gaps.cpp.o.d"
+  "prime_gaps"
+  "prime_gaps.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/prime_gaps.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
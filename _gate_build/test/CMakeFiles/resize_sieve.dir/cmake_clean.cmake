@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/resize_sieve.dir/resize_sieve.cpp.o"
+  "CMakeFiles/resize_sieve.dir/resize_sieve.cpp.o.d"
+  "resize_sieve"
+  "resize_sieve.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/resize_sieve.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/segment_export.dir/segment_export.cpp.o"
+  "CMakeFiles/segment_export.dir/segment_export.cpp.o.d"
+  "segment_export"
+  "segment_export.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/segment_export.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/skipto_reposition.dir/skipto_reposition.cpp.o"
+  "CMakeFiles/skipto_reposition.dir/skipto_reposition.cpp.o.d"
+  "skipto_reposition"
+  "skipto_reposition.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/skipto_reposition.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/split_range.dir/split_range.cpp.o"
+  "CMakeFiles/split_range.dir/split_range.cpp.o.d"
+  "split_range"
+  "split_range.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/split_range.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
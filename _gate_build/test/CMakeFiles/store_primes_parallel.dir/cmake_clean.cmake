@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/store_primes_parallel.dir/store_primes_parallel.cpp.o"
+  "CMakeFiles/store_primes_parallel.dir/store_primes_parallel.cpp.o.d"
+  "store_primes_parallel"
+  "store_primes_parallel.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/store_primes_parallel.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
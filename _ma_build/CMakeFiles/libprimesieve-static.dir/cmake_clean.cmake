@@ -0,0 +1,67 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libprimesieve-static.dir/src/BucketArena.cpp.o"
+  "CMakeFiles/libprimesieve-static.dir/src/BucketArena.cpp.o.d"
+  "CMakeFiles/libprimesieve-static.dir/src/ChunkedSieve.cpp.o"
+  "CMakeFiles/libprimesieve-static.dir/src/ChunkedSieve.cpp.o.d"
+  "CMakeFiles/libprimesieve-static.dir/src/CountBatch.cpp.o"
+  "CMakeFiles/libprimesieve-static.dir/src/CountBatch.cpp.o.d"
+  "CMakeFiles/libprimesieve-static.dir/src/CpuInfo.cpp.o"
+  "CMakeFiles/libprimesieve-static.dir/src/CpuInfo.cpp.o.d"
+  "CMakeFiles/libprimesieve-static.dir/src/Erat.cpp.o"
+  "CMakeFiles/libprimesieve-static.dir/src/Erat.cpp.o.d"
+  "CMakeFiles/libprimesieve-static.dir/src/EratBig.cpp.o"
+  "CMakeFiles/libprimesieve-static.dir/src/EratBig.cpp.o.d"
+  "CMakeFiles/libprimesieve-static.dir/src/EratMedium.cpp.o"
+  "CMakeFiles/libprimesieve-static.dir/src/EratMedium.cpp.o.d"
+  "CMakeFiles/libprimesieve-static.dir/src/EratSmall.cpp.o"
+  "CMakeFiles/libprimesieve-static.dir/src/EratSmall.cpp.o.d"
+  "CMakeFiles/libprimesieve-static.dir/src/GapFinder.cpp.o"
+  "CMakeFiles/libprimesieve-static.dir/src/GapFinder.cpp.o.d"
+  "CMakeFiles/libprimesieve-static.dir/src/IteratorHelper.cpp.o"
+  "CMakeFiles/libprimesieve-static.dir/src/IteratorHelper.cpp.o.d"
+  "CMakeFiles/libprimesieve-static.dir/src/ParallelSieve.cpp.o"
+  "CMakeFiles/libprimesieve-static.dir/src/ParallelSieve.cpp.o.d"
+  "CMakeFiles/libprimesieve-static.dir/src/PiTable.cpp.o"
+  "CMakeFiles/libprimesieve-static.dir/src/PiTable.cpp.o.d"
+  "CMakeFiles/libprimesieve-static.dir/src/PreSieve.cpp.o"
+  "CMakeFiles/libprimesieve-static.dir/src/PreSieve.cpp.o.d"
+  "CMakeFiles/libprimesieve-static.dir/src/PrimeGenerator.cpp.o"
+  "CMakeFiles/libprimesieve-static.dir/src/PrimeGenerator.cpp.o.d"
+  "CMakeFiles/libprimesieve-static.dir/src/PrimeSieve.cpp.o"
+  "CMakeFiles/libprimesieve-static.dir/src/PrimeSieve.cpp.o.d"
+  "CMakeFiles/libprimesieve-static.dir/src/PrintPrimes.cpp.o"
+  "CMakeFiles/libprimesieve-static.dir/src/PrintPrimes.cpp.o.d"
+  "CMakeFiles/libprimesieve-static.dir/src/SieveBitmap.cpp.o"
+  "CMakeFiles/libprimesieve-static.dir/src/SieveBitmap.cpp.o.d"
+  "CMakeFiles/libprimesieve-static.dir/src/SievingPrimes.cpp.o"
+  "CMakeFiles/libprimesieve-static.dir/src/SievingPrimes.cpp.o.d"
+  "CMakeFiles/libprimesieve-static.dir/src/SievingPrimesCache.cpp.o"
+  "CMakeFiles/libprimesieve-static.dir/src/SievingPrimesCache.cpp.o.d"
+  "CMakeFiles/libprimesieve-static.dir/src/Stats.cpp.o"
+  "CMakeFiles/libprimesieve-static.dir/src/Stats.cpp.o.d"
+  "CMakeFiles/libprimesieve-static.dir/src/ThreadPool.cpp.o"
+  "CMakeFiles/libprimesieve-static.dir/src/ThreadPool.cpp.o.d"
+  "CMakeFiles/libprimesieve-static.dir/src/Wheel.cpp.o"
+  "CMakeFiles/libprimesieve-static.dir/src/Wheel.cpp.o.d"
+  "CMakeFiles/libprimesieve-static.dir/src/api-c.cpp.o"
+  "CMakeFiles/libprimesieve-static.dir/src/api-c.cpp.o.d"
+  "CMakeFiles/libprimesieve-static.dir/src/api.cpp.o"
+  "CMakeFiles/libprimesieve-static.dir/src/api.cpp.o.d"
+  "CMakeFiles/libprimesieve-static.dir/src/iterator-c.cpp.o"
+  "CMakeFiles/libprimesieve-static.dir/src/iterator-c.cpp.o.d"
+  "CMakeFiles/libprimesieve-static.dir/src/iterator.cpp.o"
+  "CMakeFiles/libprimesieve-static.dir/src/iterator.cpp.o.d"
+  "CMakeFiles/libprimesieve-static.dir/src/nthPrime.cpp.o"
+  "CMakeFiles/libprimesieve-static.dir/src/nthPrime.cpp.o.d"
+  "CMakeFiles/libprimesieve-static.dir/src/popcount.cpp.o"
+  "CMakeFiles/libprimesieve-static.dir/src/popcount.cpp.o.d"
+  "CMakeFiles/libprimesieve-static.dir/src/tune.cpp.o"
+  "CMakeFiles/libprimesieve-static.dir/src/tune.cpp.o.d"
+  "libprimesieve.a"
+  "libprimesieve.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libprimesieve-static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,54 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/BucketArena.cpp" "CMakeFiles/libprimesieve.dir/src/BucketArena.cpp.o" "gcc" "CMakeFiles/libprimesieve.dir/src/BucketArena.cpp.o.d"
+  "/root/repo/src/ChunkedSieve.cpp" "CMakeFiles/libprimesieve.dir/src/ChunkedSieve.cpp.o" "gcc" "CMakeFiles/libprimesieve.dir/src/ChunkedSieve.cpp.o.d"
+  "/root/repo/src/CountBatch.cpp" "CMakeFiles/libprimesieve.dir/src/CountBatch.cpp.o" "gcc" "CMakeFiles/libprimesieve.dir/src/CountBatch.cpp.o.d"
+  "/root/repo/src/CpuInfo.cpp" "CMakeFiles/libprimesieve.dir/src/CpuInfo.cpp.o" "gcc" "CMakeFiles/libprimesieve.dir/src/CpuInfo.cpp.o.d"
+  "/root/repo/src/Erat.cpp" "CMakeFiles/libprimesieve.dir/src/Erat.cpp.o" "gcc" "CMakeFiles/libprimesieve.dir/src/Erat.cpp.o.d"
+  "/root/repo/src/EratBig.cpp" "CMakeFiles/libprimesieve.dir/src/EratBig.cpp.o" "gcc" "CMakeFiles/libprimesieve.dir/src/EratBig.cpp.o.d"
+  "/root/repo/src/EratMedium.cpp" "CMakeFiles/libprimesieve.dir/src/EratMedium.cpp.o" "gcc" "CMakeFiles/libprimesieve.dir/src/EratMedium.cpp.o.d"
+  "/root/repo/src/EratSmall.cpp" "CMakeFiles/libprimesieve.dir/src/EratSmall.cpp.o" "gcc" "CMakeFiles/libprimesieve.dir/src/EratSmall.cpp.o.d"
+  "/root/repo/src/GapFinder.cpp" "CMakeFiles/libprimesieve.dir/src/GapFinder.cpp.o" "gcc" "CMakeFiles/libprimesieve.dir/src/GapFinder.cpp.o.d"
+  "/root/repo/src/IteratorHelper.cpp" "CMakeFiles/libprimesieve.dir/src/IteratorHelper.cpp.o" "gcc" "CMakeFiles/libprimesieve.dir/src/IteratorHelper.cpp.o.d"
+  "/root/repo/src/ParallelSieve.cpp" "CMakeFiles/libprimesieve.dir/src/ParallelSieve.cpp.o" "gcc" "CMakeFiles/libprimesieve.dir/src/ParallelSieve.cpp.o.d"
+  "/root/repo/src/PiTable.cpp" "CMakeFiles/libprimesieve.dir/src/PiTable.cpp.o" "gcc" "CMakeFiles/libprimesieve.dir/src/PiTable.cpp.o.d"
+  "/root/repo/src/PreSieve.cpp" "CMakeFiles/libprimesieve.dir/src/PreSieve.cpp.o" "gcc" "CMakeFiles/libprimesieve.dir/src/PreSieve.cpp.o.d"
+  "/root/repo/src/PrimeGenerator.cpp" "CMakeFiles/libprimesieve.dir/src/PrimeGenerator.cpp.o" "gcc" "CMakeFiles/libprimesieve.dir/src/PrimeGenerator.cpp.o.d"
+  "/root/repo/src/PrimeSieve.cpp" "CMakeFiles/libprimesieve.dir/src/PrimeSieve.cpp.o" "gcc" "CMakeFiles/libprimesieve.dir/src/PrimeSieve.cpp.o.d"
+  "/root/repo/src/PrintPrimes.cpp" "CMakeFiles/libprimesieve.dir/src/PrintPrimes.cpp.o" "gcc" "CMakeFiles/libprimesieve.dir/src/PrintPrimes.cpp.o.d"
+  "/root/repo/src/SieveBitmap.cpp" "CMakeFiles/libprimesieve.dir/src/SieveBitmap.cpp.o" "gcc" "CMakeFiles/libprimesieve.dir/src/SieveBitmap.cpp.o.d"
+  "/root/repo/src/SievingPrimes.cpp" "CMakeFiles/libprimesieve.dir/src/SievingPrimes.cpp.o" "gcc" "CMakeFiles/libprimesieve.dir/src/SievingPrimes.cpp.o.d"
+  "/root/repo/src/SievingPrimesCache.cpp" "CMakeFiles/libprimesieve.dir/src/SievingPrimesCache.cpp.o" "gcc" "CMakeFiles/libprimesieve.dir/src/SievingPrimesCache.cpp.o.d"
+  "/root/repo/src/Stats.cpp" "CMakeFiles/libprimesieve.dir/src/Stats.cpp.o" "gcc" "CMakeFiles/libprimesieve.dir/src/Stats.cpp.o.d"
+  "/root/repo/src/ThreadPool.cpp" "CMakeFiles/libprimesieve.dir/src/ThreadPool.cpp.o" "gcc" "CMakeFiles/libprimesieve.dir/src/ThreadPool.cpp.o.d"
+  "/root/repo/src/Wheel.cpp" "CMakeFiles/libprimesieve.dir/src/Wheel.cpp.o" "gcc" "CMakeFiles/libprimesieve.dir/src/Wheel.cpp.o.d"
+  "/root/repo/src/api-c.cpp" "CMakeFiles/libprimesieve.dir/src/api-c.cpp.o" "gcc" "CMakeFiles/libprimesieve.dir/src/api-c.cpp.o.d"
+  "/root/repo/src/api.cpp" "CMakeFiles/libprimesieve.dir/src/api.cpp.o" "gcc" "CMakeFiles/libprimesieve.dir/src/api.cpp.o.d"
+  "/root/repo/src/iterator-c.cpp" "CMakeFiles/libprimesieve.dir/src/iterator-c.cpp.o" "gcc" "CMakeFiles/libprimesieve.dir/src/iterator-c.cpp.o.d"
+  "/root/repo/src/iterator.cpp" "CMakeFiles/libprimesieve.dir/src/iterator.cpp.o" "gcc" "CMakeFiles/libprimesieve.dir/src/iterator.cpp.o.d"
+  "/root/repo/src/nthPrime.cpp" "CMakeFiles/libprimesieve.dir/src/nthPrime.cpp.o" "gcc" "CMakeFiles/libprimesieve.dir/src/nthPrime.cpp.o.d"
+  "/root/repo/src/popcount.cpp" "CMakeFiles/libprimesieve.dir/src/popcount.cpp.o" "gcc" "CMakeFiles/libprimesieve.dir/src/popcount.cpp.o.d"
+  "/root/repo/src/tune.cpp" "CMakeFiles/libprimesieve.dir/src/tune.cpp.o" "gcc" "CMakeFiles/libprimesieve.dir/src/tune.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_ma_build/libprimesieve.so" "/root/repo/_ma_build/libprimesieve.so.9.0.0"
+  "/root/repo/_ma_build/libprimesieve.so.9" "/root/repo/_ma_build/libprimesieve.so.9.0.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,69 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libprimesieve.dir/src/BucketArena.cpp.o"
+  "CMakeFiles/libprimesieve.dir/src/BucketArena.cpp.o.d"
+  "CMakeFiles/libprimesieve.dir/src/ChunkedSieve.cpp.o"
+  "CMakeFiles/libprimesieve.dir/src/ChunkedSieve.cpp.o.d"
+  "CMakeFiles/libprimesieve.dir/src/CountBatch.cpp.o"
+  "CMakeFiles/libprimesieve.dir/src/CountBatch.cpp.o.d"
+  "CMakeFiles/libprimesieve.dir/src/CpuInfo.cpp.o"
+  "CMakeFiles/libprimesieve.dir/src/CpuInfo.cpp.o.d"
+  "CMakeFiles/libprimesieve.dir/src/Erat.cpp.o"
+  "CMakeFiles/libprimesieve.dir/src/Erat.cpp.o.d"
+  "CMakeFiles/libprimesieve.dir/src/EratBig.cpp.o"
+  "CMakeFiles/libprimesieve.dir/src/EratBig.cpp.o.d"
+  "CMakeFiles/libprimesieve.dir/src/EratMedium.cpp.o"
+  "CMakeFiles/libprimesieve.dir/src/EratMedium.cpp.o.d"
+  "CMakeFiles/libprimesieve.dir/src/EratSmall.cpp.o"
+  "CMakeFiles/libprimesieve.dir/src/EratSmall.cpp.o.d"
+  "CMakeFiles/libprimesieve.dir/src/GapFinder.cpp.o"
+  "CMakeFiles/libprimesieve.dir/src/GapFinder.cpp.o.d"
+  "CMakeFiles/libprimesieve.dir/src/IteratorHelper.cpp.o"
+  "CMakeFiles/libprimesieve.dir/src/IteratorHelper.cpp.o.d"
+  "CMakeFiles/libprimesieve.dir/src/ParallelSieve.cpp.o"
+  "CMakeFiles/libprimesieve.dir/src/ParallelSieve.cpp.o.d"
+  "CMakeFiles/libprimesieve.dir/src/PiTable.cpp.o"
+  "CMakeFiles/libprimesieve.dir/src/PiTable.cpp.o.d"
+  "CMakeFiles/libprimesieve.dir/src/PreSieve.cpp.o"
+  "CMakeFiles/libprimesieve.dir/src/PreSieve.cpp.o.d"
+  "CMakeFiles/libprimesieve.dir/src/PrimeGenerator.cpp.o"
+  "CMakeFiles/libprimesieve.dir/src/PrimeGenerator.cpp.o.d"
+  "CMakeFiles/libprimesieve.dir/src/PrimeSieve.cpp.o"
+  "CMakeFiles/libprimesieve.dir/src/PrimeSieve.cpp.o.d"
+  "CMakeFiles/libprimesieve.dir/src/PrintPrimes.cpp.o"
+  "CMakeFiles/libprimesieve.dir/src/PrintPrimes.cpp.o.d"
+  "CMakeFiles/libprimesieve.dir/src/SieveBitmap.cpp.o"
+  "CMakeFiles/libprimesieve.dir/src/SieveBitmap.cpp.o.d"
+  "CMakeFiles/libprimesieve.dir/src/SievingPrimes.cpp.o"
+  "CMakeFiles/libprimesieve.dir/src/SievingPrimes.cpp.o.d"
+  "CMakeFiles/libprimesieve.dir/src/SievingPrimesCache.cpp.o"
+  "CMakeFiles/libprimesieve.dir/src/SievingPrimesCache.cpp.o.d"
+  "CMakeFiles/libprimesieve.dir/src/Stats.cpp.o"
+  "CMakeFiles/libprimesieve.dir/src/Stats.cpp.o.d"
+  "CMakeFiles/libprimesieve.dir/src/ThreadPool.cpp.o"
+  "CMakeFiles/libprimesieve.dir/src/ThreadPool.cpp.o.d"
+  "CMakeFiles/libprimesieve.dir/src/Wheel.cpp.o"
+  "CMakeFiles/libprimesieve.dir/src/Wheel.cpp.o.d"
+  "CMakeFiles/libprimesieve.dir/src/api-c.cpp.o"
+  "CMakeFiles/libprimesieve.dir/src/api-c.cpp.o.d"
+  "CMakeFiles/libprimesieve.dir/src/api.cpp.o"
+  "CMakeFiles/libprimesieve.dir/src/api.cpp.o.d"
+  "CMakeFiles/libprimesieve.dir/src/iterator-c.cpp.o"
+  "CMakeFiles/libprimesieve.dir/src/iterator-c.cpp.o.d"
+  "CMakeFiles/libprimesieve.dir/src/iterator.cpp.o"
+  "CMakeFiles/libprimesieve.dir/src/iterator.cpp.o.d"
+  "CMakeFiles/libprimesieve.dir/src/nthPrime.cpp.o"
+  "CMakeFiles/libprimesieve.dir/src/nthPrime.cpp.o.d"
+  "CMakeFiles/libprimesieve.dir/src/popcount.cpp.o"
+  "CMakeFiles/libprimesieve.dir/src/popcount.cpp.o.d"
+  "CMakeFiles/libprimesieve.dir/src/tune.cpp.o"
+  "CMakeFiles/libprimesieve.dir/src/tune.cpp.o.d"
+  "libprimesieve.pdb"
+  "libprimesieve.so"
+  "libprimesieve.so.9"
+  "libprimesieve.so.9.0.0"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libprimesieve.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
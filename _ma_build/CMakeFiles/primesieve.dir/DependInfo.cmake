@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/console/checkpoint.cpp" "CMakeFiles/primesieve.dir/src/console/checkpoint.cpp.o" "gcc" "CMakeFiles/primesieve.dir/src/console/checkpoint.cpp.o.d"
+  "/root/repo/src/console/cmdoptions.cpp" "CMakeFiles/primesieve.dir/src/console/cmdoptions.cpp.o" "gcc" "CMakeFiles/primesieve.dir/src/console/cmdoptions.cpp.o.d"
+  "/root/repo/src/console/fileout.cpp" "CMakeFiles/primesieve.dir/src/console/fileout.cpp.o" "gcc" "CMakeFiles/primesieve.dir/src/console/fileout.cpp.o.d"
+  "/root/repo/src/console/help.cpp" "CMakeFiles/primesieve.dir/src/console/help.cpp.o" "gcc" "CMakeFiles/primesieve.dir/src/console/help.cpp.o.d"
+  "/root/repo/src/console/main.cpp" "CMakeFiles/primesieve.dir/src/console/main.cpp.o" "gcc" "CMakeFiles/primesieve.dir/src/console/main.cpp.o.d"
+  "/root/repo/src/console/shard.cpp" "CMakeFiles/primesieve.dir/src/console/shard.cpp.o" "gcc" "CMakeFiles/primesieve.dir/src/console/shard.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ma_build/CMakeFiles/libprimesieve.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/primesieve.dir/src/console/checkpoint.cpp.o"
+  "CMakeFiles/primesieve.dir/src/console/checkpoint.cpp.o.d"
+  "CMakeFiles/primesieve.dir/src/console/cmdoptions.cpp.o"
+  "CMakeFiles/primesieve.dir/src/console/cmdoptions.cpp.o.d"
+  "CMakeFiles/primesieve.dir/src/console/fileout.cpp.o"
+  "CMakeFiles/primesieve.dir/src/console/fileout.cpp.o.d"
+  "CMakeFiles/primesieve.dir/src/console/help.cpp.o"
+  "CMakeFiles/primesieve.dir/src/console/help.cpp.o.d"
+  "CMakeFiles/primesieve.dir/src/console/main.cpp.o"
+  "CMakeFiles/primesieve.dir/src/console/main.cpp.o.d"
+  "CMakeFiles/primesieve.dir/src/console/shard.cpp.o"
+  "CMakeFiles/primesieve.dir/src/console/shard.cpp.o.d"
+  "primesieve"
+  "primesieve.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/primesieve.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/count_primes2.dir/count_primes2.cpp.o"
+  "CMakeFiles/count_primes2.dir/count_primes2.cpp.o.d"
+  "count_primes2"
+  "count_primes2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/count_primes2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
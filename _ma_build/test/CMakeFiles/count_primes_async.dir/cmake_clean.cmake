@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/count_primes_async.dir/count_primes_async.cpp.o"
+  "CMakeFiles/count_primes_async.dir/count_primes_async.cpp.o.d"
+  "count_primes_async"
+  "count_primes_async.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/count_primes_async.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/count_primes_batch.dir/count_primes_batch.cpp.o"
+  "CMakeFiles/count_primes_batch.dir/count_primes_batch.cpp.o.d"
+  "count_primes_batch"
+  "count_primes_batch.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/count_primes_batch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/count_quadruplets.dir/count_quadruplets.cpp.o"
+  "CMakeFiles/count_quadruplets.dir/count_quadruplets.cpp.o.d"
+  "count_quadruplets"
+  "count_quadruplets.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/count_quadruplets.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
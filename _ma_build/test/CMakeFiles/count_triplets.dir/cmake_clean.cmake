@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/count_triplets.dir/count_triplets.cpp.o"
+  "CMakeFiles/count_triplets.dir/count_triplets.cpp.o.d"
+  "count_triplets"
+  "count_triplets.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/count_triplets.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
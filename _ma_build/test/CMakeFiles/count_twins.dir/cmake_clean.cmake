@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/count_twins.dir/count_twins.cpp.o"
+  "CMakeFiles/count_twins.dir/count_twins.cpp.o.d"
+  "count_twins"
+  "count_twins.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/count_twins.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
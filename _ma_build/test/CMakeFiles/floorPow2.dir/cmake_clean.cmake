@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/floorPow2.dir/floorPow2.cpp.o"
+  "CMakeFiles/floorPow2.dir/floorPow2.cpp.o.d"
+  "floorPow2"
+  "floorPow2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/floorPow2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gap_stream_reader.dir/gap_stream_reader.cpp.o"
+  "CMakeFiles/gap_stream_reader.dir/gap_stream_reader.cpp.o.d"
+  "gap_stream_reader"
+  "gap_stream_reader.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gap_stream_reader.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
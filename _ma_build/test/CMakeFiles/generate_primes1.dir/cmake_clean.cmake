@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/generate_primes1.dir/generate_primes1.cpp.o"
+  "CMakeFiles/generate_primes1.dir/generate_primes1.cpp.o.d"
+  "generate_primes1"
+  "generate_primes1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/generate_primes1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
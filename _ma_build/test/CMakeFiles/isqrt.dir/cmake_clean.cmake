@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/isqrt.dir/isqrt.cpp.o"
+  "CMakeFiles/isqrt.dir/isqrt.cpp.o.d"
+  "isqrt"
+  "isqrt.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/isqrt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/next_prime1.dir/next_prime1.cpp.o"
+  "CMakeFiles/next_prime1.dir/next_prime1.cpp.o.d"
+  "next_prime1"
+  "next_prime1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/next_prime1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
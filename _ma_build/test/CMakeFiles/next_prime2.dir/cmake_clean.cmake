@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/next_prime2.dir/next_prime2.c.o"
+  "CMakeFiles/next_prime2.dir/next_prime2.c.o.d"
+  "next_prime2"
+  "next_prime2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/next_prime2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
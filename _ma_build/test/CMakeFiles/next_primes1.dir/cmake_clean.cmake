@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/next_primes1.dir/next_primes1.cpp.o"
+  "CMakeFiles/next_primes1.dir/next_primes1.cpp.o.d"
+  "next_primes1"
+  "next_primes1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/next_primes1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nth_prime1.dir/nth_prime1.cpp.o"
+  "CMakeFiles/nth_prime1.dir/nth_prime1.cpp.o.d"
+  "nth_prime1"
+  "nth_prime1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nth_prime1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
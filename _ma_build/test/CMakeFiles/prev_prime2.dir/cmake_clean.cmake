@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/prev_prime2.dir/prev_prime2.c.o"
+  "CMakeFiles/prev_prime2.dir/prev_prime2.c.o.d"
+  "prev_prime2"
+  "prev_prime2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/prev_prime2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
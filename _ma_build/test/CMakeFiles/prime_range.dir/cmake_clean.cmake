@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/prime_range.dir/prime_range.cpp.o"
+  "CMakeFiles/prime_range.dir/prime_range.cpp.o.d"
+  "prime_range"
+  "prime_range.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/prime_range.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
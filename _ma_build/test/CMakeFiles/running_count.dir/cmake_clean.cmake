@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/running_count.dir/running_count.cpp.o"
+  "CMakeFiles/running_count.dir/running_count.cpp.o.d"
+  "running_count"
+  "running_count.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/running_count.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
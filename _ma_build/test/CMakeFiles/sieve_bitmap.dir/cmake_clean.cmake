@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sieve_bitmap.dir/sieve_bitmap.cpp.o"
+  "CMakeFiles/sieve_bitmap.dir/sieve_bitmap.cpp.o.d"
+  "sieve_bitmap"
+  "sieve_bitmap.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sieve_bitmap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
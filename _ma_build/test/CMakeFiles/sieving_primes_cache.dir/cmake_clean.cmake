@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sieving_primes_cache.dir/sieving_primes_cache.cpp.o"
+  "CMakeFiles/sieving_primes_cache.dir/sieving_primes_cache.cpp.o.d"
+  "sieving_primes_cache"
+  "sieving_primes_cache.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sieving_primes_cache.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,110 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test
+# Build directory: /root/repo/_ma_build/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(atomic "/root/repo/_ma_build/test/atomic")
+set_tests_properties(atomic PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(calculator "/root/repo/_ma_build/test/calculator")
+set_tests_properties(calculator PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(cancel_sieve "/root/repo/_ma_build/test/cancel_sieve")
+set_tests_properties(cancel_sieve PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(chunked_sieve "/root/repo/_ma_build/test/chunked_sieve")
+set_tests_properties(chunked_sieve PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(compact_iterator "/root/repo/_ma_build/test/compact_iterator")
+set_tests_properties(compact_iterator PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(count_primes1 "/root/repo/_ma_build/test/count_primes1")
+set_tests_properties(count_primes1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(count_primes2 "/root/repo/_ma_build/test/count_primes2")
+set_tests_properties(count_primes2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(count_primes3 "/root/repo/_ma_build/test/count_primes3")
+set_tests_properties(count_primes3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(count_primes_async "/root/repo/_ma_build/test/count_primes_async")
+set_tests_properties(count_primes_async PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(count_primes_batch "/root/repo/_ma_build/test/count_primes_batch")
+set_tests_properties(count_primes_batch PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(count_quadruplets "/root/repo/_ma_build/test/count_quadruplets")
+set_tests_properties(count_quadruplets PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(count_quintuplets "/root/repo/_ma_build/test/count_quintuplets")
+set_tests_properties(count_quintuplets PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(count_sextuplets "/root/repo/_ma_build/test/count_sextuplets")
+set_tests_properties(count_sextuplets PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(count_triplets "/root/repo/_ma_build/test/count_triplets")
+set_tests_properties(count_triplets PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(count_twins "/root/repo/_ma_build/test/count_twins")
+set_tests_properties(count_twins PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(cpu_info "/root/repo/_ma_build/test/cpu_info")
+set_tests_properties(cpu_info PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(fastdiv "/root/repo/_ma_build/test/fastdiv")
+set_tests_properties(fastdiv PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(floorPow2 "/root/repo/_ma_build/test/floorPow2")
+set_tests_properties(floorPow2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(gap_stream_reader "/root/repo/_ma_build/test/gap_stream_reader")
+set_tests_properties(gap_stream_reader PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(generate_ktuplets "/root/repo/_ma_build/test/generate_ktuplets")
+set_tests_properties(generate_ktuplets PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(generate_n_primes1 "/root/repo/_ma_build/test/generate_n_primes1")
+set_tests_properties(generate_n_primes1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(generate_n_primes2 "/root/repo/_ma_build/test/generate_n_primes2")
+set_tests_properties(generate_n_primes2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(generate_primes1 "/root/repo/_ma_build/test/generate_primes1")
+set_tests_properties(generate_primes1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(generate_primes2 "/root/repo/_ma_build/test/generate_primes2")
+set_tests_properties(generate_primes2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(generate_primes_uint32 "/root/repo/_ma_build/test/generate_primes_uint32")
+set_tests_properties(generate_primes_uint32 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(generate_twin_primes "/root/repo/_ma_build/test/generate_twin_primes")
+set_tests_properties(generate_twin_primes PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(histogram "/root/repo/_ma_build/test/histogram")
+set_tests_properties(histogram PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(ilog2 "/root/repo/_ma_build/test/ilog2")
+set_tests_properties(ilog2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(isqrt "/root/repo/_ma_build/test/isqrt")
+set_tests_properties(isqrt PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(isqrt_constexpr "/root/repo/_ma_build/test/isqrt_constexpr")
+set_tests_properties(isqrt_constexpr PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(iterator_cache_size "/root/repo/_ma_build/test/iterator_cache_size")
+set_tests_properties(iterator_cache_size PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(iterator_flip "/root/repo/_ma_build/test/iterator_flip")
+set_tests_properties(iterator_flip PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(next_prime1 "/root/repo/_ma_build/test/next_prime1")
+set_tests_properties(next_prime1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(next_prime2 "/root/repo/_ma_build/test/next_prime2")
+set_tests_properties(next_prime2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(next_primes1 "/root/repo/_ma_build/test/next_primes1")
+set_tests_properties(next_primes1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(next_primes2 "/root/repo/_ma_build/test/next_primes2")
+set_tests_properties(next_primes2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(nth_prime1 "/root/repo/_ma_build/test/nth_prime1")
+set_tests_properties(nth_prime1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(nth_prime2 "/root/repo/_ma_build/test/nth_prime2")
+set_tests_properties(nth_prime2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(nth_prime3 "/root/repo/_ma_build/test/nth_prime3")
+set_tests_properties(nth_prime3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(number_of_bits "/root/repo/_ma_build/test/number_of_bits")
+set_tests_properties(number_of_bits PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(prev_prime1 "/root/repo/_ma_build/test/prev_prime1")
+set_tests_properties(prev_prime1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(prev_prime2 "/root/repo/_ma_build/test/prev_prime2")
+set_tests_properties(prev_prime2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(prime_gaps "/root/repo/_ma_build/test/prime_gaps")
+set_tests_properties(prime_gaps PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(prime_range "/root/repo/_ma_build/test/prime_range")
+set_tests_properties(prime_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(resize_sieve "/root/repo/_ma_build/test/resize_sieve")
+set_tests_properties(resize_sieve PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(running_count "/root/repo/_ma_build/test/running_count")
+set_tests_properties(running_count PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(segment_export "/root/repo/_ma_build/test/segment_export")
+set_tests_properties(segment_export PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sieve_bitmap "/root/repo/_ma_build/test/sieve_bitmap")
+set_tests_properties(sieve_bitmap PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(sieving_primes_cache "/root/repo/_ma_build/test/sieving_primes_cache")
+set_tests_properties(sieving_primes_cache PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(skipto_reposition "/root/repo/_ma_build/test/skipto_reposition")
+set_tests_properties(skipto_reposition PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(split_range "/root/repo/_ma_build/test/split_range")
+set_tests_properties(split_range PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(store_primes_parallel "/root/repo/_ma_build/test/store_primes_parallel")
+set_tests_properties(store_primes_parallel PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;8;add_test;/root/repo/test/CMakeLists.txt;0;")
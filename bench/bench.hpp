@@ -0,0 +1,44 @@
+///
+/// @file   bench.hpp
+/// @brief  Helpers shared by the benchmark programs. Each
+///         benchmark prints one CSV record per measurement:
+///         benchmark,parameters,seconds,unit,rate
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#ifndef BENCH_HPP
+#define BENCH_HPP
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+/// Seconds since an arbitrary epoch
+inline double getTime()
+{
+  using namespace std::chrono;
+  auto now = steady_clock::now().time_since_epoch();
+  return duration_cast<duration<double>>(now).count();
+}
+
+/// Print one machine-readable CSV record
+inline void report(const std::string& benchmark,
+                   const std::string& parameters,
+                   double seconds,
+                   const std::string& unit,
+                   double rate)
+{
+  std::printf("%s,%s,%.6f,%s,%.4e\n",
+              benchmark.c_str(),
+              parameters.c_str(),
+              seconds,
+              unit.c_str(),
+              rate);
+  std::fflush(stdout);
+}
+
+#endif
@@ -0,0 +1,45 @@
+///
+/// @file   bench_count.cpp
+/// @brief  End-to-end prime counting benchmark over 10^9 wide
+///         windows at increasing offsets. The offsets cover the
+///         magnitudes our users sieve at, full range counts up
+///         to these offsets would run for hours.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include "bench.hpp"
+
+#include <primesieve.hpp>
+
+#include <stdint.h>
+#include <string>
+
+namespace {
+
+void benchCount(const std::string& params,
+                uint64_t start,
+                uint64_t dist)
+{
+  double t0 = getTime();
+  primesieve::count_primes(start, start + dist);
+  double seconds = getTime() - t0;
+  report("count_primes", params, seconds, "numbers/s", dist / seconds);
+}
+
+} // namespace
+
+int main()
+{
+  // single-threaded, comparable across machines
+  primesieve::set_num_threads(1);
+
+  benchCount("start=1e10;dist=1e9", 10000000000ull, 1000000000ull);
+  benchCount("start=1e14;dist=1e9", 100000000000000ull, 1000000000ull);
+  benchCount("start=1e18;dist=1e8", 1000000000000000000ull, 100000000ull);
+
+  return 0;
+}
@@ -0,0 +1,74 @@
+///
+/// @file   bench_erat.cpp
+/// @brief  Benchmark raw segment sieving throughput. The offsets
+///         are chosen so that different Erat algorithms dominate:
+///         at 10^9 most work is done by EratSmall/EratMedium,
+///         at 10^13 EratMedium/EratBig and at 10^17 EratBig.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include "bench.hpp"
+
+#include <primesieve.hpp>
+#include <primesieve/Erat.hpp>
+#include <primesieve/PreSieve.hpp>
+#include <primesieve/SievingPrimes.hpp>
+#include <primesieve/pmath.hpp>
+
+#include <stdint.h>
+#include <string>
+
+using namespace primesieve;
+
+namespace {
+
+/// Sieves [start, stop] without consuming the
+/// sieve array, measures sieving only
+///
+class SieveBench : public Erat
+{
+public:
+  void sieve(uint64_t start, uint64_t stop)
+  {
+    PreSieve preSieve(start, stop);
+    init(start, stop, get_sieve_size(), preSieve);
+    SievingPrimes sievingPrimes(this, preSieve);
+    uint64_t prime = sievingPrimes.next();
+
+    while (hasNextSegment())
+    {
+      uint64_t sqrtHigh = isqrt(segmentHigh_);
+
+      for (; prime <= sqrtHigh; prime = sievingPrimes.next())
+        addSievingPrime(prime);
+
+      sieveSegment();
+    }
+  }
+};
+
+void benchSieve(const std::string& params,
+                uint64_t start,
+                uint64_t dist)
+{
+  SieveBench erat;
+  double t0 = getTime();
+  erat.sieve(start, start + dist);
+  double seconds = getTime() - t0;
+  report("erat_sieve", params, seconds, "numbers/s", dist / seconds);
+}
+
+} // namespace
+
+int main()
+{
+  benchSieve("start=1e9;dist=1e9",   1000000000ull, 1000000000ull);
+  benchSieve("start=1e13;dist=1e9",  10000000000000ull, 1000000000ull);
+  benchSieve("start=1e17;dist=5e8",  100000000000000000ull, 500000000ull);
+
+  return 0;
+}
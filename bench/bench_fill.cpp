@@ -0,0 +1,37 @@
+///
+/// @file   bench_fill.cpp
+/// @brief  Benchmark PrimeGenerator::fill() which converts the
+///         sieve array into a vector of prime numbers.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include "bench.hpp"
+
+#include <primesieve/PrimeGenerator.hpp>
+
+#include <stdint.h>
+#include <vector>
+
+using namespace primesieve;
+
+int main()
+{
+  uint64_t start = 1000000000ull;
+  uint64_t stop = start + 200000000ull;
+
+  std::vector<uint64_t> primes;
+  double t0 = getTime();
+
+  PrimeGenerator gen(start, stop);
+  gen.fill(primes);
+
+  double seconds = getTime() - t0;
+  report("primegenerator_fill", "start=1e9;dist=2e8", seconds,
+         "primes/s", primes.size() / seconds);
+
+  return 0;
+}
@@ -0,0 +1,71 @@
+///
+/// @file   bench_iterator.cpp
+/// @brief  Benchmark primesieve::iterator throughput,
+///         one prime at a time and batched.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include "bench.hpp"
+
+#include <primesieve.hpp>
+
+#include <stdint.h>
+#include <cstddef>
+#include <vector>
+
+int main()
+{
+  uint64_t start = 1000000000ull;
+  uint64_t n = 20000000ull;
+
+  // next_prime()
+  {
+    primesieve::iterator it(start);
+    volatile uint64_t prime = 0;
+    double t0 = getTime();
+
+    for (uint64_t i = 0; i < n; i++)
+      prime = it.next_prime();
+
+    double seconds = getTime() - t0;
+    (void) prime;
+    report("iterator_next_prime", "start=1e9;primes=2e7",
+           seconds, "primes/s", n / seconds);
+  }
+
+  // next_primes() batch API
+  {
+    primesieve::iterator it(start);
+    std::vector<uint64_t> primes(1024);
+    uint64_t count = 0;
+    double t0 = getTime();
+
+    while (count < n)
+      count += it.next_primes(&primes[0], primes.size());
+
+    double seconds = getTime() - t0;
+    report("iterator_next_primes", "start=1e9;primes=2e7;batch=1024",
+           seconds, "primes/s", count / seconds);
+  }
+
+  // compact (gap-encoded) mode
+  {
+    primesieve::iterator it(start, primesieve::get_max_stop(), false, true);
+    volatile uint64_t prime = 0;
+    double t0 = getTime();
+
+    for (uint64_t i = 0; i < n; i++)
+      prime = it.next_prime();
+
+    double seconds = getTime() - t0;
+    (void) prime;
+    report("iterator_next_prime_compact", "start=1e9;primes=2e7",
+           seconds, "primes/s", n / seconds);
+  }
+
+  return 0;
+}
@@ -0,0 +1,45 @@
+///
+/// @file   bench_popcount.cpp
+/// @brief  Benchmark popcount() over sieve sized buffers,
+///         used by all counting code paths.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include "bench.hpp"
+
+#include <primesieve/types.hpp>
+
+#include <stdint.h>
+#include <random>
+#include <vector>
+
+using namespace primesieve;
+
+int main()
+{
+  // 256 KB, the size of a typical sieve segment
+  uint64_t words = (256 << 10) / sizeof(uint64_t);
+  int iters = 20000;
+
+  std::vector<uint64_t> buffer(words);
+  std::mt19937_64 rng(7);
+  for (uint64_t& word : buffer)
+    word = rng();
+
+  // volatile prevents the loop from being optimized away
+  volatile uint64_t sum = 0;
+  double t0 = getTime();
+
+  for (int i = 0; i < iters; i++)
+    sum += popcount(&buffer[0], words);
+
+  double seconds = getTime() - t0;
+  double bytes = (double) words * sizeof(uint64_t) * iters;
+  report("popcount", "bufferSize=256K", seconds, "MB/s", bytes / 1e6 / seconds);
+
+  return 0;
+}
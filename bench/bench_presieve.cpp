@@ -0,0 +1,46 @@
+///
+/// @file   bench_presieve.cpp
+/// @brief  Benchmark PreSieve::copy() which initializes each
+///         segment with the multiples of small primes crossed off.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include "bench.hpp"
+
+#include <primesieve/PreSieve.hpp>
+#include <primesieve/types.hpp>
+
+#include <stdint.h>
+#include <vector>
+
+using namespace primesieve;
+
+int main()
+{
+  uint64_t start = 1000000000ull;
+  uint64_t stop = start * 10;
+  uint64_t sieveSize = 256 << 10;
+  int iters = 4000;
+
+  PreSieve preSieve(start, stop);
+  std::vector<byte_t> sieve(sieveSize);
+
+  double t0 = getTime();
+  uint64_t low = 30;
+
+  for (int i = 0; i < iters; i++)
+  {
+    preSieve.copy(&sieve[0], sieveSize, low);
+    low += sieveSize * 30;
+  }
+
+  double seconds = getTime() - t0;
+  double bytes = (double) sieveSize * iters;
+  report("presieve_copy", "sieveSize=256K", seconds, "MB/s", bytes / 1e6 / seconds);
+
+  return 0;
+}
@@ -69,6 +69,19 @@ enum {
  */
 void* primesieve_generate_primes(uint64_t start, uint64_t stop, size_t* size, int type);
 
+/**
+ * Store the primes inside the interval [start, stop] in the
+ * caller-provided buffer (no memory allocation). Storing stops
+ * once the buffer is full, if the return value equals capacity
+ * the buffer may have been too small.
+ * @param buf       Caller-owned buffer the primes are written to.
+ * @param capacity  The size of the buffer in primes (not bytes).
+ * @param type      The type of the primes to generate, e.g. INT_PRIMES.
+ * @return  The number of primes written to the buffer,
+ *          SIZE_MAX if an error occurs.
+ */
+size_t primesieve_generate_primes_buf(uint64_t start, uint64_t stop, void* buf, size_t capacity, int type);
+
 /**
  * Get an array with the first n primes >= start.
  * @param type  The type of the primes to generate, e.g. INT_PRIMES.
@@ -94,6 +107,18 @@ uint64_t primesieve_nth_prime(int64_t n, uint64_t start);
  */
 uint64_t primesieve_count_primes(uint64_t start, uint64_t stop);
 
+/**
+ * Count the primes within the interval [start, stop]
+ * asynchronously on primesieve's internal thread pool and
+ * invoke the callback with the result once the job has
+ * finished. Each job sieves on a single pool thread, at most
+ * primesieve_get_async_threads() jobs run concurrently,
+ * further jobs are queued. The callback is invoked on the
+ * worker thread, with count = PRIMESIEVE_ERROR if an error
+ * occurred.
+ */
+void primesieve_count_primes_async(uint64_t start, uint64_t stop, void (*callback)(uint64_t count, void* data), void* data);
+
 /**
  * Count the twin primes within the interval [start, stop]. 
  * By default all CPU cores are used, use
@@ -182,6 +207,9 @@ int primesieve_get_sieve_size();
 /** Get the current set number of threads */
 int primesieve_get_num_threads();
 
+/** Get the current set number of concurrently running asynchronous jobs */
+int primesieve_get_async_threads();
+
 /**
  * Set the sieve size in kilobytes.
  * The best sieving performance is achieved with a sieve size
@@ -191,6 +219,13 @@ int primesieve_get_num_threads();
  */
 void primesieve_set_sieve_size(int sieve_size);
 
+/**
+ * Set the sieve size in kilobytes for the calling thread
+ * only, takes precedence over primesieve_set_sieve_size().
+ * Pass 0 to remove the override.
+ */
+void primesieve_set_thread_sieve_size(int sieve_size);
+
 /**
  * Set the number of threads for use in
  * primesieve_count_*() and primesieve_nth_prime().
@@ -198,6 +233,29 @@ void primesieve_set_sieve_size(int sieve_size);
  */
 void primesieve_set_num_threads(int num_threads);
 
+/**
+ * Set the number of threads for the calling thread only,
+ * takes precedence over primesieve_set_num_threads().
+ * Pass 0 to remove the override.
+ */
+void primesieve_set_thread_num_threads(int num_threads);
+
+/**
+ * Set the number of asynchronous jobs (e.g.
+ * primesieve_count_primes_async()) that are allowed to run
+ * concurrently on primesieve's internal thread pool.
+ * By default primesieve_get_num_threads() jobs are used.
+ */
+void primesieve_set_async_threads(int async_threads);
+
+/**
+ * Calibrate the crossover points of primesieve's sieving
+ * algorithms for the CPU this process runs on by timing a
+ * few short sieving runs (takes about 1 second). The tuned
+ * values are cached for the lifetime of the process.
+ */
+void primesieve_tune();
+
 /**
  * Deallocate a primes array created using the
  * primesieve_generate_primes() or primesieve_generate_n_primes()
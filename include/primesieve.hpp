@@ -17,11 +17,16 @@
 #define PRIMESIEVE_VERSION_MAJOR 7
 #define PRIMESIEVE_VERSION_MINOR 0
 
+#include <primesieve/GapStreamReader.hpp>
+#include <primesieve/generator.hpp>
 #include <primesieve/iterator.hpp>
 #include <primesieve/primesieve_error.hpp>
+#include <primesieve/PrimeRange.hpp>
 #include <primesieve/StorePrimes.hpp>
 
 #include <stdint.h>
+#include <cstddef>
+#include <future>
 #include <vector>
 #include <string>
 
@@ -62,6 +67,43 @@ inline void generate_n_primes(uint64_t n, uint64_t start, std::vector<T>* primes
     store_n_primes(n, start, *primes);
 }
 
+/// Store the primes <= stop in the primes vector.
+/// Overload for uint32_t vectors: the primes are written as
+/// native 32-bit values straight from the sieve, halving the
+/// cache footprint and memory bandwidth compared to the
+/// generic 64-bit path.
+/// @pre stop <= 2^32 - 1, otherwise a primesieve_error
+///      is thrown.
+///
+void generate_primes(uint64_t stop, std::vector<uint32_t>* primes);
+
+/// Store the primes within the interval [start, stop]
+/// in the primes vector, see the uint32_t overload above.
+/// @pre stop <= 2^32 - 1, otherwise a primesieve_error
+///      is thrown.
+///
+void generate_primes(uint64_t start, uint64_t stop, std::vector<uint32_t>* primes);
+
+/// Store the twin primes within the interval [start, stop]
+/// in the twins vector. Only the smaller member p of each
+/// twin pair (p, p + 2) is stored, both members are inside
+/// [start, stop]. The twins are extracted directly from the
+/// sieve bits without generating a full prime list.
+///
+void generate_twin_primes(uint64_t start, uint64_t stop, std::vector<uint64_t>& twins);
+
+/// Store the start values of the prime k-tuplets within the
+/// interval [start, stop] in the tuplets vector, e.g. k = 3
+/// stores p for each prime triplet (p, p + 2, p + 6) and
+/// (p, p + 4, p + 6). All k members are inside [start, stop].
+/// The tuplets are extracted directly from the sieve bits
+/// using per byte bitmask matching, without generating a
+/// full prime list.
+/// @pre 2 <= k <= 6 (twins, ..., sextuplets), otherwise a
+///      primesieve_error is thrown.
+///
+void generate_ktuplets(uint64_t start, uint64_t stop, int k, std::vector<uint64_t>& tuplets);
+
 /// Find the nth prime.
 /// By default all CPU cores are used, use
 /// primesieve::set_num_threads(int threads) to change the
@@ -79,6 +121,16 @@ uint64_t nth_prime(int64_t n, uint64_t start = 0);
 ///
 uint64_t count_primes(uint64_t start, uint64_t stop);
 
+/// Count the primes within the interval [start, stop]
+/// asynchronously on primesieve's internal thread pool.
+/// Each job sieves on a single pool thread, at most
+/// get_async_threads() jobs run concurrently, further jobs
+/// are queued. This allows applications to overlap sieving
+/// with other work (e.g. I/O) without oversubscribing the
+/// CPU cores with their own executor.
+///
+std::future<uint64_t> count_primes_async(uint64_t start, uint64_t stop);
+
 /// Count the twin primes within the interval [start, stop].
 /// By default all CPU cores are used, use
 /// primesieve::set_num_threads(int threads) to change the
@@ -144,10 +196,63 @@ void print_quintuplets(uint64_t start, uint64_t stop);
 ///
 void print_sextuplets(uint64_t start, uint64_t stop);
 
-/// Returns the largest valid stop number for primesieve.
-/// @return 2^64-1 (UINT64_MAX).
+/// A closed interval [start, stop],
+/// used by count_primes_batch()
+struct Range
+{
+  uint64_t start;
+  uint64_t stop;
+};
+
+/// Count the primes within each of the size intervals
+/// [ranges[i].start, ranges[i].stop]. The sieving primes and
+/// the pre-sieve buffers are generated only once, for the
+/// largest stop number, and shared across all intervals.
+/// For many scattered intervals of the same magnitude this
+/// is much faster than calling count_primes() per interval
+/// which rebuilds that state from scratch each time. The
+/// intervals are counted in parallel using all CPU cores.
+/// @return The prime counts, in the order of the intervals.
+///
+std::vector<uint64_t> count_primes_batch(const Range* ranges, std::size_t size);
+
+/// Split the interval [start, stop] into chunks well-sized
+/// subranges using primesieve's own multi-threading chunk
+/// logic. The subrange boundaries are aligned to modulo
+/// (30 + 2) so that no prime k-tuplet spans two subranges:
+/// counting or printing the subranges independently (e.g. by
+/// an external scheduler or on different machines) and summing
+/// gives the same totals as one sieve over [start, stop].
+/// The subranges tile [start, stop] without gaps or overlap.
+/// The number of returned subranges may differ from chunks
+/// due to alignment and minimum chunk size constraints.
+///
+std::vector<Range> split_range(uint64_t start, uint64_t stop, int chunks);
+
+/// A gap between two consecutive primes,
+/// the gap size is nextPrime - prevPrime
+struct PrimeGap
+{
+  uint64_t prevPrime;
+  uint64_t nextPrime;
+};
+
+/// Find the gaps >= minGap between consecutive primes within
+/// the interval [start, stop]. The gaps are searched directly
+/// in the sieve bits: all-zero 64-bit words (240 numbers) are
+/// skipped with a single compare and the primes of a word are
+/// decoded only if the word can contain a qualifying gap.
+/// This is much faster than generating all primes and diffing
+/// neighboring primes. minGap <= 1 finds all gaps.
+/// @return The gaps in ascending order.
+///
+std::vector<PrimeGap> find_prime_gaps(uint64_t start, uint64_t stop, uint64_t minGap);
+
+/// Find the maximal gap between consecutive primes within
+/// the interval [start, stop].
+/// @return { 0, 0 } if [start, stop] contains < 2 primes.
 ///
-uint64_t get_max_stop();
+PrimeGap max_prime_gap(uint64_t start, uint64_t stop);
 
 /// Get the current set sieve size in kilobytes.
 int get_sieve_size();
@@ -155,6 +260,11 @@ int get_sieve_size();
 /// Get the current set number of threads.
 int get_num_threads();
 
+/// Get the current set number of concurrently
+/// running asynchronous jobs.
+///
+int get_async_threads();
+
 /// Set the sieve size in kilobytes.
 /// The best sieving performance is achieved with a sieve size
 /// of your CPU's L1 or L2 cache size (per core).
@@ -163,12 +273,70 @@ int get_num_threads();
 ///
 void set_sieve_size(int sieve_size);
 
+/// Set the sieve size in kilobytes for the calling thread
+/// only, takes precedence over set_sieve_size(). Threads
+/// with different workloads in the same process can thereby
+/// use different tunings. Pass 0 to remove the override.
+///
+void set_thread_sieve_size(int sieve_size);
+
 /// Set the number of threads for use in
 /// primesieve::count_*() and primesieve::nth_prime().
 /// By default all CPU cores are used.
 ///
 void set_num_threads(int num_threads);
 
+/// Set the number of threads for the calling thread only,
+/// takes precedence over set_num_threads(). Pass 0 to
+/// remove the override.
+///
+void set_thread_num_threads(int num_threads);
+
+/// Set the number of asynchronous jobs (e.g.
+/// primesieve::count_primes_async()) that are allowed to run
+/// concurrently on primesieve's internal thread pool.
+/// By default get_num_threads() jobs are used.
+///
+void set_async_threads(int async_threads);
+
+/// Free the memory that primesieve caches for reuse
+/// across sieving runs, e.g. the bucket memory of the
+/// segmented sieve. Useful in case of memory pressure.
+///
+void trim_memory();
+
+/// Calibrate the EratSmall/EratMedium/EratBig crossover
+/// points for the CPU this process runs on by timing a few
+/// short sieving runs (takes about 1 second). The tuned
+/// factors are cached for the lifetime of the process,
+/// subsequent calls return immediately. Applications can
+/// persist them across runs using get_factor_eratsmall()
+/// and set_factor_eratsmall().
+///
+void tune();
+
+/// Get the current EratSmall crossover factor, sieving
+/// primes <= (L1 cache size * factor) are processed
+/// in EratSmall.
+///
+double get_factor_eratsmall();
+
+/// Get the current EratMedium crossover factor, sieving
+/// primes <= (sieve size * factor) are processed
+/// in EratMedium.
+///
+double get_factor_eratmedium();
+
+/// Set the EratSmall crossover factor.
+/// @pre factor >= 0.1 && <= 3.
+///
+void set_factor_eratsmall(double factor);
+
+/// Set the EratMedium crossover factor.
+/// @pre factor >= 0.1 && <= 5.
+///
+void set_factor_eratmedium(double factor);
+
 /// Get the primesieve version number, in the form “i.j”.
 std::string primesieve_version();
 
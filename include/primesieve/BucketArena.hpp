@@ -0,0 +1,65 @@
+///
+/// @file   BucketArena.hpp
+/// @brief  Thread-safe arena that recycles the bucket memory of
+///         EratBig across PrimeSieve instances. Reusing warm,
+///         already page-faulted bucket chunks avoids the large
+///         allocation cost when many PrimeSieve objects are
+///         constructed back to back. Chunk sizes are rounded up
+///         to powers of 2 and cached in size-class freelists,
+///         acquire() is O(number of size classes) and repeated
+///         runs get exact-fit chunks without fragmentation.
+///         trim() frees all cached chunks in case of memory
+///         pressure.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#ifndef BUCKETARENA_HPP
+#define BUCKETARENA_HPP
+
+#include "Bucket.hpp"
+
+#include <stdint.h>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace primesieve {
+
+class BucketArena
+{
+public:
+  /// Contiguous array of buckets
+  struct Chunk
+  {
+    std::unique_ptr<Bucket[]> buckets;
+    uint64_t size = 0;
+  };
+
+  /// Get a chunk of >= size buckets, reuses a
+  /// cached chunk whenever possible
+  ///
+  Chunk acquire(uint64_t size);
+
+  /// Return a chunk to the arena for later reuse
+  void release(Chunk chunk);
+
+  /// Free all cached chunks
+  void trim();
+
+  // Singleton, shared by all EratBig objects
+  static BucketArena& getInstance();
+
+private:
+  enum { SIZE_CLASSES = 64 };
+  /// freeLists_[k] caches chunks of 2^k buckets
+  std::vector<Chunk> freeLists_[SIZE_CLASSES];
+  std::mutex lock_;
+};
+
+} // namespace
+
+#endif
@@ -0,0 +1,105 @@
+///
+/// @file   ChunkedSieve.hpp
+/// @brief  Pull-based parallel sieve driven by an external
+///         threading runtime (OpenMP, TBB, ...). ParallelSieve
+///         spawns its own threads, which oversubscribes the
+///         machine when called from inside a parallel region.
+///         ChunkedSieve instead hands out the same work chunks
+///         ParallelSieve's threads would claim: each host thread
+///         loops claimNextChunk() + sieveChunk() with its own
+///         local counts and calls merge() once at the end, e.g.
+///
+///         ChunkedSieve cs(start, stop, COUNT_PRIMES);
+///         #pragma omp parallel
+///         {
+///           counts_t counts{};
+///           SieveChunk chunk;
+///           while (cs.claimNextChunk(chunk))
+///             cs.sieveChunk(chunk, counts);
+///           cs.merge(counts);
+///         }
+///         uint64_t primes = cs.getCount(0);
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#ifndef CHUNKEDSIEVE_HPP
+#define CHUNKEDSIEVE_HPP
+
+#include "ParallelSieve.hpp"
+#include "PrimeSieve.hpp"
+
+#include <stdint.h>
+#include <atomic>
+#include <mutex>
+
+namespace primesieve {
+
+/// One claimed work chunk. sieveChunk() sieves
+/// [start, stop] but counts only numbers <= countStop,
+/// the overlap lets prime k-tuplets spanning a chunk
+/// boundary be counted by the chunk containing their
+/// first prime (the ParallelSieve boundary convention).
+///
+struct SieveChunk
+{
+  uint64_t start;
+  uint64_t stop;
+  uint64_t countStop;
+};
+
+class ChunkedSieve
+{
+public:
+  /// @flags:    COUNT_* flags, printing is not supported
+  /// @threads:  number of host threads that will drive the
+  ///            sieve, used to size the chunks, 0 uses
+  ///            ParallelSieve's default thread count
+  ///
+  ChunkedSieve(uint64_t start,
+               uint64_t stop,
+               int flags = COUNT_PRIMES,
+               int threads = 0);
+
+  /// Claim the next work chunk, thread-safe and lock-free.
+  /// @return  false once all chunks have been claimed.
+  ///
+  bool claimNextChunk(SieveChunk& chunk);
+
+  /// Sieve a claimed chunk and add its counts to the
+  /// caller's localCounts, no synchronization
+  ///
+  void sieveChunk(const SieveChunk& chunk, counts_t& localCounts) const;
+
+  /// Merge a host thread's localCounts into the totals,
+  /// thread-safe, call once per host thread
+  ///
+  void merge(const counts_t& localCounts);
+
+  /// Total count of primes (index 0), twins (1), ...,
+  /// sextuplets (5). Call after all host threads have
+  /// merged their counts.
+  ///
+  uint64_t getCount(int index) const;
+
+private:
+  uint64_t start_;
+  uint64_t stop_;
+  int flags_;
+  int threads_;
+  /// Shared chunk cursor, claimNextChunk() advances
+  /// it with a CAS loop
+  std::atomic<uint64_t> low_;
+  std::mutex mergeLock_;
+  counts_t counts_;
+  /// Supplies the chunk sizing and boundary logic that
+  /// ParallelSieve's own threads use, see getWork()
+  ParallelSieve parallelSieve_;
+};
+
+} // namespace
+
+#endif
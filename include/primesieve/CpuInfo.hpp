@@ -13,6 +13,7 @@
 
 #include <cstddef>
 #include <string>
+#include <vector>
 
 namespace primesieve {
 
@@ -23,15 +24,39 @@ public:
   bool hasL1Cache() const;
   bool hasL2Cache() const;
   bool privateL2Cache() const;
+  bool hasCpuCores() const;
   std::string getError() const;
   std::size_t l1CacheSize() const;
   std::size_t l2CacheSize() const;
+  /// Per-CPU cache sizes for hybrid CPUs (e.g. P/E cores,
+  /// big.LITTLE) whose core types have different cache
+  /// sizes. Falls back to the system-wide (cpu0) size if
+  /// per-CPU detection is unsupported, currently the
+  /// per-CPU sizes are detected on Linux only.
+  std::size_t l1CacheSize(std::size_t cpu) const;
+  std::size_t l2CacheSize(std::size_t cpu) const;
+  /// true if at least two CPUs have different
+  /// L1 or L2 cache sizes
+  bool hasAsymmetricCaches() const;
+  /// Number of physical CPU cores (not SMT threads),
+  /// 0 if the detection failed
+  std::size_t cpuCores() const;
+  /// NUMA topology, currently detected on Linux only.
+  /// On other OSes numaNodes() returns 0.
+  std::size_t numaNodes() const;
+  const std::vector<std::size_t>& numaNodeCpus(std::size_t node) const;
 
 private:
   std::size_t l1CacheSize_;
   std::size_t l2CacheSize_;
+  std::size_t cpuCores_;
   bool privateL2Cache_;
+  bool asymmetricCaches_ = false;
+  /// Per-CPU cache sizes, empty if undetected
+  std::vector<std::size_t> l1CacheSizes_;
+  std::vector<std::size_t> l2CacheSizes_;
   std::string error_;
+  std::vector<std::vector<std::size_t>> numaNodeCpus_;
   void init();
 };
 
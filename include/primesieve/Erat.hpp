@@ -17,6 +17,7 @@
 
 #include <stdint.h>
 #include <array>
+#include <atomic>
 #include <memory>
 
 namespace primesieve {
@@ -29,11 +30,38 @@ class PreSieve;
 /// Eratosthenes algorithms optimized for small, medium and big
 /// sieving primes to cross-off multiples.
 ///
+/// The modulo 30 layout is deliberate: a modulo 210 bit array
+/// (48 residues per 210 numbers) would be ~9% smaller, but its
+/// residues no longer fit into whole bytes, so every kernel
+/// (pre-sieving, cross-off, counting, decoding) loses its cheap
+/// byte indexing. Prime 7's multiples are not sieved per segment
+/// anyway, PreSieve removes the multiples of all primes <= 19
+/// when the segment is initialized. Only the sieving primes use
+/// a modulo 210 wheel (Wheel210_t) where the larger wheel costs
+/// nothing.
+///
 class Erat
 {
 public:
   uint64_t getSieveSize() const;
   uint64_t getStop() const;
+
+  /// Remainder of n mod 30 mapped into [7, 36] so that it
+  /// indexes the unsetSmaller & unsetLarger tables.
+  /// Branchless: a table lookup instead of a conditional
+  /// add, this runs on the segment boundary paths.
+  ///
+  static uint64_t byteRemainder(uint64_t n)
+  {
+    static const uint8_t remainders[30] =
+    {
+      30, 31, 32, 33, 34, 35, 36,  7,  8,  9,
+      10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+      20, 21, 22, 23, 24, 25, 26, 27, 28, 29
+    };
+
+    return remainders[n % 30];
+  }
 protected:
   /// Sieve primes >= start_
   uint64_t start_ = 0;
@@ -41,6 +69,9 @@ protected:
   uint64_t stop_ = 0;
   /// Size of sieve_ in bytes (power of 2)
   uint64_t sieveSize_ = 0;
+  /// Distance covered per segment (sieveSize_ * 30),
+  /// hoisted out of the segment advance in sieveSegment()
+  uint64_t segmentDist_ = 0;
   /// Lower bound of the current segment
   uint64_t segmentLow_ = ~0ull;
   /// Upper bound of the current segment
@@ -48,26 +79,64 @@ protected:
   /// Sieve of Eratosthenes array
   byte_t* sieve_ = nullptr;
   PreSieve* preSieve_;
+  /// stop_ < 2^62, the segment advance cannot overflow
+  /// and uses raw arithmetic instead of checkedAdd()
+  bool uncheckedSegments_ = false;
   Erat();
   Erat(uint64_t, uint64_t);
   virtual ~Erat();
   void init(uint64_t, uint64_t, uint64_t, PreSieve&);
+  void setCancelFlag(const std::atomic<bool>*);
   void addSievingPrime(uint64_t);
   void sieveSegment();
+  void resizeSieve(uint64_t);
+  /// Invoked by crossOff() once per finished L1-sized block
+  /// of sieve_ (byte offset, size in bytes). EratSmall runs
+  /// last and block by block, so when it has passed a block
+  /// all multiples in it are crossed-off and a consumer can
+  /// process the block while it is still cache resident,
+  /// before the cross-off continues ahead. Default: no-op.
+  virtual void processBlock(uint64_t, uint64_t);
   bool hasNextSegment() const;
   static uint64_t nextPrime(uint64_t*, uint64_t);
+#if defined(__GNUC__) || \
+    defined(__clang__)
+  /// Numbers corresponding to the bits of a sieve byte
+  static const std::array<uint64_t, 8> bitValues_;
+#endif
 private:
+#if !defined(__GNUC__) && \
+    !defined(__clang__)
   static const std::array<uint64_t, 64> bruijnBitValues_;
+#endif
   uint64_t maxPreSieve_;
   uint64_t maxEratSmall_;
   uint64_t maxEratMedium_;
+  /// Adaptive sieve size for long runs: upper bound the
+  /// sieve size may grow to (0 = disabled). The sieve size
+  /// is stepped up at power-of-ten boundaries guided by the
+  /// measured segment throughput, see updateSieveSize()
+  uint64_t adaptiveMaxSieveSize_ = 0;
+  /// Next power-of-ten boundary where a sieve
+  /// size step is probed
+  uint64_t probeBoundary_ = ~0ull;
+  uint64_t probeBytes_ = 0;
+  uint64_t prevSieveSize_ = 0;
+  double probeSeconds_ = 0.0;
+  double baselineRate_ = 0.0;
+  int probeSegments_ = 0;
+  enum { PROBE_IDLE, PROBE_BASELINE, PROBE_TRIAL };
+  int probeState_ = PROBE_IDLE;
+  /// Optional cancellation flag, checked once
+  /// per segment in sieveSegment()
+  const std::atomic<bool>* cancel_ = nullptr;
   std::unique_ptr<byte_t[]> deleter_;
   EratSmall eratSmall_;
   EratMedium eratMedium_;
   EratBig eratBig_;
-  static uint64_t byteRemainder(uint64_t);
   void initSieve(uint64_t);
   void initErat();
+  void updateSieveSize();
   void preSieve();
   void crossOff();
   void sieveLastSegment();
@@ -78,7 +147,18 @@ private:
 ///
 inline uint64_t Erat::nextPrime(uint64_t* bits, uint64_t low)
 {
-  // calculate bitValues_[bitScanForward(*bits)]
+#if defined(__GNUC__) || \
+    defined(__clang__)
+  // TZCNT (or BSF) + BLSR, faster than the De Bruijn
+  // bitscan on all modern CPUs and avoids the 64-entry
+  // lookup table
+  uint64_t bit = (uint64_t) __builtin_ctzll(*bits);
+  uint64_t bitValue = (bit >> 3) * 30 + bitValues_[bit & 7];
+  uint64_t prime = low + bitValue;
+  *bits &= *bits - 1;
+  return prime;
+#else
+  // calculate bitValues[bitScanForward(*bits)]
   // using a custom De Bruijn bitscan
   uint64_t debruijn = 0x3F08A4C6ACB9DBDull;
   uint64_t mask = *bits - 1;
@@ -86,6 +166,7 @@ inline uint64_t Erat::nextPrime(uint64_t* bits, uint64_t low)
   uint64_t prime = low + bitValue;
   *bits &= mask;
   return prime;
+#endif
 }
 
 inline void Erat::addSievingPrime(uint64_t prime)
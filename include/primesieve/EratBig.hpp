@@ -11,6 +11,7 @@
 #define ERATBIG_HPP
 
 #include "Bucket.hpp"
+#include "BucketArena.hpp"
 #include "Wheel.hpp"
 #include "types.hpp"
 
@@ -27,21 +28,30 @@ namespace primesieve {
 class EratBig : public Wheel210_t
 {
 public:
-  void init(uint64_t, uint64_t, uint64_t);
+  ~EratBig();
+  void init(uint64_t, uint64_t, uint64_t, uint64_t, uint64_t);
+  void resize(uint64_t);
   void crossOff(byte_t*);
   bool enabled() const { return enabled_; }
 private:
+  uint64_t minPrime_;
   uint64_t maxPrime_;
+  /// Sieving interval size (stop - start)
+  uint64_t dist_;
   uint64_t log2SieveSize_;
   uint64_t moduloSieveSize_;
+  /// Number of buckets of the next allocation
+  uint64_t allocSize_;
   /// Vector of bucket lists, holds the sieving primes
   std::vector<Bucket*> lists_;
   /// List of empty buckets
   Bucket* stock_;
-  /// Pointers of the allocated buckets
-  std::vector<std::unique_ptr<Bucket[]>> memory_;
+  /// Bucket chunks acquired from the BucketArena
+  std::vector<BucketArena::Chunk> memory_;
   bool enabled_ = false;
   void init(uint64_t);
+  void allocBuckets(uint64_t);
+  void releaseMemory();
   void pushBucket(uint64_t);
   void storeSievingPrime(uint64_t, uint64_t, uint64_t);
   void crossOff(byte_t*, SievingPrime*, SievingPrime*);
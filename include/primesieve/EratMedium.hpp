@@ -21,9 +21,12 @@ namespace primesieve {
 
 /// EratMedium is an implementation of the segmented sieve
 /// of Eratosthenes optimized for medium sieving primes that
-/// have a few multiples per segment
+/// have a few multiples per segment. The sieving primes are
+/// grouped by their wheel residue class (prime % 30), each
+/// group is crossed-off by a specialized kernel with a
+/// hardcoded bitmask/stride sequence
 ///
-class EratMedium : public Wheel210_t
+class EratMedium : public Wheel30_t
 {
 public:
   void init(uint64_t, uint64_t, uint64_t);
@@ -31,9 +34,18 @@ public:
   bool enabled() const { return enabled_; }
 private:
   uint64_t maxPrime_;
-  std::vector<SievingPrime> primes_;
+  /// 1 vector of sieving primes per residue class
+  std::vector<SievingPrime> primes_[8];
   bool enabled_ = false;
   void storeSievingPrime(uint64_t, uint64_t, uint64_t);
+  void crossOff_7 (byte_t*, uint64_t, std::vector<SievingPrime>&);
+  void crossOff_11(byte_t*, uint64_t, std::vector<SievingPrime>&);
+  void crossOff_13(byte_t*, uint64_t, std::vector<SievingPrime>&);
+  void crossOff_17(byte_t*, uint64_t, std::vector<SievingPrime>&);
+  void crossOff_19(byte_t*, uint64_t, std::vector<SievingPrime>&);
+  void crossOff_23(byte_t*, uint64_t, std::vector<SievingPrime>&);
+  void crossOff_29(byte_t*, uint64_t, std::vector<SievingPrime>&);
+  void crossOff_1 (byte_t*, uint64_t, std::vector<SievingPrime>&);
 };
 
 } // namespace
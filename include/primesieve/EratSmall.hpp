@@ -29,6 +29,8 @@ public:
   static uint64_t getL1Size(uint64_t);
   void init(uint64_t, uint64_t, uint64_t);
   void crossOff(byte_t*, uint64_t);
+  void crossOff(byte_t*, byte_t*);
+  uint64_t getL1Size() const { return l1Size_; }
   bool enabled() const { return enabled_; }
 private:
   uint64_t maxPrime_;
@@ -36,7 +38,6 @@ private:
   std::vector<SievingPrime> primes_;
   bool enabled_ = false;
   void storeSievingPrime(uint64_t, uint64_t, uint64_t);
-  void crossOff(byte_t*, byte_t*);
 };
 
 } // namespace
@@ -0,0 +1,122 @@
+///
+/// @file   GapStreamReader.hpp
+/// @brief  Decoder for the delta encoded varint prime stream
+///         written by primesieve --binary=2 (PRINT_VARINT).
+///         Shipping the decoder with the library keeps producers
+///         and consumers of the stream on the same codec.
+///
+///         Stream format: each prime is stored as the varint
+///         (LEB128, 7 bits per byte, high bit = continuation)
+///         encoded gap to its predecessor. Every 2^16 primes a
+///         sync point is emitted: a 0x00 marker byte followed by
+///         the absolute prime as a varint. Since prime gaps are
+///         >= 1 and the encoding has no trailing zero bytes, a
+///         0x00 byte can only be a marker, so a reader can start
+///         at any byte offset and scan forward to the next sync
+///         point, see sync().
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#ifndef GAPSTREAMREADER_HPP
+#define GAPSTREAMREADER_HPP
+
+#include "primesieve_error.hpp"
+
+#include <stdint.h>
+#include <cstddef>
+#include <cstring>
+
+namespace primesieve {
+
+/// Decodes a buffer containing the varint prime
+/// stream back to absolute primes
+///
+class GapStreamReader
+{
+public:
+  GapStreamReader(const void* stream, std::size_t size) :
+    pos_((const unsigned char*) stream),
+    end_(pos_ + size)
+  { }
+
+  /// Decode up to n primes into the primes array.
+  /// @return  Number of primes decoded, 0 means
+  ///          the end of the stream was reached.
+  ///
+  std::size_t read(uint64_t* primes, std::size_t n)
+  {
+    std::size_t i = 0;
+
+    while (i < n && pos_ < end_)
+    {
+      if (*pos_ == 0)
+      {
+        // sync point: 0x00 marker + absolute prime
+        pos_++;
+        prime_ = decodeVarint();
+      }
+      else
+        prime_ += decodeVarint();
+
+      primes[i++] = prime_;
+    }
+
+    return i;
+  }
+
+  /// Scan forward to the next sync point. After starting
+  /// in the middle of a stream (e.g. after seeking into a
+  /// large file) this must be called once before read(),
+  /// decoding resumes at the sync point's absolute prime.
+  /// @return  false if the stream contains no further
+  ///          sync point.
+  ///
+  bool sync()
+  {
+    const void* marker = std::memchr(pos_, 0, end_ - pos_);
+
+    if (!marker)
+    {
+      pos_ = end_;
+      return false;
+    }
+
+    pos_ = (const unsigned char*) marker;
+    return true;
+  }
+
+  bool atEnd() const
+  {
+    return pos_ >= end_;
+  }
+
+private:
+  const unsigned char* pos_;
+  const unsigned char* end_;
+  uint64_t prime_ = 0;
+
+  uint64_t decodeVarint()
+  {
+    uint64_t value = 0;
+    int shift = 0;
+
+    while (pos_ < end_)
+    {
+      unsigned char byte = *pos_++;
+      value |= (uint64_t) (byte & 0x7f) << shift;
+      if (byte < 0x80)
+        return value;
+      shift += 7;
+    }
+
+    throw primesieve_error("GapStreamReader: truncated varint stream");
+  }
+};
+
+} // namespace
+
+#endif
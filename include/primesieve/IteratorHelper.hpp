@@ -17,15 +17,31 @@ namespace primesieve {
 class IteratorHelper
 {
 public:
+  /// @param totalPrimes    Number of primes the caller has
+  ///                        consumed so far, used to size the
+  ///                        next window. 0 = unknown, use the
+  ///                        fixed growth schedule.
+  /// @param maxCacheBytes  Per iterator cache limit,
+  ///                        0 = config::MAX_CACHE_ITERATOR.
+  ///
   static void next(uint64_t* start,
                    uint64_t* stop,
                    uint64_t stopHint,
-                   uint64_t* dist);
+                   uint64_t* dist,
+                   uint64_t totalPrimes = 0,
+                   uint64_t maxCacheBytes = 0);
 
+  /// @param minCacheBytes  Per iterator cache minimum,
+  ///                        0 = config::MIN_CACHE_ITERATOR.
+  /// @param maxCacheBytes  Per iterator cache limit,
+  ///                        0 = config::MAX_CACHE_ITERATOR.
+  ///
   static void prev(uint64_t* start,
                    uint64_t* stop,
                    uint64_t stopHint,
-                   uint64_t* dist);
+                   uint64_t* dist,
+                   uint64_t minCacheBytes = 0,
+                   uint64_t maxCacheBytes = 0);
 };
 
 } // namespace
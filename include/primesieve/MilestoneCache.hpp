@@ -0,0 +1,64 @@
+///
+/// @file   MilestoneCache.hpp
+/// @brief  Optional on-disk cache of exact (x, pi(x)) pairs
+///         that is consulted by count_primes(). Services which
+///         repeatedly count the primes <= X for a slowly
+///         growing X re-sieve the whole range [0, X] on every
+///         call; with the milestone cache enabled (by setting
+///         the PRIMESIEVE_MILESTONES environment variable to a
+///         file path) count_primes(0, X) loads the largest
+///         milestone x <= X and sieves only [x + 1, X], then
+///         records (X, pi(X)) as a new milestone for the next
+///         call.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#ifndef MILESTONECACHE_HPP
+#define MILESTONECACHE_HPP
+
+#include <stdint.h>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace primesieve {
+
+class MilestoneCache
+{
+public:
+  /// Find the largest milestone x <= stop. Returns false
+  /// if the cache is disabled or has no such milestone.
+  bool lookup(uint64_t stop, uint64_t& x, uint64_t& count);
+
+  /// Record pi(x) = count and persist the milestone file.
+  /// No-op if the cache is disabled.
+  void store(uint64_t x, uint64_t count);
+
+  // Singleton
+  static MilestoneCache& getInstance();
+
+private:
+  struct Milestone
+  {
+    uint64_t x;
+    /// Count of primes <= x
+    uint64_t count;
+  };
+
+  bool enabled_ = false;
+  bool initialized_ = false;
+  std::string path_;
+  /// Sorted by x in ascending order
+  std::vector<Milestone> milestones_;
+  std::mutex lock_;
+  void init();
+  void write();
+};
+
+} // namespace
+
+#endif
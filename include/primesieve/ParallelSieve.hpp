@@ -14,13 +14,26 @@
 
 #include "PrimeSieve.hpp"
 #include <stdint.h>
-#include <mutex>
+#include <atomic>
+#include <memory>
+#include <vector>
 
 namespace primesieve {
 
 class ParallelSieve : public PrimeSieve
 {
 public:
+  enum { MAX_STATUS_THREADS = 64 };
+
+  /// Progress counter of one sieving thread, padded to a
+  /// full cache line so the writer threads do not false
+  /// share when the counters live in shared memory
+  struct PaddedCounter
+  {
+    std::atomic<uint64_t> processed;
+    char pad[64 - sizeof(std::atomic<uint64_t>)];
+  };
+
   /// Used for inter-process communication with the
   /// primesieve GUI application.
   struct SharedMemory
@@ -33,22 +46,74 @@ public:
     int flags;
     int sieveSize;
     int threads;
+    /// Number of sieving threads publishing their progress
+    /// in processed[], 0 if sieving runs single-threaded
+    int statusThreads;
+    /// Distance sieved by each thread, updated once per
+    /// sieved segment with a relaxed store. The GUI samples
+    /// these directly and computes the progress percentage
+    /// itself at any rate, the sieving process never
+    /// formats or throttles progress output.
+    PaddedCounter processed[MAX_STATUS_THREADS];
   };
   ParallelSieve();
   virtual ~ParallelSieve() { }
   void init(SharedMemory&);
   static int getMaxThreads();
+  static int getDefaultNumThreads();
   int getNumThreads() const;
   int idealNumThreads() const;
   void setNumThreads(int numThreads);
+  void setCpuAffinity(const std::vector<int>& cpus);
+  /// Wall time of each sieving thread's last sieve() run,
+  /// empty if sieving ran single-threaded
+  const std::vector<double>& getThreadSeconds() const;
   using PrimeSieve::sieve;
   virtual void sieve();
+  /// Chunk distance primesieve would use for sieving
+  /// [getStart(), getStop()] with the given thread count,
+  /// used by split_range() to expose primesieve's chunking
+  /// to external schedulers
+  uint64_t getThreadDistance(int) const;
+  /// Align n to modulo (30 + 2) to prevent prime k-tuplet
+  /// (twin primes, prime triplets) gaps across chunks
+  uint64_t align(uint64_t) const;
+  /// Claim the next chunk [chunkLow, chunkHigh] of
+  /// [getStart(), getStop()] from the shared cursor,
+  /// thread-safe, also used by ChunkedSieve
+  bool getWork(std::atomic<uint64_t>&, int, uint64_t*, uint64_t*) const;
 private:
-  std::mutex lock_;
+  /// Per-thread sieving state, padded to a full cache line
+  /// so the worker threads do not false share: during
+  /// sieving each thread writes only to its own slot, the
+  /// slots are merged into counts_ once at the end
+  struct ThreadSlot
+  {
+    std::atomic<uint64_t> processed;
+    counts_t counts;
+    double seconds;
+    char pad[64 - (sizeof(std::atomic<uint64_t>) +
+                   sizeof(counts_t) +
+                   sizeof(double)) % 64];
+  };
   SharedMemory* shm_;
   int numThreads_;
-  uint64_t getThreadDistance(int) const;
-  uint64_t align(uint64_t) const;
+  /// 1 padded slot per sieving thread
+  std::unique_ptr<ThreadSlot[]> threadSlots_;
+  /// CPU cores the sieving threads are pinned to,
+  /// empty means no pinning, see setCpuAffinity()
+  std::vector<int> cpuAffinity_;
+  /// Per-thread wall times of the last sieve() run
+  std::vector<double> threadSeconds_;
+  int statusThreads_ = 0;
+  /// Sum of the counters at the last status print
+  uint64_t aggregatedProcessed_ = 0;
+  /// Processed distance reported via method arguments
+  /// (single-threaded sieving has no counter)
+  uint64_t extraProcessed_ = 0;
+  /// Serializes status printing without blocking,
+  /// threads that fail to acquire it keep sieving
+  std::atomic_flag statusLock_ = ATOMIC_FLAG_INIT;
   virtual bool updateStatus(uint64_t, bool);
 };
 
@@ -0,0 +1,87 @@
+///
+/// @file   PiTable.hpp
+/// @brief  Lookup table of the primes below 2^16 together with
+///         a prime counting index. Tiny count, nth prime and
+///         generation requests are answered directly from this
+///         table in microseconds, initializing the segmented
+///         sieving machinery dominates the runtime of such
+///         requests. The table is generated lazily on first
+///         use and kept for the lifetime of the process.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#ifndef PITABLE_HPP
+#define PITABLE_HPP
+
+#include <stdint.h>
+#include <algorithm>
+#include <array>
+#include <vector>
+
+namespace primesieve {
+
+class PiTable
+{
+public:
+  /// The table covers the numbers < limit()
+  static uint64_t limit()
+  {
+    return 1 << 16;
+  }
+
+  /// Count the primes <= n
+  /// @pre n < limit()
+  ///
+  uint64_t pi(uint64_t n) const;
+
+  /// Count the primes within [start, stop]
+  /// @pre stop < limit()
+  ///
+  uint64_t countPrimes(uint64_t start, uint64_t stop) const;
+
+  /// Get the nth prime
+  /// @pre 1 <= n <= size()
+  ///
+  uint64_t nthPrime(uint64_t n) const
+  {
+    return primes_[n - 1];
+  }
+
+  /// Number of primes < limit()
+  uint64_t size() const
+  {
+    return primes_.size();
+  }
+
+  /// Append the primes within [start, stop] to the primes
+  /// vector. The primes are stored using the vector's value
+  /// type, all primes < limit() fit into uint16_t.
+  ///
+  template <typename T>
+  void fillPrimes(T& primes, uint64_t start, uint64_t stop) const
+  {
+    auto p = std::lower_bound(primes_.begin(), primes_.end(), start);
+
+    for (; p != primes_.end() && *p <= stop; ++p)
+      primes.push_back((typename T::value_type) *p);
+  }
+
+  // Singleton
+  static const PiTable& getInstance();
+
+private:
+  PiTable();
+  /// Bitmap of the odd primes, bit i corresponds to 2i+1
+  std::array<uint64_t, 512> bits_;
+  /// Number of odd primes below each bitmap word
+  std::array<uint32_t, 512> counts_;
+  std::vector<uint16_t> primes_;
+};
+
+} // namespace
+
+#endif
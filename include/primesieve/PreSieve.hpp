@@ -13,7 +13,7 @@
 #include "types.hpp"
 
 #include <stdint.h>
-#include <memory>
+#include <array>
 
 namespace primesieve {
 
@@ -36,19 +36,39 @@ namespace primesieve {
 /// - PreSieve multiples of primes <= 19 uses  315.75 kilobytes
 /// - PreSieve multiples of primes <= 23 uses    7.09 megabytes
 ///
+/// For large sieve intervals the primes in ]19, 53] are
+/// additionally pre-sieved using small per-tier buffers
+/// ({23, 29}, {31, 37}, {41, 43} and {47, 53}) which are
+/// combined into the sieve array using a bitwise AND. This
+/// raises the effective pre-sieve limit to 53 while the tier
+/// buffers (667 to 2491 bytes) easily fit into the L1 cache.
+///
+/// The pre-sieved buffers are immutable once generated, they
+/// are hence generated only once per process and shared by
+/// all PreSieve objects. Workloads that sieve many intervals
+/// back to back (e.g. reusing one PrimeSieve object) thereby
+/// skip the buffer generation after the first sieving run.
+///
 class PreSieve
 {
 public:
   PreSieve(uint64_t start, uint64_t stop);
+  ~PreSieve();
   uint64_t getMaxPrime() const { return maxPrime_; }
   void copy(byte_t*, uint64_t, uint64_t) const;
+  /// Free the cached pre-sieved buffers, noop
+  /// while any PreSieve object is alive
+  static void trim();
 private:
   uint64_t maxPrime_;
   uint64_t primeProduct_;
   uint64_t size_;
-  byte_t* buffer_;
-  std::unique_ptr<byte_t[]> deleter_;
+  const byte_t* buffer_;
+  std::array<const byte_t*, 4> tierBuffers_ = { { nullptr, nullptr, nullptr, nullptr } };
+  std::array<uint64_t, 4> tierSizes_ = { { 0, 0, 0, 0 } };
   void init();
+  void initTiers();
+  void copyTier(byte_t*, uint64_t, uint64_t, uint64_t) const;
 };
 
 } // namespace
@@ -16,12 +16,16 @@
 #define PRIMEGENERATOR_HPP
 
 #include "Erat.hpp"
+#include "PiTable.hpp"
+#include "pmath.hpp"
 #include "PreSieve.hpp"
 #include "littleendian_cast.hpp"
 #include "SievingPrimes.hpp"
 
 #include <stdint.h>
 #include <array>
+#include <cstddef>
+#include <functional>
 #include <vector>
 
 namespace primesieve {
@@ -29,8 +33,48 @@ namespace primesieve {
 class PrimeGenerator : public Erat
 {
 public:
+  /// Invoked once per sieved segment with a pointer to the
+  /// primes decoded from that segment (zero-copy)
+  using batch_callback = std::function<void(const uint64_t*, std::size_t)>;
+
+  /// Invoked once per matching prime k-tuplet with the
+  /// tuplet's start value (its smallest member)
+  using tuplet_callback = std::function<void(uint64_t)>;
+
+  /// Invoked once per sieved segment with the segment's raw
+  /// sieve bytes and the segment's low number (zero-copy)
+  using segment_callback = std::function<void(const uint8_t*, std::size_t, uint64_t)>;
+
   PrimeGenerator(uint64_t start, uint64_t stop);
-  void fill(std::vector<uint64_t>&);
+  void fillTwins(std::vector<uint64_t>&);
+  void forEachTuplet(int k, const tuplet_callback& callback);
+  void forEachBatch(const batch_callback& callback);
+  void forEachSegment(const segment_callback& callback);
+
+  /// Store the primes inside [start, stop] in the primes
+  /// vector. The primes are written using the vector's
+  /// value type, e.g. a uint32_t vector stores native
+  /// 32-bit primes without a 64-bit intermediate (the
+  /// caller must ensure stop fits the value type).
+  ///
+  template <typename T>
+  void fill(T& primes)
+  {
+    using V = typename T::value_type;
+
+    while (sieveSegment(primes))
+    {
+      for (; sieveIdx_ < sieveSize_; sieveIdx_++)
+      {
+        // decode all primes of the current
+        // sieve byte in batch
+        for (const uint8_t* v = byteBitValues_[sieve_[sieveIdx_]].data(); *v; v++)
+          primes.push_back((V) (low_ + *v));
+
+        low_ += 30;
+      }
+    }
+  }
 
   bool finished() const
   {
@@ -42,22 +86,33 @@ public:
     return smallPrimes.back();
   }
 
-  void fill(std::vector<uint64_t>& primes,
+  /// Store up to 64 primes in the caller's buffer (which
+  /// must hold at least 64 primes). The buffer may live
+  /// inside a C struct, primesieve_iterator's refill path
+  /// uses it to fill the user-visible array directly
+  /// without a vector indirection.
+  ///
+  void fill(uint64_t* primes,
             std::size_t* size)
   {
     if (sieveIdx_ >= sieveSize_)
       if (!sieveSegment(primes, size))
         return;
 
+    // decode the primes of the next 8 sieve
+    // bytes (max 64 primes) in batch
     std::size_t i = 0;
-    uint64_t bits = littleendian_cast<uint64_t>(&sieve_[sieveIdx_]);
-    sieveIdx_ += 8;
+    uint64_t stopIdx = sieveIdx_ + 8;
+
+    for (; sieveIdx_ < stopIdx; sieveIdx_++)
+    {
+      for (const uint8_t* v = byteBitValues_[sieve_[sieveIdx_]].data(); *v; v++)
+        primes[i++] = low_ + *v;
 
-    for (; bits != 0; i++)
-      primes[i] = nextPrime(&bits, low_);
+      low_ += 30;
+    }
 
     *size = i;
-    low_ += 8 * 30;
   }
 private:
   uint64_t low_ = 0;
@@ -69,14 +124,58 @@ private:
   bool finished_ = false;
   static const std::array<uint64_t, 64> smallPrimes;
   static const std::array<uint8_t, 312> primePi;
+  static const std::array<std::array<uint8_t, 9>, 256> byteBitValues_;
+  static const std::array<std::array<uint8_t, 4>, 256> byteTwinValues_;
   std::size_t getStartIdx() const;
   std::size_t getStopIdx() const;
   void init();
-  void init(std::vector<uint64_t>&);
-  void init(std::vector<uint64_t>&, std::size_t*);
-  bool sieveSegment(std::vector<uint64_t>&);
-  bool sieveSegment(std::vector<uint64_t>&, std::size_t*);
+  void init(uint64_t*, std::size_t*);
+  bool sieveSegment(uint64_t*, std::size_t*);
   void sieveSegment();
+
+  template <typename T>
+  void init(T& primes)
+  {
+    using V = typename T::value_type;
+
+    // generate the primes < 2^16 from the lookup
+    // table, without sieving
+    if (stop_ < PiTable::limit())
+    {
+      PiTable::getInstance().fillPrimes(primes, start_, stop_);
+      // hasNextSegment() returns false,
+      // no segment will be sieved
+      isInit_ = true;
+      return;
+    }
+
+    std::size_t size = primeCountApprox(start_, stop_);
+    primes.reserve(size);
+
+    if (start_ <= smallPrimes.back())
+    {
+      std::size_t a = getStartIdx();
+      std::size_t b = getStopIdx();
+
+      for (std::size_t i = a; i < b; i++)
+        primes.push_back((V) smallPrimes[i]);
+    }
+
+    init();
+  }
+
+  template <typename T>
+  bool sieveSegment(T& primes)
+  {
+    if (!isInit_)
+      init(primes);
+
+    if (!hasNextSegment())
+      return false;
+
+    sieveSegment();
+    return true;
+  }
 };
 
 } // namespace
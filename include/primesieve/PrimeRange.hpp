@@ -0,0 +1,139 @@
+///
+/// @file   PrimeRange.hpp
+/// @brief  Lazy prime range for use with STL algorithms and
+///         range-based for loops. The primes are generated on
+///         the fly in segments using primesieve::iterator, whose
+///         internal buffer is reused for the whole iteration,
+///         no allocation happens per increment.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#ifndef PRIMERANGE_HPP
+#define PRIMERANGE_HPP
+
+#include "iterator.hpp"
+
+#include <stdint.h>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+
+namespace primesieve {
+
+/// A lazy range of the primes within [start, stop],
+/// created using prime_range()
+///
+class PrimeRange
+{
+public:
+  PrimeRange(uint64_t start, uint64_t stop) :
+    start_(start),
+    stop_(stop)
+  { }
+
+  /// Single pass input iterator, copies share the
+  /// underlying prime generator
+  ///
+  class iterator
+  {
+  public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = uint64_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const uint64_t*;
+    using reference = const uint64_t&;
+
+    /// End iterator
+    iterator() = default;
+
+    iterator(uint64_t start, uint64_t stop) :
+      stop_(stop)
+    {
+      // primesieve::iterator generates primes > start
+      if (start > 0)
+        start--;
+      if (~stop_ == 0)
+        stop_--;
+
+      it_ = std::make_shared<primesieve::iterator>(start, stop_);
+      ++(*this);
+    }
+
+    uint64_t operator*() const
+    {
+      return prime_;
+    }
+
+    iterator& operator++()
+    {
+      prime_ = it_->next_prime();
+
+      // past the last prime this iterator
+      // compares equal to the end iterator
+      if (prime_ > stop_)
+        it_.reset();
+
+      return *this;
+    }
+
+    iterator operator++(int)
+    {
+      iterator tmp = *this;
+      ++(*this);
+      return tmp;
+    }
+
+    bool operator==(const iterator& other) const
+    {
+      return it_ == other.it_;
+    }
+
+    bool operator!=(const iterator& other) const
+    {
+      return !(*this == other);
+    }
+
+  private:
+    std::shared_ptr<primesieve::iterator> it_;
+    uint64_t prime_ = 0;
+    uint64_t stop_ = 0;
+  };
+
+  iterator begin() const
+  {
+    return iterator(start_, stop_);
+  }
+
+  iterator end() const
+  {
+    return iterator();
+  }
+
+private:
+  uint64_t start_;
+  uint64_t stop_;
+};
+
+/// Get a lazy range of the primes within [start, stop]
+/// for use with STL algorithms and range-based for
+/// loops, e.g.:
+/// for (uint64_t prime : prime_range(100, 200)) { ... }
+///
+inline PrimeRange prime_range(uint64_t start, uint64_t stop)
+{
+  return PrimeRange(start, stop);
+}
+
+/// Get a lazy range of the primes <= stop
+inline PrimeRange prime_range(uint64_t stop)
+{
+  return PrimeRange(0, stop);
+}
+
+} // namespace
+
+#endif
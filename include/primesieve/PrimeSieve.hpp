@@ -15,6 +15,8 @@
 
 #include <stdint.h>
 #include <array>
+#include <atomic>
+#include <chrono>
 
 namespace primesieve {
 
@@ -35,7 +37,11 @@ enum
   PRINT_QUINTUPLETS = 1 << 10,
   PRINT_SEXTUPLETS  = 1 << 11,
   PRINT_STATUS      = 1 << 12,
-  CALCULATE_STATUS  = 1 << 13
+  CALCULATE_STATUS  = 1 << 13,
+  /// Print primes as raw little-endian uint64
+  PRINT_BINARY      = 1 << 14,
+  /// Print primes as delta encoded varints
+  PRINT_VARINT      = 1 << 15
 };
 
 class PrimeSieve
@@ -47,16 +53,23 @@ public:
   // Getters
   uint64_t getStart() const;
   uint64_t getStop() const;
+  uint64_t getCountStop() const;
+  uint64_t getHistogramWidth() const;
   int getSieveSize() const;
   double getStatus() const;
   double getSeconds() const;
   // Setters
   void setStart(uint64_t);
   void setStop(uint64_t);
+  void setCountStop(uint64_t);
+  void setHistogramWidth(uint64_t);
   void setSieveSize(int);
   void setFlags(int);
   void addFlags(int);
   // Bool is*
+  /// true if the sieve size is primesieve's cache-derived
+  /// default, false once setSieveSize() has been called
+  bool isDefaultSieveSize() const;
   bool isCount(int) const;
   bool isCountPrimes() const;
   bool isCountkTuplets() const;
@@ -67,6 +80,10 @@ public:
   bool isFlag(int) const;
   bool isFlag(int, int) const;
   bool isStatus() const;
+  // Cancellation
+  void cancel();
+  bool isCanceled() const;
+  const std::atomic<bool>* getCancelFlag() const;
   // Sieve
   virtual void sieve();
   void sieve(uint64_t, uint64_t);
@@ -78,12 +95,23 @@ public:
   counts_t& getCounts();
   uint64_t getCount(int) const;
   uint64_t countPrimes(uint64_t, uint64_t);
+  uint64_t getRunningCount() const;
+  void addRunningCount(uint64_t);
   virtual bool updateStatus(uint64_t, bool tryLock = true);
+  void setStatusCounter(std::atomic<uint64_t>*);
 protected:
   /// Sieve primes >= start_
   uint64_t start_;
   /// Sieve primes <= stop_
   uint64_t stop_;
+  /// Count only numbers <= min(countStop_, stop_). Numbers
+  /// in ]countStop_, stop_] are sieved so that prime
+  /// k-tuplets spanning a thread chunk boundary can be
+  /// counted, but are excluded from the counts themselves.
+  uint64_t countStop_ = ~0ull;
+  /// Histogram interval width, 0 = disabled,
+  /// see setHistogramWidth()
+  uint64_t histogramWidth_ = 0;
   /// Prime number and prime k-tuplet counts
   counts_t counts_;
   /// Time elapsed of sieve()
@@ -95,15 +123,33 @@ private:
   uint64_t processed_;
   /// Sum of processed segments to update
   uint64_t toUpdate_;
+  /// This thread's padded progress counter,
+  /// assigned by ParallelSieve
+  std::atomic<uint64_t>* statusCounter_ = nullptr;
+  /// Number of primes found so far, updated once per
+  /// sieved segment. Worker threads add into their
+  /// parent's counter.
+  std::atomic<uint64_t> runningCount_ = { 0 };
   /// Status of sieve() in percent
   double percent_;
+  /// Exponentially weighted sieving throughput
+  /// in numbers per second
+  double ewmaRate_;
+  /// processed_ at the last throughput update
+  uint64_t lastProcessed_;
+  std::chrono::steady_clock::time_point lastStatusTime_;
   /// Sieve size in kilobytes
   int sieveSize_;
+  /// false once setSieveSize() has been called
+  bool defaultSieveSize_ = true;
   /// Setter methods set flags e.g. COUNT_PRIMES
   int flags_;
   /// parent ParallelSieve object
   PrimeSieve* parent_;
-  static void printStatus(double, double);
+  /// Set by cancel(), checked at segment boundaries.
+  /// Worker threads check their parent's flag.
+  std::atomic<bool> canceled_ = { false };
+  void printStatus(double, double) const;
   bool isParallelSieve() const;
   void processSmallPrimes();
 };
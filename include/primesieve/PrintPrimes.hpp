@@ -35,17 +35,45 @@ private:
   enum { END = 0xff + 1 };
   static const uint64_t bitmasks_[6][5];
   uint64_t low_ = 0;
-  /// Count lookup tables for prime k-tuplets
-  std::vector<byte_t> kCounts_[6];
+  /// Previous prime printed in binary varint mode
+  uint64_t prevPrime_ = 0;
+  /// Primes printed in binary varint mode, a sync
+  /// point is emitted every 2^16 primes
+  uint64_t varintCount_ = 0;
+  /// Histogram interval width, 0 = disabled,
+  /// see PrimeSieve::setHistogramWidth()
+  uint64_t histWidth_ = 0;
+  /// Start of the current histogram interval
+  uint64_t histLow_ = 0;
+  /// Primes counted in the current histogram interval
+  uint64_t histCount_ = 0;
+  /// Count only numbers <= countStop_, numbers beyond are
+  /// sieved so prime k-tuplets spanning a thread chunk
+  /// boundary can be counted, see PrimeSieve::setCountStop()
+  uint64_t countStop_ = 0;
+  /// Primes counted via processBlock() while the segment
+  /// was still being sieved (cache resident blocks)
+  uint64_t pipeCount_ = 0;
+  /// Leading sieve bytes already counted via processBlock(),
+  /// countPrimes() only counts the bytes beyond
+  uint64_t pipeBytes_ = 0;
+  /// Count lookup table for prime k-tuplets, the per byte
+  /// counts of all 5 k-tuplet types are packed into one
+  /// 64-bit entry (10 bits per type)
+  std::vector<uint64_t> kCounts_;
   /// Reference to the associated PrimeSieve object
   PreSieve preSieve_;
   counts_t& counts_;
   PrimeSieve& ps_;
   void initCounts();
   void print();
+  void processBlock(uint64_t, uint64_t);
   void countPrimes();
+  void countHistogram();
+  void printHistogramInterval();
   void countkTuplets();
   void printPrimes() const;
+  void printBinaryPrimes();
   void printkTuplets() const;
 };
 
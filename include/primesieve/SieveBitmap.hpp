@@ -0,0 +1,82 @@
+///
+/// @file   SieveBitmap.hpp
+/// @brief  On-disk sieve bitmap files. SieveBitmap::write()
+///         sieves [start, stop] once and persists the raw
+///         sieve bit array (8 flags per 30 numbers, the
+///         modulo 30 layout from bits.hpp) segment by
+///         segment. A SieveBitmap object memory maps such a
+///         file and answers count and generate queries from
+///         the bitmap at memory bandwidth speed instead of
+///         re-sieving. Useful for bands like
+///         [1e15, 1e15 + 1e12] that are analyzed repeatedly.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#ifndef SIEVEBITMAP_HPP
+#define SIEVEBITMAP_HPP
+
+#include "types.hpp"
+
+#include <stdint.h>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace primesieve {
+
+class SieveBitmap
+{
+public:
+  /// Sieve [start, stop] and write the
+  /// bitmap file to path
+  static void write(const std::string& path,
+                    uint64_t start,
+                    uint64_t stop);
+
+  /// Memory map the bitmap file at path, throws a
+  /// primesieve_error if the file is missing or corrupt
+  explicit SieveBitmap(const std::string& path);
+  ~SieveBitmap();
+
+  uint64_t getStart() const { return start_; }
+  uint64_t getStop() const { return stop_; }
+
+  /// Count the primes within [start, stop] using the
+  /// bitmap, [start, stop] must be inside the file's range
+  uint64_t countPrimes(uint64_t start, uint64_t stop) const;
+
+  /// Invoke the callback for each prime within
+  /// [start, stop] in ascending order
+  void forEachPrime(uint64_t start,
+                    uint64_t stop,
+                    const std::function<void(uint64_t)>& callback) const;
+
+  /// Find the nth prime > start using a sampled rank
+  /// index over the bitmap, throws a primesieve_error
+  /// if the nth prime is outside the file's range
+  uint64_t nthPrime(uint64_t n, uint64_t start);
+
+private:
+  uint64_t start_ = 0;
+  uint64_t stop_ = 0;
+  uint64_t low_ = 0;
+  uint64_t bytes_ = 0;
+  const byte_t* bits_ = nullptr;
+  byte_t* buffer_ = nullptr;
+  void* mapAddr_ = nullptr;
+  std::size_t mapSize_ = 0;
+  /// Cumulative prime counts at sample boundaries,
+  /// built lazily by the first nthPrime() query
+  std::vector<uint64_t> rankIndex_;
+  void checkRange(uint64_t start, uint64_t stop) const;
+  void initRankIndex();
+};
+
+} // namespace
+
+#endif
@@ -37,6 +37,7 @@ private:
   void fill();
   void tinySieve();
   bool sieveSegment();
+  void copyCachedSegment(const byte_t*);
 };
 
 inline uint64_t SievingPrimes::next()
@@ -0,0 +1,102 @@
+///
+/// @file   SievingPrimesCache.hpp
+/// @brief  Cache of the sieve of Eratosthenes bit array
+///         (8 flags per 30 numbers) from which SievingPrimes
+///         copies its segments instead of sieving them. The
+///         cache has two sources: an optional on-disk cache
+///         file (memory mapped when the PRIMESIEVE_CACHE
+///         environment variable is set to a file path) and an
+///         in-memory bitmap that ParallelSieve generates using
+///         all threads before launching its workers. Both cut
+///         the startup latency of sieves with a large stop,
+///         e.g. [1e18, 1e18 + 1e10], where generating the
+///         sieving primes up to sqrt(stop) from scratch takes
+///         seconds per PrimeSieve instance.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#ifndef SIEVINGPRIMESCACHE_HPP
+#define SIEVINGPRIMESCACHE_HPP
+
+#include "types.hpp"
+
+#include <stdint.h>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace primesieve {
+
+class SievingPrimesCache
+{
+public:
+  /// Returns the cached sieve bit array if the cache
+  /// covers the numbers <= n, else nullptr. Byte i of
+  /// the bit array covers the numbers [i * 30, i * 30 + 30[.
+  ///
+  const byte_t* coveringBits(uint64_t n) const
+  {
+    if (bits_ && n <= limit_)
+      return bits_;
+
+    const Bitmap* bitmap = shared_.load(std::memory_order_acquire);
+    if (bitmap && n <= bitmap->limit)
+      return &bitmap->bits[0];
+
+    return nullptr;
+  }
+
+  /// Lazily loads (and if missing generates) the cache
+  /// file on first use. Generating the cache file itself
+  /// uses SievingPrimes, init() detects this recursion
+  /// and returns without the cache being available.
+  ///
+  void init();
+
+  /// Generate the shared in-memory bitmap up to limit
+  /// using multiple threads, see SievingPrimesCache.cpp.
+  ///
+  void preGenerate(uint64_t limit, int threads);
+
+  ~SievingPrimesCache();
+
+  // Singleton
+  static SievingPrimesCache& getInstance();
+
+private:
+  struct Bitmap
+  {
+    uint64_t limit = 0;
+    std::vector<byte_t> bits;
+  };
+
+  byte_t* bits_ = nullptr;
+  uint64_t limit_ = 0;
+  void* mapAddr_ = nullptr;
+  std::size_t mapSize_ = 0;
+  std::atomic<bool> ready_{false};
+  /// Set while the cache file is generated, the
+  /// generating sieve threads run uncached
+  std::atomic<bool> initializing_{false};
+  std::mutex initLock_;
+  /// In-memory bitmap generated by preGenerate()
+  std::atomic<const Bitmap*> shared_{nullptr};
+  /// Owns all generated bitmaps. A superseded bitmap is
+  /// kept alive because a concurrent reader may still
+  /// hold a pointer into it.
+  std::vector<std::unique_ptr<const Bitmap>> bitmaps_;
+  std::mutex generateLock_;
+  void generate(const std::string& path, uint64_t limit);
+  bool load(const std::string& path);
+};
+
+} // namespace
+
+#endif
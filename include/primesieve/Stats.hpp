@@ -0,0 +1,105 @@
+///
+/// @file   Stats.hpp
+/// @brief  Optional phase-level performance instrumentation.
+///         Compile with -DENABLE_STATS to activate it, without
+///         the flag all hooks compile to nothing. The console
+///         binary prints the collected data as JSON via --stats.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#ifndef STATS_HPP
+#define STATS_HPP
+
+#include <stdint.h>
+#include <string>
+
+namespace primesieve {
+namespace stats {
+
+/// Timed sieving phases, these match the
+/// phase functions in Erat and PrintPrimes
+///
+enum Phase
+{
+  PRE_SIEVE,
+  ERAT_SMALL,
+  ERAT_MEDIUM,
+  ERAT_BIG,
+  COUNT,
+  PHASES
+};
+
+enum Counter
+{
+  SEGMENTS,
+  BUCKET_ALLOCS,
+  BUCKETS,
+  COUNTERS
+};
+
+/// Hardware events measured per phase using
+/// perf_event_open(), Linux only
+///
+enum PerfEvent
+{
+  CYCLES,
+  INSTRUCTIONS,
+  LLC_MISSES,
+  DTLB_MISSES,
+  PERF_EVENTS
+};
+
+#if defined(ENABLE_STATS)
+
+/// Instrumentation is compiled in
+const bool enabled = true;
+
+void addNanos(Phase phase, uint64_t nanos);
+void inc(Counter counter, uint64_t count = 1);
+void reset();
+
+/// JSON report of all phase timings and counters
+std::string getJson();
+
+/// Adds the elapsed time of its scope to phase.
+/// On Linux the hardware events of the scope are
+/// also measured using perf_event_open().
+///
+class Timer
+{
+public:
+  Timer(Phase phase);
+  ~Timer();
+private:
+  Phase phase_;
+  uint64_t start_;
+#if defined(__linux__)
+  uint64_t perf_[PERF_EVENTS];
+#endif
+};
+
+#else
+
+const bool enabled = false;
+
+inline void addNanos(Phase, uint64_t) { }
+inline void inc(Counter, uint64_t = 1) { }
+inline void reset() { }
+inline std::string getJson() { return "{}"; }
+
+class Timer
+{
+public:
+  Timer(Phase) { }
+};
+
+#endif
+
+} // namespace stats
+} // namespace primesieve
+
+#endif
@@ -11,17 +11,23 @@
 #ifndef STOREPRIMES_HPP
 #define STOREPRIMES_HPP
 
+#include "config.hpp"
 #include "iterator.hpp"
 #include "primesieve_error.hpp"
+#include "ThreadPool.hpp"
 
 #include <stdint.h>
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <future>
 #include <vector>
 
 namespace primesieve {
 
+uint64_t count_primes(uint64_t start, uint64_t stop);
+int get_num_threads();
+
 /// primeCountApprox(x) >= pi(x)
 inline std::size_t prime_count_approx(uint64_t start, uint64_t stop)
 {
@@ -62,6 +68,75 @@ inline void store_primes(uint64_t start,
   }
 }
 
+/// Multi-threaded version of store_primes().
+/// The sieving range is split into subranges, the primes of
+/// each subrange are counted exactly, the container is resized
+/// once and the worker threads store their primes directly
+/// into disjoint slices of the container. T must provide
+/// thread-safe random access to distinct elements, e.g.
+/// std::vector (but not std::vector<bool>).
+///
+template <typename T>
+inline void store_primes_parallel(uint64_t start,
+                                  uint64_t stop,
+                                  T& primes)
+{
+  uint64_t dist = (start < stop) ? stop - start : 0;
+  uint64_t maxThreads = dist / config::MIN_THREAD_DISTANCE;
+  int threads = (int) std::min((uint64_t) get_num_threads(), maxThreads);
+
+  if (threads < 2)
+  {
+    store_primes(start, stop, primes);
+    return;
+  }
+
+  if (start > 0)
+    start--;
+  if (~stop == 0)
+    stop--;
+
+  // subrange i covers ]bounds[i], bounds[i + 1]]
+  std::vector<uint64_t> bounds(threads + 1);
+  std::vector<std::size_t> offsets(threads + 1);
+  bounds[0] = start;
+  bounds[threads] = stop;
+  dist = stop - start;
+
+  for (int i = 1; i < threads; i++)
+    bounds[i] = start + (dist / threads) * i;
+
+  // count each subrange exactly (multi-threaded),
+  // the counts yield the slice offsets
+  offsets[0] = primes.size();
+  for (int i = 0; i < threads; i++)
+    offsets[i + 1] = offsets[i] + (std::size_t) count_primes(bounds[i] + 1, bounds[i + 1]);
+
+  using V = typename T::value_type;
+  primes.resize(offsets[threads]);
+
+  ThreadPool& threadPool = ThreadPool::getInstance();
+  std::vector<std::future<void>> futures;
+  futures.reserve(threads);
+
+  for (int i = 0; i < threads; i++)
+  {
+    futures.emplace_back(
+      threadPool.submit([&primes, &bounds, &offsets, i]()
+      {
+        uint64_t stop = bounds[i + 1];
+        std::size_t j = offsets[i];
+        primesieve::iterator it(bounds[i], stop);
+        uint64_t prime = it.next_prime();
+        for (; prime <= stop; prime = it.next_prime())
+          primes[j++] = (V) prime;
+      }));
+  }
+
+  for (auto& future : futures)
+    future.wait();
+}
+
 template <typename T>
 inline void store_n_primes(uint64_t n,
                            uint64_t start,
@@ -91,6 +166,70 @@ inline void store_n_primes(uint64_t n,
     throw primesieve_error("cannot generate primes > 2^64");
 }
 
+/// Multi-threaded version of store_n_primes().
+/// The nth prime is bracketed by counting: the initial
+/// distance guess is extended until the bracket contains
+/// at least n primes, then the bracket is filled using
+/// store_primes_parallel() and the surplus primes at the
+/// tail are trimmed off. T must provide thread-safe random
+/// access to distinct elements, e.g. std::vector (but not
+/// std::vector<bool>).
+///
+template <typename T>
+inline void store_n_primes_parallel(uint64_t n,
+                                    uint64_t start,
+                                    T& primes)
+{
+  if (n == 0)
+    return;
+
+  // overestimate the distance of the nth prime > start,
+  // p(n) < n * (log n + log log n) for n >= 6
+  double x = std::max(10.0, (double) start + (double) n);
+  uint64_t logx = (uint64_t) std::log(x);
+  uint64_t dist = n * (logx + 2);
+  uint64_t stop = start + dist;
+  uint64_t maxStop = ~0ull - 1;
+
+  if (stop < start)
+    stop = maxStop;
+
+  uint64_t maxThreads = dist / config::MIN_THREAD_DISTANCE;
+  int threads = (int) std::min((uint64_t) get_num_threads(), maxThreads);
+
+  if (threads < 2)
+  {
+    store_n_primes(n, start, primes);
+    return;
+  }
+
+  // extend the bracket until it contains >= n primes
+  uint64_t count = count_primes(start, stop);
+
+  while (count < n)
+  {
+    if (stop >= maxStop)
+      throw primesieve_error("cannot generate primes > 2^64");
+
+    uint64_t low = stop + 1;
+    uint64_t remaining = n - count;
+    uint64_t logLow = (uint64_t) std::log((double) low);
+    stop = low + remaining * (logLow + 2);
+
+    if (stop < low ||
+        stop > maxStop)
+      stop = maxStop;
+
+    count += count_primes(low, stop);
+  }
+
+  std::size_t size = primes.size();
+  store_primes_parallel(start, stop, primes);
+
+  // trim the surplus primes at the tail
+  primes.resize(size + (std::size_t) n);
+}
+
 } // namespace
 
 #endif
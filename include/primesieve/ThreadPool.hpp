@@ -0,0 +1,54 @@
+///
+/// @file   ThreadPool.hpp
+/// @brief  Persistent thread pool used by ParallelSieve. The
+///         worker threads are created lazily on first use and
+///         are reused by subsequent sieve() invocations, this
+///         avoids the thread creation and teardown overhead
+///         when sieving many medium ranges back to back.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#ifndef THREADPOOL_HPP
+#define THREADPOOL_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace primesieve {
+
+class ThreadPool
+{
+public:
+  ~ThreadPool();
+
+  /// Submit a task for asynchronous execution.
+  /// The worker threads are started on first use.
+  ///
+  std::future<void> submit(std::function<void()> task);
+
+  /// Singleton, shared by all ParallelSieve objects
+  static ThreadPool& getInstance();
+
+private:
+  std::vector<std::thread> threads_;
+  std::deque<std::packaged_task<void()>> tasks_;
+  std::mutex lock_;
+  std::condition_variable pending_;
+  bool stop_ = false;
+  void startThreads();
+  void workerLoop(std::size_t);
+};
+
+} // namespace
+
+#endif
@@ -13,6 +13,7 @@
 #define WHEEL_HPP
 
 #include "config.hpp"
+#include "pmath.hpp"
 #include "primesieve_error.hpp"
 #include "Bucket.hpp"
 #include "types.hpp"
@@ -75,8 +76,9 @@ public:
   {
     assert(segmentLow % 30 == 0);
     segmentLow += 6;
-    // calculate the first multiple (of prime) > segmentLow
-    uint64_t quotient = (segmentLow / prime) + 1;
+    // calculate the first multiple (of prime) > segmentLow,
+    // fastDiv avoids the slow integer division instruction
+    uint64_t quotient = fastDiv(segmentLow, prime) + 1;
     quotient = std::max(prime, quotient);
     uint64_t multiple = prime * quotient;
     // prime not needed for sieving
@@ -36,6 +36,13 @@ enum {
   ///
   BYTES_PER_ALLOC = (1 << 20) * 8,
 
+  /// EratBig's allocation size grows geometrically with each
+  /// refill (starting from BYTES_PER_ALLOC) up to
+  /// MAX_BYTES_PER_ALLOC, this reduces the number of
+  /// allocations for very large stop numbers.
+  ///
+  MAX_BYTES_PER_ALLOC = (1 << 20) * 512,
+
   /// primesieve::iterator caches at least MIN_CACHE_ITERATOR
   /// bytes of primes. Larger is usually faster but also
   /// requires more memory.
@@ -0,0 +1,72 @@
+///
+/// @file   cpuid.hpp
+/// @brief  Runtime detection of x86 SIMD instruction sets using
+///         __builtin_cpu_supports(). On other architectures and
+///         compilers all queries return false and the callers use
+///         their portable fallback code.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#ifndef CPUID_HPP
+#define CPUID_HPP
+
+// __builtin_cpu_supports("avx512f") requires GCC >= 6
+#if (defined(__x86_64__) || defined(__i386__)) && \
+     defined(__GNUC__) && __GNUC__ >= 6 && \
+    !defined(__clang__)
+  #define HAS_CPU_SUPPORTS
+#elif (defined(__x86_64__) || defined(__i386__)) && \
+       defined(__clang__) && defined(__has_builtin)
+  #if __has_builtin(__builtin_cpu_supports)
+    #define HAS_CPU_SUPPORTS
+  #endif
+#endif
+
+// The "avx512vpopcntdq" feature string requires GCC >= 7
+#if defined(HAS_CPU_SUPPORTS) && \
+    defined(__GNUC__) && __GNUC__ >= 7 && \
+   !defined(__clang__)
+  #define HAS_CPU_SUPPORTS_VPOPCNT
+#endif
+
+namespace primesieve {
+
+inline bool hasAVX2()
+{
+#if defined(HAS_CPU_SUPPORTS)
+  static const bool avx2 = __builtin_cpu_supports("avx2");
+  return avx2;
+#else
+  return false;
+#endif
+}
+
+inline bool hasAVX512()
+{
+#if defined(HAS_CPU_SUPPORTS)
+  static const bool avx512 = __builtin_cpu_supports("avx512f") &&
+                             __builtin_cpu_supports("avx512bw");
+  return avx512;
+#else
+  return false;
+#endif
+}
+
+inline bool hasAVX512VPOPCNT()
+{
+#if defined(HAS_CPU_SUPPORTS_VPOPCNT)
+  static const bool vpopcnt = __builtin_cpu_supports("avx512f") &&
+                              __builtin_cpu_supports("avx512vpopcntdq");
+  return vpopcnt;
+#else
+  return false;
+#endif
+}
+
+} // namespace
+
+#endif
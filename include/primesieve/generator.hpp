@@ -0,0 +1,207 @@
+///
+/// @file   generator.hpp
+/// @brief  Resumable C++20 coroutine generator of the primes
+///         within [start, stop], created using prime_generator().
+///         The producer coroutine sieves one window of primes
+///         per resumption and suspends, the consumer side walks
+///         the current batch without resuming, so the coroutine
+///         resumption overhead is amortized across thousands of
+///         primes instead of being paid per prime. A suspended
+///         generator holds only its batch buffer (a few
+///         megabytes at most), async servers can hence multiplex
+///         hundreds of concurrent prime streams over a small
+///         executor pool with bounded memory.
+///
+///         This header is self-contained: without C++20
+///         coroutine support (__cpp_impl_coroutine) it expands
+///         to nothing and the rest of libprimesieve remains
+///         usable from C++11.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#ifndef PRIMESIEVE_GENERATOR_HPP
+#define PRIMESIEVE_GENERATOR_HPP
+
+#if defined(__cpp_impl_coroutine) && \
+    defined(__has_include)
+  #if __has_include(<coroutine>)
+    #define PRIMESIEVE_HAS_GENERATOR
+  #endif
+#endif
+
+#if defined(PRIMESIEVE_HAS_GENERATOR)
+
+#include "primesieve_error.hpp"
+#include "StorePrimes.hpp"
+
+#include <stdint.h>
+#include <algorithm>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <utility>
+#include <vector>
+
+namespace primesieve {
+
+/// A resumable generator of the primes within [start, stop].
+/// next() returns the primes in ascending order from an
+/// internal batch that is refilled by resuming the producer
+/// coroutine only when the batch is exhausted.
+///
+class generator
+{
+public:
+  struct promise_type
+  {
+    /// Current batch of primes, owned by the
+    /// producer coroutine's frame
+    const uint64_t* batch = nullptr;
+    std::size_t size = 0;
+    std::exception_ptr exception;
+
+    generator get_return_object()
+    {
+      using handle = std::coroutine_handle<promise_type>;
+      return generator(handle::from_promise(*this));
+    }
+
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    std::suspend_always final_suspend() noexcept { return {}; }
+
+    std::suspend_always yield_value(
+        std::pair<const uint64_t*, std::size_t> primes) noexcept
+    {
+      batch = primes.first;
+      size = primes.second;
+      return {};
+    }
+
+    /// Clear the batch so that an exhausted generator
+    /// does not serve stale primes from the last batch
+    void return_void() noexcept
+    {
+      batch = nullptr;
+      size = 0;
+    }
+
+    void unhandled_exception()
+    {
+      exception = std::current_exception();
+    }
+  };
+
+  generator(generator&& other) noexcept :
+    coroutine_(std::exchange(other.coroutine_, nullptr)),
+    index_(other.index_)
+  { }
+
+  generator& operator=(generator&& other) noexcept
+  {
+    if (this != &other)
+    {
+      if (coroutine_)
+        coroutine_.destroy();
+      coroutine_ = std::exchange(other.coroutine_, nullptr);
+      index_ = other.index_;
+    }
+    return *this;
+  }
+
+  generator(const generator&) = delete;
+  generator& operator=(const generator&) = delete;
+
+  ~generator()
+  {
+    if (coroutine_)
+      coroutine_.destroy();
+  }
+
+  /// Get the next prime, returns false when there are
+  /// no primes left in [start, stop]. The producer
+  /// coroutine is resumed only when the current batch
+  /// is exhausted.
+  ///
+  bool next(uint64_t& prime)
+  {
+    auto& promise = coroutine_.promise();
+
+    while (index_ >= promise.size)
+    {
+      if (coroutine_.done())
+        return false;
+
+      coroutine_.resume();
+      index_ = 0;
+
+      if (promise.exception)
+        std::rethrow_exception(promise.exception);
+      if (coroutine_.done())
+        return false;
+    }
+
+    prime = promise.batch[index_++];
+    return true;
+  }
+
+private:
+  explicit generator(std::coroutine_handle<promise_type> coroutine) :
+    coroutine_(coroutine)
+  { }
+
+  std::coroutine_handle<promise_type> coroutine_;
+  std::size_t index_ = 0;
+};
+
+/// Get a resumable generator of the primes within
+/// [start, stop], e.g.:
+/// auto gen = prime_generator(100, 200);
+/// uint64_t prime;
+/// while (gen.next(prime)) { ... }
+///
+inline generator prime_generator(uint64_t start, uint64_t stop)
+{
+  std::vector<uint64_t> primes;
+  uint64_t low = start;
+  // window (in numbers) sieved per resumption, grows
+  // towards the cap like primesieve::iterator's window so
+  // that short streams stay cheap while long streams
+  // amortize the sieving primes generation. The cap
+  // bounds the batch buffer to a few megabytes.
+  uint64_t dist = 100000;
+  uint64_t maxDist = 10000000;
+
+  while (low <= stop)
+  {
+    uint64_t high = (stop - low < dist)
+        ? stop : low + (dist - 1);
+
+    primes.clear();
+    store_primes(low, high, primes);
+
+    if (!primes.empty())
+      co_yield std::make_pair(primes.data(), primes.size());
+
+    if (high >= stop)
+      break;
+
+    low = high + 1;
+    dist = std::min(dist * 4, maxDist);
+  }
+}
+
+/// Get a resumable generator of the primes <= stop
+inline generator prime_generator(uint64_t stop)
+{
+  return prime_generator(0, stop);
+}
+
+} // namespace
+
+#endif
+
+#endif
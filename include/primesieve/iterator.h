@@ -46,6 +46,22 @@ typedef struct
   void* vector;
   void* primeGenerator;
   int is_error;
+  /**
+   * New fields are only ever appended below so the offsets
+   * of the primesieve 7.0 fields above never change. The
+   * struct is caller-allocated, hence growing it still
+   * requires an SOVERSION bump.
+   */
+  uint64_t min_cache_bytes;
+  uint64_t max_cache_bytes;
+  /**
+   * Fixed buffer for the primesieve_next_prime() refill
+   * path, filled directly by the sieve (at most 64 primes
+   * per refill). primes points here while iterating
+   * forward, FFI consumers can read it without any
+   * heap indirection.
+   */
+  uint64_t buffer[64];
 } primesieve_iterator;
 
 /** Initialize the primesieve iterator before first using it */
@@ -64,12 +80,32 @@ void primesieve_free_iterator(primesieve_iterator* it);
  */
 void primesieve_skipto(primesieve_iterator* it, uint64_t start, uint64_t stop_hint);
 
+/**
+ * Set this iterator's cache size policy in bytes. The iterator
+ * caches at least min_bytes and at most max_bytes of primes,
+ * 0 keeps the compile time default. Use small limits when many
+ * iterators live in one process and large limits for a single
+ * bulk iterator.
+ */
+void primesieve_set_cache_size(primesieve_iterator* it, uint64_t min_bytes, uint64_t max_bytes);
+
 /** Internal use */
 void primesieve_generate_next_primes(primesieve_iterator*);
 
 /** Internal use */
 void primesieve_generate_prev_primes(primesieve_iterator*);
 
+/**
+ * Store the next n primes in the primes array. The unconsumed
+ * primes of each internal block are copied in one go, which
+ * amortizes the per-call overhead of primesieve_next_prime()
+ * across hundreds of primes. Returns the number of primes
+ * stored, which is less than n only if the missing primes
+ * would be > 2^64 or if an error occurred (check
+ * primesieve_iterator.is_error and errno).
+ */
+size_t primesieve_next_primes(primesieve_iterator* it, uint64_t* primes, size_t n);
+
 /**
  * Get the next prime.
  * Returns UINT64_MAX if next prime > 2^64.
@@ -13,12 +13,15 @@
 #define PRIMESIEVE_ITERATOR_HPP
 
 #include <stdint.h>
+#include <algorithm>
 #include <cstddef>
+#include <cstring>
 #include <vector>
 #include <memory>
 
 namespace primesieve {
 
+class AsyncPrefetcher;
 class PrimeGenerator;
 
 uint64_t get_max_stop();
@@ -38,8 +41,23 @@ public:
   ///                   speed up if few primes are generated. E.g. if
   ///                   you want to generate the primes below 1000 use
   ///                   stop_hint = 1000.
+  /// @param prefetch   Sieve the next block of primes on a
+  ///                   background thread while the caller iterates
+  ///                   over the current block, next_prime() then
+  ///                   never blocks on sieving. Uses one additional
+  ///                   thread and twice the memory.
+  /// @param compact    Store each block of primes as 16-bit gaps
+  ///                   between consecutive primes and decode them
+  ///                   into a small reused window on the fly. Cuts
+  ///                   the iterator's memory usage about 4x at a
+  ///                   small speed cost, useful when many iterator
+  ///                   objects live in one process. Takes
+  ///                   precedence over prefetch.
   ///
-  iterator(uint64_t start = 0, uint64_t stop_hint = get_max_stop());
+  iterator(uint64_t start = 0,
+           uint64_t stop_hint = get_max_stop(),
+           bool prefetch = false,
+           bool compact = false);
 
   /// Reset the primesieve iterator to start.
   /// @param start      Generate primes > start (or < start).
@@ -50,6 +68,15 @@ public:
   ///
   void skipto(uint64_t start, uint64_t stop_hint = get_max_stop());
 
+  /// Set this iterator's cache size policy in bytes. The
+  /// iterator caches at least min_bytes and at most max_bytes
+  /// of primes, 0 keeps the compile time default
+  /// (config::MIN_CACHE_ITERATOR, config::MAX_CACHE_ITERATOR).
+  /// Use small limits when many iterators live in one process
+  /// and large limits for a single bulk iterator.
+  ///
+  void set_cache_size(uint64_t min_bytes, uint64_t max_bytes);
+
   /// Get the next prime.
   /// Returns UINT64_MAX if next prime > 2^64.
   ///
@@ -60,6 +87,39 @@ public:
     return primes_[i_];
   }
 
+  /// Store the next n primes in the primes array. The
+  /// unconsumed primes of each internal block are copied in
+  /// one go, which amortizes the per-call overhead of
+  /// next_prime() across hundreds of primes.
+  /// @return The number of primes stored, less than n only
+  ///         if the missing primes would be > 2^64.
+  ///
+  std::size_t next_primes(uint64_t* primes, std::size_t n)
+  {
+    std::size_t count = 0;
+
+    while (count < n)
+    {
+      if (i_ == last_idx_)
+        generate_next_primes();
+      else
+        i_++;
+
+      // copy the unconsumed primes of the current block
+      std::size_t copy = std::min(last_idx_ - i_ + 1, n - count);
+      std::memcpy(&primes[count], &primes_[i_], copy * sizeof(uint64_t));
+      i_ += copy - 1;
+      count += copy;
+
+      // UINT64_MAX is not a prime, it marks
+      // the end of the primes < 2^64
+      if (primes[count - 1] == ~0ull)
+        return count - 1;
+    }
+
+    return count;
+  }
+
   /// Get the previous prime.
   /// prev_prime(n) = 0 if n <= 2.
   ///
@@ -79,9 +139,60 @@ private:
   uint64_t stop_;
   uint64_t stop_hint_;
   uint64_t dist_;
+  bool prefetch_ = false;
+  bool compact_ = false;
+  /// Gap-encoded block of primes (compact mode)
+  std::vector<uint16_t> gaps_;
+  std::size_t gapIdx_ = 0;
+  /// First prime of the gap-encoded block
+  uint64_t gapBase_ = 0;
+  /// Last prime decoded from gaps_
+  uint64_t runningValue_ = 0;
+  /// Sieving start of the gap-encoded block
+  uint64_t gapStart_ = 0;
+  /// Last prime of the gap-encoded block
+  uint64_t gapLast_ = 0;
+  /// Absolute prime values sampled every 1024 gap
+  /// entries, skipto() into the block binary searches
+  /// the samples and decodes only the residual window
+  std::vector<uint64_t> gapSamples_;
+  /// Gap-encoded block kept across skipto() calls
+  std::vector<uint16_t> cacheGaps_;
+  std::vector<uint64_t> cacheGapSamples_;
+  uint64_t cacheGapStart_ = 0;
+  uint64_t cacheGapStop_ = 0;
+  uint64_t cacheGapBase_ = 0;
+  uint64_t cacheGapLast_ = 0;
+  /// Adjacent sieved window kept across direction flips
+  std::vector<uint64_t> cachePrimes_;
+  uint64_t cacheStart_ = 0;
+  uint64_t cacheStop_ = 0;
+  /// First prime above the cached window
+  uint64_t cacheNextPrime_ = 0;
+  /// primes_ holds a fully sieved window
+  bool haveWindow_ = false;
+  /// Primes consumed so far, used to size the next window
+  uint64_t consumedPrimes_ = 0;
+  /// Per instance cache limits in bytes,
+  /// 0 = use the config.hpp defaults
+  uint64_t minCacheBytes_ = 0;
+  uint64_t maxCacheBytes_ = 0;
+  /// Raw sieve bitmap of the backward window (compact
+  /// mode), prev_prime() decodes it high-to-low in
+  /// chunks instead of materializing the full window
+  std::vector<uint64_t> prevBitmap_;
+  /// Number corresponding to bit 0 of prevBitmap_
+  uint64_t prevLow_ = 0;
+  /// Words >= prevWordIdx_ have already been decoded
+  std::size_t prevWordIdx_ = 0;
   std::unique_ptr<PrimeGenerator> primeGenerator_;
+  std::unique_ptr<AsyncPrefetcher> prefetcher_;
   void generate_next_primes();
   void generate_prev_primes();
+  void generate_next_gaps();
+  void decode_next_primes();
+  void sieve_prev_bitmap();
+  void decode_prev_chunk();
 };
 
 } // namespace
@@ -25,14 +25,16 @@ template <typename T>
 class malloc_vector
 {
 public:
+  /// No upfront allocation: the generate paths reserve()
+  /// the approximate prime count before the first
+  /// push_back(), so the reserve is the one and only
+  /// growing allocation.
   malloc_vector()
     : array_(0),
       size_(0),
       capacity_(0),
       is_free_(true)
-  {
-    resize(16);
-  }
+  { }
 
   malloc_vector(std::size_t n)
     : array_(0),
@@ -51,9 +53,9 @@ public:
 
   void push_back(const T& val)
   {
-    array_[size_++] = val;
     if (size_ >= capacity_)
-      resize(size_ * 2);
+      resize(std::max(capacity_ * 2, (std::size_t) 16));
+    array_[size_++] = val;
   }
 
   void reserve(std::size_t n)
@@ -75,6 +77,28 @@ public:
     size_ = std::min(size_, capacity_);
   }
 
+  /// Release the excess capacity of the approximate
+  /// upfront reserve, the array is reallocated down to
+  /// exactly size() elements (at least 1 so that an empty
+  /// result still returns a non-NULL array). If realloc
+  /// fails the old (larger) array is kept.
+  ///
+  void shrink_to_fit()
+  {
+    std::size_t n = std::max(size_, (std::size_t) 1);
+
+    if (n != capacity_)
+    {
+      T* new_array = (T*) realloc((void*) array_, n * sizeof(T));
+
+      if (new_array)
+      {
+        array_ = new_array;
+        capacity_ = n;
+      }
+    }
+  }
+
   T& operator[] (T n)
   {
     return array_[n];
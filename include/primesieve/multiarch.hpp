@@ -0,0 +1,38 @@
+///
+/// @file   multiarch.hpp
+/// @brief  The PRIMESIEVE_MULTIARCH macro expands to GCC's
+///         target_clones attribute when primesieve is built with
+///         BUILD_MULTIARCH=ON. Functions annotated with it are
+///         compiled once per listed instruction set and the best
+///         version is selected at load time (ifunc), so a single
+///         binary runs the AVX2 code path on CPUs that support it
+///         without requiring -march=native at build time. The SIMD
+///         kernels in popcount.cpp and PreSieve.cpp already select
+///         their AVX-512/AVX2 variants at runtime via cpuid.hpp,
+///         this macro covers the remaining auto-vectorizable
+///         kernels.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#ifndef MULTIARCH_HPP
+#define MULTIARCH_HPP
+
+// target_clones requires ifunc support (x86 ELF targets) and
+// GCC >= 6. Clang's target_clones (>= 7) does not reliably
+// support C++ member functions, hence GCC only.
+#if defined(ENABLE_MULTIARCH) && \
+    defined(__x86_64__) && \
+    defined(__ELF__) && \
+    defined(__GNUC__) && __GNUC__ >= 6 && \
+   !defined(__clang__)
+  #define PRIMESIEVE_MULTIARCH \
+    __attribute__ ((target_clones ("avx2", "default")))
+#else
+  #define PRIMESIEVE_MULTIARCH
+#endif
+
+#endif
@@ -121,6 +121,32 @@ inline T isqrt(T x)
   return r;
 }
 
+/// Fast floor division x / y (y > 0) using a double
+/// precision reciprocal approximation with an exact
+/// integer fixup, avoids the slow 64-bit integer
+/// division instruction.
+///
+inline uint64_t fastDiv(uint64_t x, uint64_t y)
+{
+  // for y = 1 the double division may round
+  // up to 2^64 which is not representable
+  if (y == 1)
+    return x;
+
+  uint64_t q = (uint64_t)((double) x / (double) y);
+
+  // the double approximation may be off by a few ulps,
+  // bias downwards so that q * y <= x always holds,
+  // then correct exactly
+  uint64_t bias = (q >> 50) + 2;
+  q -= std::min(q, bias);
+
+  while (x - y * q >= y)
+    q++;
+
+  return q;
+}
+
 /// Returns 2^64-1 if (x + y) > 2^64-1
 inline uint64_t checkedAdd(uint64_t x, uint64_t y)
 {
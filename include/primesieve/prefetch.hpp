@@ -0,0 +1,45 @@
+///
+/// @file   prefetch.hpp
+/// @brief  Portable software prefetch hints. EratBig walks
+///         linked bucket lists whose nodes and sieve targets
+///         are dependent cache misses, prefetching them ahead
+///         of use hides a large part of the miss latency. On
+///         compilers without prefetch support these hints are
+///         a no-op.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#ifndef PREFETCH_HPP
+#define PREFETCH_HPP
+
+namespace primesieve {
+
+/// Prefetch a cache line for reading
+inline void prefetchRead(const void* addr)
+{
+#if defined(__GNUC__) || \
+    defined(__clang__)
+  __builtin_prefetch(addr, 0);
+#else
+  (void) addr;
+#endif
+}
+
+/// Prefetch a cache line for writing
+inline void prefetchWrite(const void* addr)
+{
+#if defined(__GNUC__) || \
+    defined(__clang__)
+  __builtin_prefetch(addr, 1);
+#else
+  (void) addr;
+#endif
+}
+
+} // namespace
+
+#endif
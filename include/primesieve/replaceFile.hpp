@@ -0,0 +1,44 @@
+///
+/// @file   replaceFile.hpp
+/// @brief  Move a freshly written temporary file over its final
+///         path. POSIX rename() atomically replaces an existing
+///         destination, but the Windows CRT rename() fails when
+///         the destination exists, hence Windows uses
+///         MoveFileEx(MOVEFILE_REPLACE_EXISTING) instead.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#ifndef REPLACEFILE_HPP
+#define REPLACEFILE_HPP
+
+#include <string>
+
+#if defined(_WIN32)
+  #include <windows.h>
+#else
+  #include <cstdio>
+#endif
+
+namespace primesieve {
+
+/// Move tmp over path, replacing an existing path.
+/// Returns false if the move failed.
+///
+inline bool replaceFile(const std::string& tmp,
+                        const std::string& path)
+{
+#if defined(_WIN32)
+  return MoveFileExA(tmp.c_str(), path.c_str(),
+      MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+  return std::rename(tmp.c_str(), path.c_str()) == 0;
+#endif
+}
+
+} // namespace
+
+#endif
@@ -0,0 +1,53 @@
+///
+/// @file   tracepoints.hpp
+/// @brief  Optional USDT static tracepoints for production
+///         observability. Compile with -DENABLE_USDT to activate
+///         them, without the flag (or on OSes without
+///         <sys/sdt.h>) all probes compile to nothing. Armed
+///         probes are a single nop until a tracer attaches, so
+///         the hot path is untouched, e.g.:
+///
+///         bpftrace -e 'usdt:./primesieve:primesieve:segment_begin
+///           { @start[tid] = nsecs; }
+///           usdt:./primesieve:primesieve:segment_end
+///           { @latency = hist(nsecs - @start[tid]); }'
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#ifndef TRACEPOINTS_HPP
+#define TRACEPOINTS_HPP
+
+#if defined(ENABLE_USDT) && \
+    defined(__has_include)
+  #if __has_include(<sys/sdt.h>)
+    #define HAS_SDT
+  #endif
+#endif
+
+#if defined(HAS_SDT)
+
+#include <sys/sdt.h>
+
+#define PRIMESIEVE_PROBE2(name, a1, a2) \
+    DTRACE_PROBE2(primesieve, name, a1, a2)
+
+#define PRIMESIEVE_PROBE3(name, a1, a2, a3) \
+    DTRACE_PROBE3(primesieve, name, a1, a2, a3)
+
+#else
+
+// the arguments are evaluated as (void) so that variables
+// used only by probes do not warn when probes are disabled
+#define PRIMESIEVE_PROBE2(name, a1, a2) \
+    ((void) (a1), (void) (a2))
+
+#define PRIMESIEVE_PROBE3(name, a1, a2, a3) \
+    ((void) (a1), (void) (a2), (void) (a3))
+
+#endif
+
+#endif
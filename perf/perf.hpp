@@ -0,0 +1,211 @@
+///
+/// @file   perf.hpp
+/// @brief  Helpers shared by the performance regression tests.
+///         Each test runs fixed workloads and compares them
+///         against the committed baseline.json: wall times are
+///         normalized by a calibration kernel so the comparison
+///         tolerates machine speed differences, retired
+///         instruction counts (Linux perf_event_open, where
+///         permitted) are compared directly since they are
+///         independent of machine speed. A test fails only on
+///         regression, improvements pass.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#ifndef PERF_HPP
+#define PERF_HPP
+
+#include <stdint.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+  #include <linux/perf_event.h>
+  #include <sys/syscall.h>
+  #include <unistd.h>
+  #include <cstring>
+#endif
+
+/// Seconds since an arbitrary epoch
+inline double getTime()
+{
+  using namespace std::chrono;
+  auto now = steady_clock::now().time_since_epoch();
+  return duration_cast<duration<double>>(now).count();
+}
+
+/// Fixed calibration kernel, ALU and cache bound like
+/// sieving. Workload wall times are divided by the
+/// calibration time, the resulting ratio is comparable
+/// across machines of different speeds.
+///
+inline double calibrate()
+{
+  std::vector<uint64_t> buffer(1 << 15, 0x9e3779b97f4a7c15ull);
+  double t0 = getTime();
+
+  for (int iter = 0; iter < 2000; iter++)
+    for (std::size_t i = 1; i < buffer.size(); i++)
+      buffer[i] ^= (buffer[i - 1] << 7) ^ (buffer[i] >> 3);
+
+  double seconds = getTime() - t0;
+  volatile uint64_t sink = buffer.back();
+  (void) sink;
+  return seconds;
+}
+
+/// Counts the retired instructions of the calling thread.
+/// If perf_event_open() is not permitted (e.g. inside
+/// containers or with kernel.perf_event_paranoid > 2)
+/// read() returns 0 and the instruction checks are skipped.
+///
+class InstructionCounter
+{
+public:
+  InstructionCounter()
+  {
+#if defined(__linux__)
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    fd_ = (int) syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+#endif
+  }
+
+  ~InstructionCounter()
+  {
+#if defined(__linux__)
+    if (fd_ >= 0)
+      close(fd_);
+#endif
+  }
+
+  /// Instructions retired since construction,
+  /// 0 if hardware counters are unavailable
+  uint64_t read() const
+  {
+#if defined(__linux__)
+    uint64_t count;
+    if (fd_ >= 0 &&
+        ::read(fd_, &count, sizeof(count)) == sizeof(count))
+      return count;
+#endif
+    return 0;
+  }
+
+private:
+  int fd_ = -1;
+};
+
+/// true while regenerating baseline.json, the checks
+/// then print JSON entries instead of comparing,
+/// see --record in the README
+///
+inline bool& recordMode()
+{
+  static bool record = false;
+  return record;
+}
+
+inline void check(bool OK)
+{
+  std::cout << "   " << (OK ? "OK" : "ERROR") << "\n";
+  if (!OK)
+    std::exit(1);
+}
+
+/// Parse the baseline file, a flat JSON
+/// object { "name": number, ... }
+///
+inline std::map<std::string, double> loadBaseline(int argc, char* argv[])
+{
+  std::map<std::string, double> baseline;
+
+  if (argc >= 2 &&
+      std::string(argv[1]) == "--record")
+  {
+    recordMode() = true;
+    return baseline;
+  }
+
+  if (argc < 2)
+  {
+    std::cerr << "Usage: " << argv[0] << " baseline.json | --record" << std::endl;
+    std::exit(1);
+  }
+
+  std::ifstream file(argv[1]);
+
+  if (!file)
+  {
+    std::cerr << "Error: cannot open " << argv[1] << std::endl;
+    std::exit(1);
+  }
+
+  std::string line;
+
+  while (std::getline(file, line))
+  {
+    std::size_t open = line.find('"');
+    std::size_t close = line.find('"', open + 1);
+    std::size_t colon = line.find(':', close + 1);
+
+    if (open == std::string::npos ||
+        close == std::string::npos ||
+        colon == std::string::npos)
+      continue;
+
+    std::string name = line.substr(open + 1, close - open - 1);
+    baseline[name] = std::strtod(line.c_str() + colon + 1, nullptr);
+  }
+
+  return baseline;
+}
+
+/// Compare a measurement against its baseline entry, fail
+/// if it exceeds the baseline by more than tolerance.
+/// Measurements without a baseline entry are skipped so
+/// new workloads can be added before their baseline.
+///
+inline void checkPerf(const std::string& name,
+                      double measured,
+                      const std::map<std::string, double>& baseline,
+                      double tolerance)
+{
+  if (recordMode())
+  {
+    std::printf("  \"%s\": %.4e,\n", name.c_str(), measured);
+    return;
+  }
+
+  auto item = baseline.find(name);
+
+  if (item == baseline.end())
+  {
+    std::cout << name << " = " << measured << " (no baseline, skipped)\n";
+    return;
+  }
+
+  double limit = item->second * (1.0 + tolerance);
+  std::cout << name << " = " << measured
+            << " (baseline " << item->second
+            << ", limit " << limit << ")";
+  check(measured <= limit);
+}
+
+#endif
@@ -0,0 +1,60 @@
+///
+/// @file   perf_count.cpp
+/// @brief  Performance regression test: count the primes up to
+///         10^10 single-threaded at pinned sieve sizes. A
+///         refactor that slows EratSmall/EratMedium/EratBig
+///         down by more than the tolerance fails this test
+///         before release.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include "perf.hpp"
+
+#include <primesieve.hpp>
+
+#include <stdint.h>
+#include <iostream>
+#include <string>
+
+int main(int argc, char* argv[])
+{
+  auto baseline = loadBaseline(argc, argv);
+  double calib = calibrate();
+
+  // single-threaded, comparable across machines
+  primesieve::set_num_threads(1);
+
+  for (int sieveSize : { 128, 256 })
+  {
+    primesieve::set_sieve_size(sieveSize);
+    std::string name = "count_1e10_s" + std::to_string(sieveSize);
+
+    InstructionCounter instructions;
+    double t0 = getTime();
+    uint64_t count = primesieve::count_primes(0, (uint64_t) 1e10);
+    double seconds = getTime() - t0;
+    uint64_t instrs = instructions.read();
+
+    if (count != 455052511ull)
+    {
+      std::cout << name << " wrong count: " << count << "   ERROR" << std::endl;
+      return 1;
+    }
+
+    checkPerf(name + ".timeRatio", seconds / calib, baseline, 0.25);
+    if (instrs > 0)
+      checkPerf(name + ".instructions", (double) instrs, baseline, 0.10);
+  }
+
+  if (!recordMode())
+  {
+    std::cout << std::endl;
+    std::cout << "All tests passed successfully!" << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,55 @@
+///
+/// @file   perf_fill.cpp
+/// @brief  Performance regression test: generate 10^8 primes
+///         with primesieve::iterator. This covers the
+///         PrimeGenerator fill path (sieve to prime vector
+///         conversion) which count-only workloads skip.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include "perf.hpp"
+
+#include <primesieve.hpp>
+
+#include <stdint.h>
+#include <iostream>
+
+int main(int argc, char* argv[])
+{
+  auto baseline = loadBaseline(argc, argv);
+  double calib = calibrate();
+
+  InstructionCounter instructions;
+  double t0 = getTime();
+
+  primesieve::iterator it;
+  uint64_t sum = 0;
+  for (uint64_t i = 0; i < 100000000ull; i++)
+    sum += it.next_prime();
+
+  double seconds = getTime() - t0;
+  uint64_t instrs = instructions.read();
+
+  // sum of the first 10^8 primes
+  if (sum != 99262851056183695ull)
+  {
+    std::cout << "fill_1e8 wrong prime sum: " << sum << "   ERROR" << std::endl;
+    return 1;
+  }
+
+  checkPerf("fill_1e8.timeRatio", seconds / calib, baseline, 0.25);
+  if (instrs > 0)
+    checkPerf("fill_1e8.instructions", (double) instrs, baseline, 0.10);
+
+  if (!recordMode())
+  {
+    std::cout << std::endl;
+    std::cout << "All tests passed successfully!" << std::endl;
+  }
+
+  return 0;
+}
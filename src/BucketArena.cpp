@@ -0,0 +1,83 @@
+///
+/// @file   BucketArena.cpp
+/// @brief  Thread-safe arena that recycles the bucket memory of
+///         EratBig across PrimeSieve instances, see
+///         BucketArena.hpp.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve/BucketArena.hpp>
+#include <primesieve/hugepages.hpp>
+#include <primesieve/pmath.hpp>
+
+#include <stdint.h>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+using namespace std;
+
+namespace primesieve {
+
+BucketArena& BucketArena::getInstance()
+{
+  static BucketArena arena;
+  return arena;
+}
+
+BucketArena::Chunk BucketArena::acquire(uint64_t size)
+{
+  // round up to the chunk's size class, repeated runs
+  // with slightly different bucket demands then reuse
+  // the exact same chunks
+  if (!isPow2(size))
+    size = floorPow2(size) * 2;
+
+  {
+    unique_lock<mutex> lock(lock_);
+
+    // reuse the smallest cached chunk with >= size
+    // buckets, the freelists are sorted by size class
+    // so this scans at most SIZE_CLASSES entries
+    for (uint64_t k = ilog2(size); k < SIZE_CLASSES; k++)
+    {
+      if (!freeLists_[k].empty())
+      {
+        Chunk chunk = std::move(freeLists_[k].back());
+        freeLists_[k].pop_back();
+        return chunk;
+      }
+    }
+  }
+
+  Chunk chunk;
+  chunk.buckets.reset(new Bucket[size]);
+  chunk.size = size;
+  adviseHugePages(chunk.buckets.get(), size * sizeof(Bucket));
+
+  return chunk;
+}
+
+void BucketArena::release(Chunk chunk)
+{
+  if (chunk.buckets)
+  {
+    uint64_t k = ilog2(chunk.size);
+    unique_lock<mutex> lock(lock_);
+    freeLists_[k].emplace_back(std::move(chunk));
+  }
+}
+
+void BucketArena::trim()
+{
+  unique_lock<mutex> lock(lock_);
+
+  for (auto& freeList : freeLists_)
+    freeList.clear();
+}
+
+} // namespace
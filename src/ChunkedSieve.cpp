@@ -0,0 +1,98 @@
+///
+/// @file   ChunkedSieve.cpp
+/// @brief  Pull-based parallel sieve driven by an external
+///         threading runtime, reuses ParallelSieve's chunk
+///         sizing and boundary logic.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve/ChunkedSieve.hpp>
+#include <primesieve/ParallelSieve.hpp>
+#include <primesieve/PrimeSieve.hpp>
+#include <primesieve/pmath.hpp>
+#include <primesieve/primesieve_error.hpp>
+
+#include <stdint.h>
+#include <algorithm>
+#include <mutex>
+
+using namespace std;
+
+namespace primesieve {
+
+ChunkedSieve::ChunkedSieve(uint64_t start,
+                           uint64_t stop,
+                           int flags,
+                           int threads) :
+  start_(start),
+  stop_(stop),
+  flags_(flags),
+  threads_(threads),
+  low_(start)
+{
+  if (flags & ~(COUNT_PRIMES | COUNT_TWINS | COUNT_TRIPLETS |
+      COUNT_QUADRUPLETS | COUNT_QUINTUPLETS | COUNT_SEXTUPLETS))
+    throw primesieve_error("ChunkedSieve: only COUNT_* flags are supported");
+
+  if (threads_ < 1)
+    threads_ = ParallelSieve::getDefaultNumThreads();
+
+  counts_.fill(0);
+  parallelSieve_.setStart(start);
+  parallelSieve_.setStop(stop);
+}
+
+bool ChunkedSieve::claimNextChunk(SieveChunk& chunk)
+{
+  uint64_t chunkLow;
+  uint64_t chunkHigh;
+
+  if (start_ > stop_ ||
+      !parallelSieve_.getWork(low_, threads_, &chunkLow, &chunkHigh))
+    return false;
+
+  // the ParallelSieve boundary convention: sieve 16 numbers
+  // past the chunk so that k-tuplets spanning the boundary
+  // are counted by the chunk containing their first prime
+  chunk.start = chunkLow;
+  if (chunkLow > start_)
+    chunk.start += 1;
+
+  chunk.countStop = chunkHigh;
+  chunk.stop = chunkHigh;
+  if (chunkHigh < stop_)
+    chunk.stop = min(checkedAdd(chunkHigh, 16), stop_);
+
+  return true;
+}
+
+void ChunkedSieve::sieveChunk(const SieveChunk& chunk,
+                              counts_t& localCounts) const
+{
+  PrimeSieve ps;
+  ps.setFlags(flags_);
+  ps.setCountStop(chunk.countStop);
+  ps.sieve(chunk.start, chunk.stop);
+
+  for (size_t i = 0; i < localCounts.size(); i++)
+    localCounts[i] += ps.getCounts()[i];
+}
+
+void ChunkedSieve::merge(const counts_t& localCounts)
+{
+  lock_guard<mutex> lock(mergeLock_);
+
+  for (size_t i = 0; i < counts_.size(); i++)
+    counts_[i] += localCounts[i];
+}
+
+uint64_t ChunkedSieve::getCount(int index) const
+{
+  return counts_.at(index);
+}
+
+} // namespace
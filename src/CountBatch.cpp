@@ -0,0 +1,160 @@
+///
+/// @file   CountBatch.cpp
+/// @brief  Count the primes in many scattered intervals while
+///         generating the sieving primes and the pre-sieve
+///         buffers only once. count_primes() rebuilds that
+///         state for every call which dominates the runtime
+///         when counting thousands of small intervals
+///         clustered around the same magnitude.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve.hpp>
+#include <primesieve/Erat.hpp>
+#include <primesieve/PreSieve.hpp>
+#include <primesieve/ThreadPool.hpp>
+#include <primesieve/pmath.hpp>
+#include <primesieve/types.hpp>
+
+#include <stdint.h>
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <numeric>
+#include <vector>
+
+using namespace std;
+using namespace primesieve;
+
+namespace {
+
+/// Counts the primes within [start, stop] using sieving
+/// primes from a shared, precomputed vector instead of
+/// generating them with SievingPrimes per interval
+///
+class BatchCounter : public Erat
+{
+public:
+  uint64_t count(uint64_t start,
+                 uint64_t stop,
+                 const vector<uint64_t>& sievingPrimes,
+                 PreSieve& preSieve)
+  {
+    uint64_t count = 0;
+
+    // primes <= 5 are not sieved
+    for (uint64_t p : { 2ull, 3ull, 5ull })
+      if (p >= start && p <= stop)
+        count++;
+
+    start = max<uint64_t>(start, 7);
+    if (start > stop)
+      return count;
+
+    init(start, stop, get_sieve_size(), preSieve);
+
+    // skip the pre-sieved primes
+    auto prime = upper_bound(sievingPrimes.begin(),
+                             sievingPrimes.end(),
+                             preSieve.getMaxPrime());
+
+    while (hasNextSegment())
+    {
+      uint64_t sqrtHigh = isqrt(segmentHigh_);
+      for (; prime != sievingPrimes.end() && *prime <= sqrtHigh; ++prime)
+        addSievingPrime(*prime);
+
+      sieveSegment();
+      count += popcount((const uint64_t*) sieve_, ceilDiv(sieveSize_, 8));
+    }
+
+    return count;
+  }
+};
+
+} // namespace
+
+namespace primesieve {
+
+vector<uint64_t> count_primes_batch(const Range* ranges, size_t size)
+{
+  vector<uint64_t> counts(size, 0);
+
+  if (size == 0)
+    return counts;
+
+  uint64_t minStart = ~0ull;
+  uint64_t maxStop = 0;
+
+  for (size_t i = 0; i < size; i++)
+  {
+    if (ranges[i].start > ranges[i].stop)
+      continue;
+    minStart = min(minStart, ranges[i].start);
+    maxStop = max(maxStop, ranges[i].stop);
+  }
+
+  if (maxStop == 0)
+    return counts;
+
+  // shared state, generated once for all intervals
+  vector<uint64_t> sievingPrimes;
+  generate_primes(7, isqrt(maxStop), &sievingPrimes);
+  PreSieve preSieve(minStart, maxStop);
+
+  // process the intervals sorted by start, neighboring
+  // intervals then reuse warm sieving prime cache lines
+  vector<size_t> sorted(size);
+  iota(sorted.begin(), sorted.end(), (size_t) 0);
+  sort(sorted.begin(), sorted.end(),
+       [&](size_t a, size_t b) { return ranges[a].start < ranges[b].start; });
+
+  int threads = (int) min((size_t) get_num_threads(), size);
+
+  // Erat objects do not support re-initialization,
+  // each interval gets a fresh BatchCounter
+  auto countRange = [&](size_t i)
+  {
+    if (ranges[i].start <= ranges[i].stop)
+    {
+      BatchCounter counter;
+      counts[i] = counter.count(ranges[i].start, ranges[i].stop, sievingPrimes, preSieve);
+    }
+  };
+
+  if (threads < 2)
+  {
+    for (size_t i : sorted)
+      countRange(i);
+  }
+  else
+  {
+    atomic<size_t> next(0);
+
+    auto task = [&]()
+    {
+      size_t j;
+      while ((j = next.fetch_add(1)) < size)
+        countRange(sorted[j]);
+    };
+
+    ThreadPool& threadPool = ThreadPool::getInstance();
+    vector<future<void>> futures;
+    futures.reserve(threads);
+
+    for (int t = 0; t < threads; t++)
+      futures.emplace_back(threadPool.submit(task));
+
+    for (auto& f : futures)
+      f.get();
+  }
+
+  return counts;
+}
+
+} // namespace
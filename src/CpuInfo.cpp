@@ -38,6 +38,7 @@
 
 #include <fstream>
 #include <sstream>
+#include <vector>
 
 using namespace std;
 
@@ -59,6 +60,29 @@ string getString(const string& filename)
   return str;
 }
 
+/// Parse a Linux cpulist string, e.g. "0-3,8-11"
+vector<size_t> parseCpuList(const string& str)
+{
+  vector<size_t> cpus;
+  stringstream ss(str);
+  string range;
+
+  while (getline(ss, range, ','))
+  {
+    size_t pos = range.find('-');
+    size_t first = stol(range.substr(0, pos));
+    size_t last = first;
+
+    if (pos != string::npos)
+      last = stol(range.substr(pos + 1));
+
+    for (size_t cpu = first; cpu <= last; cpu++)
+      cpus.push_back(cpu);
+  }
+
+  return cpus;
+}
+
 size_t getValue(const string& filename)
 {
   size_t val = 0;
@@ -94,6 +118,7 @@ namespace primesieve {
 CpuInfo::CpuInfo()
   : l1CacheSize_(0),
     l2CacheSize_(0),
+    cpuCores_(0),
     privateL2Cache_(false)
 {
   try
@@ -116,11 +141,53 @@ size_t CpuInfo::l2CacheSize() const
   return l2CacheSize_;
 }
 
+size_t CpuInfo::l1CacheSize(size_t cpu) const
+{
+  if (cpu < l1CacheSizes_.size() &&
+      l1CacheSizes_[cpu] > 0)
+    return l1CacheSizes_[cpu];
+  return l1CacheSize_;
+}
+
+size_t CpuInfo::l2CacheSize(size_t cpu) const
+{
+  if (cpu < l2CacheSizes_.size() &&
+      l2CacheSizes_[cpu] > 0)
+    return l2CacheSizes_[cpu];
+  return l2CacheSize_;
+}
+
+bool CpuInfo::hasAsymmetricCaches() const
+{
+  return asymmetricCaches_;
+}
+
 bool CpuInfo::privateL2Cache() const
 {
   return privateL2Cache_;
 }
 
+size_t CpuInfo::cpuCores() const
+{
+  return cpuCores_;
+}
+
+bool CpuInfo::hasCpuCores() const
+{
+  return cpuCores_ >= 1 &&
+         cpuCores_ <= (1 << 20);
+}
+
+size_t CpuInfo::numaNodes() const
+{
+  return numaNodeCpus_.size();
+}
+
+const vector<size_t>& CpuInfo::numaNodeCpus(size_t node) const
+{
+  return numaNodeCpus_.at(node);
+}
+
 string CpuInfo::getError() const
 {
   return error_;
@@ -148,6 +215,9 @@ void CpuInfo::init()
   sysctlbyname("hw.l1dcachesize", &l1CacheSize_, &l1Length, NULL, 0);
   sysctlbyname("hw.l2cachesize" , &l2CacheSize_, &l2Length, NULL, 0);
 
+  size_t coresLength = sizeof(cpuCores_);
+  sysctlbyname("hw.physicalcpu", &cpuCores_, &coresLength, NULL, 0);
+
   size_t size = 0;
 
   if (!sysctlbyname("hw.cacheconfig", NULL, &size, NULL, 0))
@@ -210,6 +280,7 @@ void CpuInfo::init()
   {
     if (info[i].Relationship == RelationProcessorCore)
     {
+      cpuCores_++;
       auto mask = info[i].ProcessorMask;
 
       // ProcessorMask contains one bit set for
@@ -300,6 +371,19 @@ void CpuInfo::init()
 ///
 void CpuInfo::init()
 {
+  // detect the NUMA topology, each NUMA node's cpulist
+  // file contains the node's CPUs, e.g. "0-3,8-11"
+  for (size_t node = 0; node < 1024; node++)
+  {
+    string filename = "/sys/devices/system/node/node" + to_string(node) + "/cpulist";
+    string cpuList = getString(filename);
+
+    if (cpuList.empty())
+      break;
+
+    numaNodeCpus_.push_back(parseCpuList(cpuList));
+  }
+
   for (int i = 0; i <= 3; i++)
   {
     string filename = "/sys/devices/system/cpu/cpu0/cache/index" + to_string(i);
@@ -334,6 +418,63 @@ void CpuInfo::init()
         privateL2Cache_ = true;
     }
   }
+
+  // Per-CPU cache sizes, on hybrid CPUs (e.g. P/E cores,
+  // big.LITTLE) the core types have different cache sizes
+  // and a single sieve size would thrash the smaller cores'
+  // caches, see get_sieve_size() in api.cpp.
+  vector<size_t> cpus = parseCpuList(getString("/sys/devices/system/cpu/present"));
+
+  for (size_t cpu : cpus)
+  {
+    if (cpu >= (1 << 16))
+      break;
+
+    size_t l1Size = 0;
+    size_t l2Size = 0;
+
+    for (int i = 0; i <= 3; i++)
+    {
+      string filename = "/sys/devices/system/cpu/cpu" + to_string(cpu) + "/cache/index" + to_string(i);
+      size_t level = getValue(filename + "/level");
+      string type = getString(filename + "/type");
+
+      if (type == "Data" ||
+          type == "Unified")
+      {
+        if (level == 1)
+          l1Size = getValue(filename + "/size");
+        if (level == 2)
+          l2Size = getValue(filename + "/size");
+      }
+    }
+
+    if (l1Size == 0 &&
+        l2Size == 0)
+      break;
+
+    l1CacheSizes_.resize(cpu + 1, 0);
+    l2CacheSizes_.resize(cpu + 1, 0);
+    l1CacheSizes_[cpu] = l1Size;
+    l2CacheSizes_[cpu] = l2Size;
+
+    asymmetricCaches_ |= (l1Size != l1CacheSize_ ||
+                          l2Size != l2CacheSize_);
+  }
+
+  // physical CPU cores = logical CPUs / SMT threads per core
+  string present = getString("/sys/devices/system/cpu/present");
+  string threadSiblings = getString("/sys/devices/system/cpu/cpu0/topology/thread_siblings_list");
+
+  if (!present.empty() &&
+      !threadSiblings.empty())
+  {
+    size_t logicalCpus = parseCpuList(present).size();
+    size_t threadsPerCore = parseCpuList(threadSiblings).size();
+
+    if (threadsPerCore > 0)
+      cpuCores_ = logicalCpus / threadsPerCore;
+  }
 }
 
 #endif
@@ -10,17 +10,23 @@
 ///
 
 #include <primesieve/config.hpp>
+#include <primesieve/CpuInfo.hpp>
 #include <primesieve/Erat.hpp>
 #include <primesieve/EratSmall.hpp>
 #include <primesieve/EratMedium.hpp>
 #include <primesieve/EratBig.hpp>
 #include <primesieve/PreSieve.hpp>
+#include <primesieve/hugepages.hpp>
 #include <primesieve/pmath.hpp>
 #include <primesieve/primesieve_error.hpp>
+#include <primesieve/Stats.hpp>
+#include <primesieve/tracepoints.hpp>
 
 #include <stdint.h>
 #include <array>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <memory>
 
 using namespace std;
@@ -52,6 +58,19 @@ const array<byte_t, 37> unsetLarger =
 
 namespace primesieve {
 
+double get_factor_eratsmall();
+double get_factor_eratmedium();
+
+#if defined(__GNUC__) || \
+    defined(__clang__)
+
+const array<uint64_t, 8> Erat::bitValues_ =
+{
+  7, 11, 13, 17, 19, 23, 29, 31
+};
+
+#else
+
 const array<uint64_t, 64> Erat::bruijnBitValues_ =
 {
     7,  47,  11,  49,  67, 113,  13,  53,
@@ -64,6 +83,8 @@ const array<uint64_t, 64> Erat::bruijnBitValues_ =
   173, 223, 193,  31, 221,  29,  23, 241
 };
 
+#endif
+
 Erat::Erat() { }
 
 Erat::Erat(uint64_t start, uint64_t stop) :
@@ -91,6 +112,7 @@ void Erat::init(uint64_t start,
 
   start_ = start;
   stop_ = stop;
+  uncheckedSegments_ = stop < (1ull << 62);
   preSieve_ = &preSieve;
   maxPreSieve_ = preSieve.getMaxPrime();
   initSieve(sieveSize);
@@ -110,8 +132,48 @@ void Erat::initSieve(uint64_t sieveSize)
   sieveSize_ = inBetween(8, sieveSize_, 4096);
   sieveSize_ *= 1024;
 
+  uint64_t sqrtStop = isqrt(stop_);
+  uint64_t l1Size = EratSmall::getL1Size(sieveSize_);
+
+  // For small stop numbers all sieving primes are processed
+  // by EratSmall, an L1 cache sized segment then keeps the
+  // sieve array L1 resident
+  if (sqrtStop <= l1Size * get_factor_eratsmall())
+    sieveSize_ = min(sieveSize_, floorPow2(l1Size));
+
+  // For very large stop numbers the per-segment fixed costs
+  // of EratBig (bucket list iteration, bucket refills)
+  // dominate, segments sized to the CPU's private L2 cache
+  // amortize them better than L1 sized segments
+  if (sqrtStop >= (uint64_t) 1e8 &&
+      cpuInfo.hasL2Cache() &&
+      cpuInfo.privateL2Cache())
+  {
+    uint64_t l2Size = floorPow2(cpuInfo.l2CacheSize());
+    l2Size = inBetween(8 << 10, l2Size, 4096 << 10);
+
+    // A run that starts small passes through a regime where
+    // EratBig holds few sieving primes yet and the smaller
+    // segments are faster. Keep the small start size and
+    // step the segments up to the L2 size at power-of-ten
+    // boundaries, guided by the measured throughput, see
+    // updateSieveSize(). Runs that already start deep in
+    // EratBig territory get the L2 size right away.
+    if (start_ >= (uint64_t) 1e16 || l2Size <= sieveSize_)
+      sieveSize_ = max(sieveSize_, l2Size);
+    else
+    {
+      adaptiveMaxSieveSize_ = l2Size;
+      probeBoundary_ = 10;
+      while (probeBoundary_ <= start_)
+        probeBoundary_ *= 10;
+    }
+  }
+
+  segmentDist_ = sieveSize_ * 30;
   sieve_ = new byte_t[sieveSize_];
   deleter_.reset(sieve_);
+  adviseHugePages(sieve_, sieveSize_);
 }
 
 void Erat::initErat()
@@ -119,27 +181,29 @@ void Erat::initErat()
   uint64_t sqrtStop = isqrt(stop_);
   uint64_t l1Size = EratSmall::getL1Size(sieveSize_);
 
-  maxEratSmall_  = (uint64_t) (l1Size * config::FACTOR_ERATSMALL);
-  maxEratMedium_ = (uint64_t) (sieveSize_ * config::FACTOR_ERATMEDIUM);
+  maxEratSmall_  = (uint64_t) (l1Size * get_factor_eratsmall());
+  maxEratMedium_ = (uint64_t) (sieveSize_ * get_factor_eratmedium());
 
   if (sqrtStop > maxPreSieve_)
     eratSmall_.init(stop_, l1Size, maxEratSmall_);
   if (sqrtStop > maxEratSmall_)
     eratMedium_.init(stop_, sieveSize_, maxEratMedium_);
   if (sqrtStop > maxEratMedium_)
-    eratBig_.init(stop_, sieveSize_, sqrtStop);
+    eratBig_.init(start_, stop_, sieveSize_, maxEratMedium_, sqrtStop);
 }
 
-bool Erat::hasNextSegment() const
+/// Set an optional cancellation flag, the flag is checked
+/// at segment boundaries and a canceled sieve throws a
+/// primesieve_error. Used by PrimeSieve::cancel().
+///
+void Erat::setCancelFlag(const std::atomic<bool>* cancel)
 {
-  return segmentLow_ < stop_;
+  cancel_ = cancel;
 }
 
-uint64_t Erat::byteRemainder(uint64_t n)
+bool Erat::hasNextSegment() const
 {
-  n %= 30;
-  if (n <= 6) n += 30;
-  return n;
+  return segmentLow_ < stop_;
 }
 
 /// Pre-sieve multiples of small primes e.g. <= 19
@@ -147,41 +211,220 @@ uint64_t Erat::byteRemainder(uint64_t n)
 ///
 void Erat::preSieve()
 {
+  stats::Timer timer(stats::PRE_SIEVE);
   preSieve_->copy(sieve_, sieveSize_, segmentLow_);
 
   // unset bits < start
   if (segmentLow_ <= start_)
   {
     if (start_ <= maxPreSieve_)
-      sieve_[0] = 0xff;
+    {
+      if (segmentLow_ == 0)
+      {
+        // the 1st sieve byte corresponds to the numbers
+        // 7 to 36 which are all prime or pre-sieved
+        sieve_[0] = 0xff;
+        // restore the tier primes 37, 41, 43, 47 and 53
+        // (bits 0, 1, 2, 3 and 5 of the 2nd sieve byte)
+        // which the tiered pre-sieve has crossed off,
+        // 49 = 7 * 7 (bit 4) stays unset
+        if (maxPreSieve_ >= 37)
+          sieve_[1] |= 0x2f;
+      }
+      else
+        // segmentLow_ == 30, restore the tier primes
+        // 37, 41, 43, 47 and 53 in the 1st sieve byte
+        sieve_[0] |= 0x2f;
+    }
     uint64_t rem = byteRemainder(start_);
     sieve_[0] &= unsetSmaller[rem];
   }
 }
 
+void Erat::processBlock(uint64_t, uint64_t)
+{ }
+
+/// EratMedium and EratBig stream the whole segment, then
+/// EratSmall (which chunks its work by the L1 cache size
+/// anyway) runs last so each finished block can be handed
+/// to the consumer via processBlock() while its bytes are
+/// still in the L1 cache, instead of re-streaming the
+/// segment once sieving has completed
+///
 void Erat::crossOff()
 {
-  if (eratSmall_.enabled())
-    eratSmall_.crossOff(sieve_, sieveSize_);
   if (eratMedium_.enabled())
+  {
+    stats::Timer timer(stats::ERAT_MEDIUM);
     eratMedium_.crossOff(sieve_, sieveSize_);
+  }
   if (eratBig_.enabled())
+  {
+    stats::Timer timer(stats::ERAT_BIG);
     eratBig_.crossOff(sieve_);
+  }
+  if (eratSmall_.enabled())
+  {
+    uint64_t l1Size = eratSmall_.getL1Size();
+
+    for (uint64_t i = 0; i < sieveSize_; i += l1Size)
+    {
+      uint64_t blockSize = min(l1Size, sieveSize_ - i);
+      {
+        stats::Timer timer(stats::ERAT_SMALL);
+        eratSmall_.crossOff(&sieve_[i], &sieve_[i + blockSize]);
+      }
+      processBlock(i, blockSize);
+    }
+  }
+  else
+    processBlock(0, sieveSize_);
 }
 
 void Erat::sieveSegment()
 {
+  stats::inc(stats::SEGMENTS);
+
+  if (cancel_ &&
+      cancel_->load(std::memory_order_relaxed))
+    throw primesieve_error("sieving canceled");
+
+  if (adaptiveMaxSieveSize_)
+    updateSieveSize();
+
+  // USDT tracepoints (nops unless a tracer is attached),
+  // e.g. for per-segment latency histograms via bpftrace
+  uint64_t traceLow = segmentLow_;
+  uint64_t traceHigh = segmentHigh_;
+  PRIMESIEVE_PROBE2(segment_begin, traceLow, traceHigh);
+
   if (segmentHigh_ == stop_)
     sieveLastSegment();
   else
   {
-    preSieve();
-    crossOff();
+    if (probeState_ != PROBE_IDLE)
+    {
+      // measure the throughput of a full segment,
+      // feeds the adaptive sieve size probe
+      auto t1 = std::chrono::steady_clock::now();
+      preSieve();
+      crossOff();
+      auto t2 = std::chrono::steady_clock::now();
+      probeSeconds_ += std::chrono::duration<double>(t2 - t1).count();
+      probeBytes_ += sieveSize_;
+      probeSegments_--;
+    }
+    else
+    {
+      preSieve();
+      crossOff();
+    }
+
+    // stop numbers close to 2^64 need overflow
+    // checked arithmetic, see init()
+    if (uncheckedSegments_)
+    {
+      segmentLow_ += segmentDist_;
+      segmentHigh_ = min(segmentHigh_ + segmentDist_, stop_);
+    }
+    else
+    {
+      segmentLow_ = checkedAdd(segmentLow_, segmentDist_);
+      segmentHigh_ = checkedAdd(segmentHigh_, segmentDist_);
+      segmentHigh_ = min(segmentHigh_, stop_);
+    }
+  }
+
+  PRIMESIEVE_PROBE2(segment_end, traceLow, traceHigh);
+}
+
+/// Reallocate the sieve array for a new sieve size and
+/// re-distribute EratBig's stored sieving primes, called
+/// between two segments. EratSmall and EratMedium store
+/// their multiple offsets relative to the segment start
+/// and need no adjustment.
+///
+void Erat::resizeSieve(uint64_t sieveSize)
+{
+  uint64_t oldSieveSize = sieveSize_;
+
+  sieveSize_ = sieveSize;
+  segmentDist_ = sieveSize_ * 30;
+  sieve_ = new byte_t[sieveSize_];
+  deleter_.reset(sieve_);
+  adviseHugePages(sieve_, sieveSize_);
+
+  segmentHigh_ = checkedAdd(segmentLow_, segmentDist_ + 6);
+  segmentHigh_ = min(segmentHigh_, stop_);
+
+  if (eratBig_.enabled())
+    eratBig_.resize(sieveSize_);
 
-    uint64_t dist = sieveSize_ * 30;
-    segmentLow_ = checkedAdd(segmentLow_, dist);
-    segmentHigh_ = checkedAdd(segmentHigh_, dist);
-    segmentHigh_ = min(segmentHigh_, stop_);
+  PRIMESIEVE_PROBE2(sieve_resize, oldSieveSize, sieveSize_);
+}
+
+/// Adaptive sieve size for long runs: a run to e.g. 10^19
+/// passes through regimes where the optimal segment size
+/// changes, early on EratBig holds few sieving primes and
+/// small (L1 sized) segments win, later its per-segment
+/// fixed costs dominate and L2 sized segments win. At each
+/// power-of-ten boundary the throughput of PROBE_SEGMENTS
+/// segments is measured, the sieve size is doubled, the
+/// throughput is measured again and the step is reverted
+/// if the bigger segments turned out slower.
+///
+void Erat::updateSieveSize()
+{
+  enum { PROBE_SEGMENTS = 16 };
+
+  switch (probeState_)
+  {
+    case PROBE_IDLE:
+      if (segmentLow_ >= probeBoundary_ &&
+          sieveSize_ < adaptiveMaxSieveSize_ &&
+          eratBig_.enabled())
+      {
+        probeState_ = PROBE_BASELINE;
+        probeSegments_ = PROBE_SEGMENTS;
+        probeBytes_ = 0;
+        probeSeconds_ = 0.0;
+      }
+      break;
+
+    case PROBE_BASELINE:
+      if (probeSegments_ <= 0)
+      {
+        baselineRate_ = probeBytes_ / probeSeconds_;
+        prevSieveSize_ = sieveSize_;
+        resizeSieve(sieveSize_ * 2);
+        probeState_ = PROBE_TRIAL;
+        probeSegments_ = PROBE_SEGMENTS;
+        probeBytes_ = 0;
+        probeSeconds_ = 0.0;
+      }
+      break;
+
+    case PROBE_TRIAL:
+      if (probeSegments_ <= 0)
+      {
+        double rate = probeBytes_ / probeSeconds_;
+        if (rate < baselineRate_)
+          resizeSieve(prevSieveSize_);
+
+        // probe again at the next power-of-ten boundary
+        while (probeBoundary_ <= segmentLow_)
+        {
+          if (probeBoundary_ > stop_ / 10)
+          {
+            probeBoundary_ = ~0ull;
+            break;
+          }
+          probeBoundary_ *= 10;
+        }
+
+        probeState_ = PROBE_IDLE;
+      }
+      break;
   }
 }
 
@@ -12,38 +12,49 @@
 ///
 
 #include <primesieve/Bucket.hpp>
+#include <primesieve/BucketArena.hpp>
 #include <primesieve/config.hpp>
 #include <primesieve/EratBig.hpp>
+#include <primesieve/hugepages.hpp>
 #include <primesieve/pmath.hpp>
+#include <primesieve/prefetch.hpp>
 #include <primesieve/primesieve_error.hpp>
+#include <primesieve/Stats.hpp>
 #include <primesieve/types.hpp>
 #include <primesieve/Wheel.hpp>
 
 #include <stdint.h>
 #include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <memory>
+#include <utility>
 #include <vector>
 
 using namespace std;
 
 namespace primesieve {
 
+/// @start:      Lower bound for sieving
 /// @stop:       Upper bound for sieving
 /// @sieveSize:  Sieve size in bytes
+/// @minPrime:   Sieving primes > minPrime
 /// @maxPrime:   Sieving primes <= maxPrime
 ///
-void EratBig::init(uint64_t stop, uint64_t sieveSize, uint64_t maxPrime)
+void EratBig::init(uint64_t start, uint64_t stop, uint64_t sieveSize, uint64_t minPrime, uint64_t maxPrime)
 {
   // '>> log2SieveSize' requires power of 2 sieveSize
   if (!isPow2(sieveSize))
     throw primesieve_error("EratBig: sieveSize must be a power of 2");
 
   enabled_ = true;
+  minPrime_ = minPrime;
   maxPrime_ = maxPrime;
+  dist_ = stop - start;
   log2SieveSize_ = ilog2(sieveSize);
   moduloSieveSize_ = sieveSize - 1;
   stock_ = nullptr;
+  releaseMemory();
 
   Wheel::init(stop, sieveSize);
   init(sieveSize);
@@ -61,6 +72,37 @@ void EratBig::init(uint64_t sieveSize)
   uint64_t maxBytes = (1u << 30) * 2;
   memory_.reserve(maxBytes / config::BYTES_PER_ALLOC);
 
+  allocSize_ = config::BYTES_PER_ALLOC / sizeof(Bucket);
+
+  // Allocate the projected bucket demand upfront as one
+  // contiguous chunk: 1 bucket per list + enough buckets to
+  // store the big sieving primes in ]minPrime, maxPrime]
+  // (pi() delta, the smaller primes belong to EratSmall and
+  // EratMedium). Steady-state sieving then performs (almost)
+  // zero allocations and the bucket walk in crossOff() scans
+  // mostly adjacent memory.
+  uint64_t primes = primeCountApprox(minPrime_, maxPrime_);
+
+  // For narrow sieving intervals most big sieving primes
+  // have no multiple in [start, stop] and are dropped by
+  // Wheel::addSievingPrime(), only a prime with >= 1
+  // multiple occupies a bucket slot. Cap the demand by the
+  // expected number of multiples in the interval:
+  // dist * 8/30 * sum(1/p) = dist * 8/30 * (lnln(max) - lnln(min))
+  // (Mertens' 2nd theorem), which for e.g.
+  // [10^18, 10^18 + 10^8] is orders of magnitude smaller
+  // than the pi() delta.
+  if (minPrime_ >= 7 &&
+      maxPrime_ > minPrime_)
+  {
+    double lnlnRatio = std::log(std::log((double) maxPrime_) /
+                                std::log((double) minPrime_));
+    double multiples = (double) dist_ * (8.0 / 30.0) * lnlnRatio;
+    if (multiples < (double) primes)
+      primes = (uint64_t) multiples + 1;
+  }
+  allocBuckets(size + primes / config::BUCKETSIZE + 1);
+
   lists_.resize(size, nullptr);
   for (uint64_t i = 0; i < size; i++)
     pushBucket(i);
@@ -78,20 +120,114 @@ void EratBig::storeSievingPrime(uint64_t prime, uint64_t multipleIndex, uint64_t
     pushBucket(segment);
 }
 
+/// Re-distribute the stored sieving primes into bucket lists
+/// matching a new sieve size. Each stored multipleIndex is
+/// relative to its list's segment, the absolute offset from
+/// the current segment is preserved across the resize. Used
+/// by Erat when stepping the sieve size up (or back down)
+/// during a run, see Erat::updateSieveSize().
+///
+void EratBig::resize(uint64_t sieveSize)
+{
+  if (!isPow2(sieveSize))
+    throw primesieve_error("EratBig: sieveSize must be a power of 2");
+
+  uint64_t oldLog2 = log2SieveSize_;
+  vector<Bucket*> oldLists;
+  oldLists.swap(lists_);
+
+  log2SieveSize_ = ilog2(sieveSize);
+  moduloSieveSize_ = sieveSize - 1;
+
+  // same sizing as init(), but when shrinking the old lists
+  // may reach further than the projected maxSegmentCount
+  uint64_t maxSievingPrime  = maxPrime_ / 30;
+  uint64_t maxNextMultiple  = maxSievingPrime * getMaxFactor() + getMaxFactor();
+  uint64_t maxMultipleIndex = sieveSize - 1 + maxNextMultiple;
+  uint64_t maxOldIndex = (oldLists.size() << oldLog2) - 1;
+  uint64_t size = (max(maxMultipleIndex, maxOldIndex) >> log2SieveSize_) + 1;
+
+  lists_.resize(size, nullptr);
+  for (uint64_t i = 0; i < size; i++)
+    pushBucket(i);
+
+  for (uint64_t i = 0; i < oldLists.size(); i++)
+  {
+    Bucket* bucket = oldLists[i];
+    do {
+      for (SievingPrime* prime = bucket->begin(); prime != bucket->end(); prime++)
+      {
+        uint64_t multipleIndex = (i << oldLog2) + prime->getMultipleIndex();
+        uint64_t segment = multipleIndex >> log2SieveSize_;
+        multipleIndex &= moduloSieveSize_;
+
+        if (!lists_[segment]->store(prime->getSievingPrime(), multipleIndex, prime->getWheelIndex()))
+          pushBucket(segment);
+      }
+      Bucket* processed = bucket;
+      bucket = bucket->next();
+      processed->reset();
+      moveBucket(*processed, stock_);
+    } while (bucket);
+  }
+}
+
+EratBig::~EratBig()
+{
+  releaseMemory();
+}
+
+/// Return the bucket chunks to the BucketArena so
+/// that the next EratBig object gets warm, already
+/// page-faulted bucket memory
+///
+void EratBig::releaseMemory()
+{
+  BucketArena& arena = BucketArena::getInstance();
+
+  for (auto& chunk : memory_)
+    arena.release(std::move(chunk));
+
+  memory_.clear();
+}
+
+/// Get a chunk of buckets from the BucketArena
+/// and add them to the stock
+///
+void EratBig::allocBuckets(uint64_t size)
+{
+  stats::inc(stats::BUCKET_ALLOCS);
+  stats::inc(stats::BUCKETS, size);
+  memory_.emplace_back(BucketArena::getInstance().acquire(size));
+  BucketArena::Chunk& chunk = memory_.back();
+  Bucket* bucket = chunk.buckets.get();
+  uint64_t N = chunk.size;
+
+  // recycled buckets may contain stale
+  // sieving primes, reset them
+  for (uint64_t i = 0; i < N - 1; i++)
+  {
+    bucket[i].reset();
+    bucket[i].setNext(&bucket[i + 1]);
+  }
+  bucket[N-1].reset();
+  bucket[N-1].setNext(stock_);
+  stock_ = bucket;
+}
+
 /// Add an empty bucket to the front of lists_[segment]
 void EratBig::pushBucket(uint64_t segment)
 {
-  // allocate new buckets
+  // get new buckets from the arena
   if (!stock_)
   {
-    int N = config::BYTES_PER_ALLOC / sizeof(Bucket);
-    memory_.emplace_back(unique_ptr<Bucket[]>(new Bucket[N]));
-    Bucket* bucket = memory_.back().get();
-
-    for (int i = 0; i < N - 1; i++)
-      bucket[i].setNext(&bucket[i + 1]);
-    bucket[N-1].setNext(nullptr);
-    stock_ = bucket;
+    allocBuckets(allocSize_);
+
+    // the allocation size grows geometrically, this
+    // reduces the number of allocations (which stall
+    // the crossOff loop) for very large stop numbers
+    uint64_t maxSize = config::MAX_BYTES_PER_ALLOC / sizeof(Bucket);
+    allocSize_ = min(allocSize_ * 2, maxSize);
   }
   Bucket* empty = stock_;
   stock_ = stock_->next();
@@ -115,6 +251,12 @@ void EratBig::crossOff(byte_t* sieve)
     lists_[0] = nullptr;
     pushBucket(0);
     do {
+      // prefetch the next bucket node so its header and
+      // first sieving primes are loaded while the current
+      // bucket is being processed
+      if (bucket->hasNext())
+        prefetchRead(bucket->next());
+
       crossOff(sieve, bucket->begin(), bucket->end());
       Bucket* processed = bucket;
       bucket = bucket->next();
@@ -140,7 +282,15 @@ void EratBig::crossOff(byte_t* sieve, SievingPrime* primes, SievingPrime* end)
   // 2 sieving primes are processed per loop iteration
   // to increase instruction level parallelism
   for (; primes + 2 <= end; primes += 2)
-  { 
+  {
+    // prefetch the sieve bytes that will be
+    // crossed off 2 iterations ahead
+    if (primes + 6 <= end)
+    {
+      prefetchWrite(&sieve[primes[4].getMultipleIndex()]);
+      prefetchWrite(&sieve[primes[5].getMultipleIndex()]);
+    }
+
     uint64_t multipleIndex0 = primes[0].getMultipleIndex();
     uint64_t wheelIndex0    = primes[0].getWheelIndex();
     uint64_t sievingPrime0  = primes[0].getSievingPrime();
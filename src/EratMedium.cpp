@@ -1,7 +1,15 @@
 ///
 /// @file   EratMedium.cpp
 /// @brief  Segmented sieve of Eratosthenes optimized for
-///         medium sieving primes.
+///         medium sieving primes. EratMedium uses the 3rd
+///         wheel (modulo 30) and one specialized crossOff
+///         kernel per wheel residue class, each kernel
+///         hardcodes the 8-step bitmask/stride sequence of
+///         its residue class instead of loading it from the
+///         generic WheelElement table. While the next wheel
+///         turn fits into the segment all 8 multiples are
+///         removed with precomputed offsets and no
+///         per-multiple bounds checks.
 ///
 /// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
 ///
@@ -11,6 +19,8 @@
 
 #include <primesieve/Bucket.hpp>
 #include <primesieve/EratMedium.hpp>
+#include <primesieve/bits.hpp>
+#include <primesieve/multiarch.hpp>
 #include <primesieve/primesieve_error.hpp>
 #include <primesieve/pmath.hpp>
 #include <primesieve/types.hpp>
@@ -20,6 +30,8 @@
 #include <cassert>
 #include <vector>
 
+using namespace std;
+
 namespace primesieve {
 
 /// @stop:       Upper bound for sieving
@@ -40,15 +52,23 @@ void EratMedium::init(uint64_t stop, uint64_t sieveSize, uint64_t maxPrime)
   Wheel::init(stop, sieveSize);
 
   size_t size = primeCountApprox(maxPrime);
-  primes_.reserve(size);
+  for (auto& primes : primes_)
+  {
+    primes.clear();
+    primes.reserve(size / 8);
+  }
 }
 
-/// Add a new sieving prime to EratMedium
+/// Add a new sieving prime to EratMedium. The sieving
+/// primes are grouped by their wheel residue class
+/// (prime % 30), the matching specialized crossOff
+/// kernel is thereby selected once per sieving prime.
+///
 void EratMedium::storeSievingPrime(uint64_t prime, uint64_t multipleIndex, uint64_t wheelIndex)
 {
   assert(prime <= maxPrime_);
   uint64_t sievingPrime = prime / 30;
-  primes_.emplace_back(sievingPrime, multipleIndex, wheelIndex);
+  primes_[wheelIndex / 8].emplace_back(sievingPrime, multipleIndex, wheelIndex % 8);
 }
 
 /// Segmented sieve of Eratosthenes with wheel factorization
@@ -57,58 +77,757 @@ void EratMedium::storeSievingPrime(uint64_t prime, uint64_t multipleIndex, uint6
 ///
 void EratMedium::crossOff(byte_t* sieve, uint64_t sieveSize)
 {
-  size_t i = 0;
-  size_t size = primes_.size();
-  auto primes = primes_.data();
+  crossOff_7 (sieve, sieveSize, primes_[0]);
+  crossOff_11(sieve, sieveSize, primes_[1]);
+  crossOff_13(sieve, sieveSize, primes_[2]);
+  crossOff_17(sieve, sieveSize, primes_[3]);
+  crossOff_19(sieve, sieveSize, primes_[4]);
+  crossOff_23(sieve, sieveSize, primes_[5]);
+  crossOff_29(sieve, sieveSize, primes_[6]);
+  crossOff_1 (sieve, sieveSize, primes_[7]);
+}
+
+/// Cross-off the multiples of the sieving primes
+/// with prime % 30 == 7. The 8 wheel steps are
+/// hardcoded (bitmask, stride), see wheel30 in
+/// Wheel.cpp.
+///
+PRIMESIEVE_MULTIARCH
+void EratMedium::crossOff_7(byte_t* sieve,
+                            uint64_t sieveSize,
+                            vector<SievingPrime>& primes)
+{
+  for (auto& prime : primes)
+  {
+    uint64_t sievingPrime  = prime.getSievingPrime();
+    uint64_t multipleIndex = prime.getMultipleIndex();
+    uint64_t wheelIndex    = prime.getWheelIndex();
+
+    uint64_t dist0 = sievingPrime * 6 + 1;
+    uint64_t dist1 = sievingPrime * 4 + 1;
+    uint64_t dist2 = sievingPrime * 2 + 0;
+    uint64_t dist3 = sievingPrime * 4 + 1;
+    uint64_t dist4 = sievingPrime * 2 + 1;
+    uint64_t dist5 = sievingPrime * 4 + 1;
+    uint64_t dist6 = sievingPrime * 6 + 1;
+    uint64_t dist7 = sievingPrime * 2 + 1;
+
+    uint64_t off1 = dist0;
+    uint64_t off2 = off1 + dist1;
+    uint64_t off3 = off2 + dist2;
+    uint64_t off4 = off3 + dist3;
+    uint64_t off5 = off4 + dist4;
+    uint64_t off6 = off5 + dist5;
+    uint64_t off7 = off6 + dist6;
+    uint64_t loopDist = off7 + dist7;
+    uint64_t loopLimit = (sieveSize > off7) ? sieveSize - off7 : 0;
+
+    switch (wheelIndex)
+    {
+      for (;;)
+      {
+        case 0: // each fast loop iteration removes the next 8
+                // multiples of the sievingPrime without any
+                // per-multiple bounds checks
+                for (; multipleIndex < loopLimit; multipleIndex += loopDist)
+                {
+                  sieve[multipleIndex] &= BIT0;
+                  sieve[multipleIndex + off1] &= BIT4;
+                  sieve[multipleIndex + off2] &= BIT3;
+                  sieve[multipleIndex + off3] &= BIT7;
+                  sieve[multipleIndex + off4] &= BIT6;
+                  sieve[multipleIndex + off5] &= BIT2;
+                  sieve[multipleIndex + off6] &= BIT1;
+                  sieve[multipleIndex + off7] &= BIT5;
+                }
+                if (multipleIndex >= sieveSize) { wheelIndex = 0; goto out; }
+                sieve[multipleIndex] &= BIT0;
+                multipleIndex += dist0;
+                // fallthrough
+        case 1: if (multipleIndex >= sieveSize) { wheelIndex = 1; goto out; }
+                sieve[multipleIndex] &= BIT4;
+                multipleIndex += dist1;
+                // fallthrough
+        case 2: if (multipleIndex >= sieveSize) { wheelIndex = 2; goto out; }
+                sieve[multipleIndex] &= BIT3;
+                multipleIndex += dist2;
+                // fallthrough
+        case 3: if (multipleIndex >= sieveSize) { wheelIndex = 3; goto out; }
+                sieve[multipleIndex] &= BIT7;
+                multipleIndex += dist3;
+                // fallthrough
+        case 4: if (multipleIndex >= sieveSize) { wheelIndex = 4; goto out; }
+                sieve[multipleIndex] &= BIT6;
+                multipleIndex += dist4;
+                // fallthrough
+        case 5: if (multipleIndex >= sieveSize) { wheelIndex = 5; goto out; }
+                sieve[multipleIndex] &= BIT2;
+                multipleIndex += dist5;
+                // fallthrough
+        case 6: if (multipleIndex >= sieveSize) { wheelIndex = 6; goto out; }
+                sieve[multipleIndex] &= BIT1;
+                multipleIndex += dist6;
+                // fallthrough
+        case 7: if (multipleIndex >= sieveSize) { wheelIndex = 7; goto out; }
+                sieve[multipleIndex] &= BIT5;
+                multipleIndex += dist7;
+      }
+    }
+
+    out:
+    multipleIndex -= sieveSize;
+    prime.set(multipleIndex, wheelIndex);
+  }
+}
+
+/// Cross-off the multiples of the sieving primes
+/// with prime % 30 == 11. The 8 wheel steps are
+/// hardcoded (bitmask, stride), see wheel30 in
+/// Wheel.cpp.
+///
+PRIMESIEVE_MULTIARCH
+void EratMedium::crossOff_11(byte_t* sieve,
+                             uint64_t sieveSize,
+                             vector<SievingPrime>& primes)
+{
+  for (auto& prime : primes)
+  {
+    uint64_t sievingPrime  = prime.getSievingPrime();
+    uint64_t multipleIndex = prime.getMultipleIndex();
+    uint64_t wheelIndex    = prime.getWheelIndex();
+
+    uint64_t dist0 = sievingPrime * 6 + 2;
+    uint64_t dist1 = sievingPrime * 4 + 1;
+    uint64_t dist2 = sievingPrime * 2 + 1;
+    uint64_t dist3 = sievingPrime * 4 + 2;
+    uint64_t dist4 = sievingPrime * 2 + 0;
+    uint64_t dist5 = sievingPrime * 4 + 2;
+    uint64_t dist6 = sievingPrime * 6 + 2;
+    uint64_t dist7 = sievingPrime * 2 + 1;
+
+    uint64_t off1 = dist0;
+    uint64_t off2 = off1 + dist1;
+    uint64_t off3 = off2 + dist2;
+    uint64_t off4 = off3 + dist3;
+    uint64_t off5 = off4 + dist4;
+    uint64_t off6 = off5 + dist5;
+    uint64_t off7 = off6 + dist6;
+    uint64_t loopDist = off7 + dist7;
+    uint64_t loopLimit = (sieveSize > off7) ? sieveSize - off7 : 0;
+
+    switch (wheelIndex)
+    {
+      for (;;)
+      {
+        case 0: // each fast loop iteration removes the next 8
+                // multiples of the sievingPrime without any
+                // per-multiple bounds checks
+                for (; multipleIndex < loopLimit; multipleIndex += loopDist)
+                {
+                  sieve[multipleIndex] &= BIT1;
+                  sieve[multipleIndex + off1] &= BIT3;
+                  sieve[multipleIndex + off2] &= BIT7;
+                  sieve[multipleIndex + off3] &= BIT5;
+                  sieve[multipleIndex + off4] &= BIT0;
+                  sieve[multipleIndex + off5] &= BIT6;
+                  sieve[multipleIndex + off6] &= BIT2;
+                  sieve[multipleIndex + off7] &= BIT4;
+                }
+                if (multipleIndex >= sieveSize) { wheelIndex = 0; goto out; }
+                sieve[multipleIndex] &= BIT1;
+                multipleIndex += dist0;
+                // fallthrough
+        case 1: if (multipleIndex >= sieveSize) { wheelIndex = 1; goto out; }
+                sieve[multipleIndex] &= BIT3;
+                multipleIndex += dist1;
+                // fallthrough
+        case 2: if (multipleIndex >= sieveSize) { wheelIndex = 2; goto out; }
+                sieve[multipleIndex] &= BIT7;
+                multipleIndex += dist2;
+                // fallthrough
+        case 3: if (multipleIndex >= sieveSize) { wheelIndex = 3; goto out; }
+                sieve[multipleIndex] &= BIT5;
+                multipleIndex += dist3;
+                // fallthrough
+        case 4: if (multipleIndex >= sieveSize) { wheelIndex = 4; goto out; }
+                sieve[multipleIndex] &= BIT0;
+                multipleIndex += dist4;
+                // fallthrough
+        case 5: if (multipleIndex >= sieveSize) { wheelIndex = 5; goto out; }
+                sieve[multipleIndex] &= BIT6;
+                multipleIndex += dist5;
+                // fallthrough
+        case 6: if (multipleIndex >= sieveSize) { wheelIndex = 6; goto out; }
+                sieve[multipleIndex] &= BIT2;
+                multipleIndex += dist6;
+                // fallthrough
+        case 7: if (multipleIndex >= sieveSize) { wheelIndex = 7; goto out; }
+                sieve[multipleIndex] &= BIT4;
+                multipleIndex += dist7;
+      }
+    }
+
+    out:
+    multipleIndex -= sieveSize;
+    prime.set(multipleIndex, wheelIndex);
+  }
+}
+
+/// Cross-off the multiples of the sieving primes
+/// with prime % 30 == 13. The 8 wheel steps are
+/// hardcoded (bitmask, stride), see wheel30 in
+/// Wheel.cpp.
+///
+PRIMESIEVE_MULTIARCH
+void EratMedium::crossOff_13(byte_t* sieve,
+                             uint64_t sieveSize,
+                             vector<SievingPrime>& primes)
+{
+  for (auto& prime : primes)
+  {
+    uint64_t sievingPrime  = prime.getSievingPrime();
+    uint64_t multipleIndex = prime.getMultipleIndex();
+    uint64_t wheelIndex    = prime.getWheelIndex();
+
+    uint64_t dist0 = sievingPrime * 6 + 2;
+    uint64_t dist1 = sievingPrime * 4 + 2;
+    uint64_t dist2 = sievingPrime * 2 + 1;
+    uint64_t dist3 = sievingPrime * 4 + 2;
+    uint64_t dist4 = sievingPrime * 2 + 1;
+    uint64_t dist5 = sievingPrime * 4 + 1;
+    uint64_t dist6 = sievingPrime * 6 + 3;
+    uint64_t dist7 = sievingPrime * 2 + 1;
+
+    uint64_t off1 = dist0;
+    uint64_t off2 = off1 + dist1;
+    uint64_t off3 = off2 + dist2;
+    uint64_t off4 = off3 + dist3;
+    uint64_t off5 = off4 + dist4;
+    uint64_t off6 = off5 + dist5;
+    uint64_t off7 = off6 + dist6;
+    uint64_t loopDist = off7 + dist7;
+    uint64_t loopLimit = (sieveSize > off7) ? sieveSize - off7 : 0;
+
+    switch (wheelIndex)
+    {
+      for (;;)
+      {
+        case 0: // each fast loop iteration removes the next 8
+                // multiples of the sievingPrime without any
+                // per-multiple bounds checks
+                for (; multipleIndex < loopLimit; multipleIndex += loopDist)
+                {
+                  sieve[multipleIndex] &= BIT2;
+                  sieve[multipleIndex + off1] &= BIT7;
+                  sieve[multipleIndex + off2] &= BIT5;
+                  sieve[multipleIndex + off3] &= BIT4;
+                  sieve[multipleIndex + off4] &= BIT1;
+                  sieve[multipleIndex + off5] &= BIT0;
+                  sieve[multipleIndex + off6] &= BIT6;
+                  sieve[multipleIndex + off7] &= BIT3;
+                }
+                if (multipleIndex >= sieveSize) { wheelIndex = 0; goto out; }
+                sieve[multipleIndex] &= BIT2;
+                multipleIndex += dist0;
+                // fallthrough
+        case 1: if (multipleIndex >= sieveSize) { wheelIndex = 1; goto out; }
+                sieve[multipleIndex] &= BIT7;
+                multipleIndex += dist1;
+                // fallthrough
+        case 2: if (multipleIndex >= sieveSize) { wheelIndex = 2; goto out; }
+                sieve[multipleIndex] &= BIT5;
+                multipleIndex += dist2;
+                // fallthrough
+        case 3: if (multipleIndex >= sieveSize) { wheelIndex = 3; goto out; }
+                sieve[multipleIndex] &= BIT4;
+                multipleIndex += dist3;
+                // fallthrough
+        case 4: if (multipleIndex >= sieveSize) { wheelIndex = 4; goto out; }
+                sieve[multipleIndex] &= BIT1;
+                multipleIndex += dist4;
+                // fallthrough
+        case 5: if (multipleIndex >= sieveSize) { wheelIndex = 5; goto out; }
+                sieve[multipleIndex] &= BIT0;
+                multipleIndex += dist5;
+                // fallthrough
+        case 6: if (multipleIndex >= sieveSize) { wheelIndex = 6; goto out; }
+                sieve[multipleIndex] &= BIT6;
+                multipleIndex += dist6;
+                // fallthrough
+        case 7: if (multipleIndex >= sieveSize) { wheelIndex = 7; goto out; }
+                sieve[multipleIndex] &= BIT3;
+                multipleIndex += dist7;
+      }
+    }
+
+    out:
+    multipleIndex -= sieveSize;
+    prime.set(multipleIndex, wheelIndex);
+  }
+}
+
+/// Cross-off the multiples of the sieving primes
+/// with prime % 30 == 17. The 8 wheel steps are
+/// hardcoded (bitmask, stride), see wheel30 in
+/// Wheel.cpp.
+///
+PRIMESIEVE_MULTIARCH
+void EratMedium::crossOff_17(byte_t* sieve,
+                             uint64_t sieveSize,
+                             vector<SievingPrime>& primes)
+{
+  for (auto& prime : primes)
+  {
+    uint64_t sievingPrime  = prime.getSievingPrime();
+    uint64_t multipleIndex = prime.getMultipleIndex();
+    uint64_t wheelIndex    = prime.getWheelIndex();
+
+    uint64_t dist0 = sievingPrime * 6 + 3;
+    uint64_t dist1 = sievingPrime * 4 + 3;
+    uint64_t dist2 = sievingPrime * 2 + 1;
+    uint64_t dist3 = sievingPrime * 4 + 2;
+    uint64_t dist4 = sievingPrime * 2 + 1;
+    uint64_t dist5 = sievingPrime * 4 + 2;
+    uint64_t dist6 = sievingPrime * 6 + 4;
+    uint64_t dist7 = sievingPrime * 2 + 1;
+
+    uint64_t off1 = dist0;
+    uint64_t off2 = off1 + dist1;
+    uint64_t off3 = off2 + dist2;
+    uint64_t off4 = off3 + dist3;
+    uint64_t off5 = off4 + dist4;
+    uint64_t off6 = off5 + dist5;
+    uint64_t off7 = off6 + dist6;
+    uint64_t loopDist = off7 + dist7;
+    uint64_t loopLimit = (sieveSize > off7) ? sieveSize - off7 : 0;
+
+    switch (wheelIndex)
+    {
+      for (;;)
+      {
+        case 0: // each fast loop iteration removes the next 8
+                // multiples of the sievingPrime without any
+                // per-multiple bounds checks
+                for (; multipleIndex < loopLimit; multipleIndex += loopDist)
+                {
+                  sieve[multipleIndex] &= BIT3;
+                  sieve[multipleIndex + off1] &= BIT6;
+                  sieve[multipleIndex + off2] &= BIT0;
+                  sieve[multipleIndex + off3] &= BIT1;
+                  sieve[multipleIndex + off4] &= BIT4;
+                  sieve[multipleIndex + off5] &= BIT5;
+                  sieve[multipleIndex + off6] &= BIT7;
+                  sieve[multipleIndex + off7] &= BIT2;
+                }
+                if (multipleIndex >= sieveSize) { wheelIndex = 0; goto out; }
+                sieve[multipleIndex] &= BIT3;
+                multipleIndex += dist0;
+                // fallthrough
+        case 1: if (multipleIndex >= sieveSize) { wheelIndex = 1; goto out; }
+                sieve[multipleIndex] &= BIT6;
+                multipleIndex += dist1;
+                // fallthrough
+        case 2: if (multipleIndex >= sieveSize) { wheelIndex = 2; goto out; }
+                sieve[multipleIndex] &= BIT0;
+                multipleIndex += dist2;
+                // fallthrough
+        case 3: if (multipleIndex >= sieveSize) { wheelIndex = 3; goto out; }
+                sieve[multipleIndex] &= BIT1;
+                multipleIndex += dist3;
+                // fallthrough
+        case 4: if (multipleIndex >= sieveSize) { wheelIndex = 4; goto out; }
+                sieve[multipleIndex] &= BIT4;
+                multipleIndex += dist4;
+                // fallthrough
+        case 5: if (multipleIndex >= sieveSize) { wheelIndex = 5; goto out; }
+                sieve[multipleIndex] &= BIT5;
+                multipleIndex += dist5;
+                // fallthrough
+        case 6: if (multipleIndex >= sieveSize) { wheelIndex = 6; goto out; }
+                sieve[multipleIndex] &= BIT7;
+                multipleIndex += dist6;
+                // fallthrough
+        case 7: if (multipleIndex >= sieveSize) { wheelIndex = 7; goto out; }
+                sieve[multipleIndex] &= BIT2;
+                multipleIndex += dist7;
+      }
+    }
 
-  // process 3 sieving primes per loop iteration to
-  // increase instruction level parallelism
-  for (; i < size - size % 3; i += 3)
+    out:
+    multipleIndex -= sieveSize;
+    prime.set(multipleIndex, wheelIndex);
+  }
+}
+
+/// Cross-off the multiples of the sieving primes
+/// with prime % 30 == 19. The 8 wheel steps are
+/// hardcoded (bitmask, stride), see wheel30 in
+/// Wheel.cpp.
+///
+PRIMESIEVE_MULTIARCH
+void EratMedium::crossOff_19(byte_t* sieve,
+                             uint64_t sieveSize,
+                             vector<SievingPrime>& primes)
+{
+  for (auto& prime : primes)
   {
-    uint64_t multipleIndex0 = primes[i + 0].getMultipleIndex();
-    uint64_t wheelIndex0    = primes[i + 0].getWheelIndex();
-    uint64_t sievingPrime0  = primes[i + 0].getSievingPrime();
-    uint64_t multipleIndex1 = primes[i + 1].getMultipleIndex();
-    uint64_t wheelIndex1    = primes[i + 1].getWheelIndex();
-    uint64_t sievingPrime1  = primes[i + 1].getSievingPrime();
-    uint64_t multipleIndex2 = primes[i + 2].getMultipleIndex();
-    uint64_t wheelIndex2    = primes[i + 2].getWheelIndex();
-    uint64_t sievingPrime2  = primes[i + 2].getSievingPrime();
-
-    while (multipleIndex0 < sieveSize)
+    uint64_t sievingPrime  = prime.getSievingPrime();
+    uint64_t multipleIndex = prime.getMultipleIndex();
+    uint64_t wheelIndex    = prime.getWheelIndex();
+
+    uint64_t dist0 = sievingPrime * 6 + 4;
+    uint64_t dist1 = sievingPrime * 4 + 2;
+    uint64_t dist2 = sievingPrime * 2 + 2;
+    uint64_t dist3 = sievingPrime * 4 + 2;
+    uint64_t dist4 = sievingPrime * 2 + 1;
+    uint64_t dist5 = sievingPrime * 4 + 3;
+    uint64_t dist6 = sievingPrime * 6 + 4;
+    uint64_t dist7 = sievingPrime * 2 + 1;
+
+    uint64_t off1 = dist0;
+    uint64_t off2 = off1 + dist1;
+    uint64_t off3 = off2 + dist2;
+    uint64_t off4 = off3 + dist3;
+    uint64_t off5 = off4 + dist4;
+    uint64_t off6 = off5 + dist5;
+    uint64_t off7 = off6 + dist6;
+    uint64_t loopDist = off7 + dist7;
+    uint64_t loopLimit = (sieveSize > off7) ? sieveSize - off7 : 0;
+
+    switch (wheelIndex)
     {
-      unsetBit(sieve, sievingPrime0, &multipleIndex0, &wheelIndex0);
-      if (multipleIndex1 >= sieveSize) break;
-      unsetBit(sieve, sievingPrime1, &multipleIndex1, &wheelIndex1);
-      if (multipleIndex2 >= sieveSize) break;
-      unsetBit(sieve, sievingPrime2, &multipleIndex2, &wheelIndex2);
+      for (;;)
+      {
+        case 0: // each fast loop iteration removes the next 8
+                // multiples of the sievingPrime without any
+                // per-multiple bounds checks
+                for (; multipleIndex < loopLimit; multipleIndex += loopDist)
+                {
+                  sieve[multipleIndex] &= BIT4;
+                  sieve[multipleIndex + off1] &= BIT2;
+                  sieve[multipleIndex + off2] &= BIT6;
+                  sieve[multipleIndex + off3] &= BIT0;
+                  sieve[multipleIndex + off4] &= BIT5;
+                  sieve[multipleIndex + off5] &= BIT7;
+                  sieve[multipleIndex + off6] &= BIT3;
+                  sieve[multipleIndex + off7] &= BIT1;
+                }
+                if (multipleIndex >= sieveSize) { wheelIndex = 0; goto out; }
+                sieve[multipleIndex] &= BIT4;
+                multipleIndex += dist0;
+                // fallthrough
+        case 1: if (multipleIndex >= sieveSize) { wheelIndex = 1; goto out; }
+                sieve[multipleIndex] &= BIT2;
+                multipleIndex += dist1;
+                // fallthrough
+        case 2: if (multipleIndex >= sieveSize) { wheelIndex = 2; goto out; }
+                sieve[multipleIndex] &= BIT6;
+                multipleIndex += dist2;
+                // fallthrough
+        case 3: if (multipleIndex >= sieveSize) { wheelIndex = 3; goto out; }
+                sieve[multipleIndex] &= BIT0;
+                multipleIndex += dist3;
+                // fallthrough
+        case 4: if (multipleIndex >= sieveSize) { wheelIndex = 4; goto out; }
+                sieve[multipleIndex] &= BIT5;
+                multipleIndex += dist4;
+                // fallthrough
+        case 5: if (multipleIndex >= sieveSize) { wheelIndex = 5; goto out; }
+                sieve[multipleIndex] &= BIT7;
+                multipleIndex += dist5;
+                // fallthrough
+        case 6: if (multipleIndex >= sieveSize) { wheelIndex = 6; goto out; }
+                sieve[multipleIndex] &= BIT3;
+                multipleIndex += dist6;
+                // fallthrough
+        case 7: if (multipleIndex >= sieveSize) { wheelIndex = 7; goto out; }
+                sieve[multipleIndex] &= BIT1;
+                multipleIndex += dist7;
+      }
     }
 
-    while (multipleIndex0 < sieveSize) unsetBit(sieve, sievingPrime0, &multipleIndex0, &wheelIndex0);
-    while (multipleIndex1 < sieveSize) unsetBit(sieve, sievingPrime1, &multipleIndex1, &wheelIndex1);
-    while (multipleIndex2 < sieveSize) unsetBit(sieve, sievingPrime2, &multipleIndex2, &wheelIndex2);
+    out:
+    multipleIndex -= sieveSize;
+    prime.set(multipleIndex, wheelIndex);
+  }
+}
+
+/// Cross-off the multiples of the sieving primes
+/// with prime % 30 == 23. The 8 wheel steps are
+/// hardcoded (bitmask, stride), see wheel30 in
+/// Wheel.cpp.
+///
+PRIMESIEVE_MULTIARCH
+void EratMedium::crossOff_23(byte_t* sieve,
+                             uint64_t sieveSize,
+                             vector<SievingPrime>& primes)
+{
+  for (auto& prime : primes)
+  {
+    uint64_t sievingPrime  = prime.getSievingPrime();
+    uint64_t multipleIndex = prime.getMultipleIndex();
+    uint64_t wheelIndex    = prime.getWheelIndex();
+
+    uint64_t dist0 = sievingPrime * 6 + 5;
+    uint64_t dist1 = sievingPrime * 4 + 3;
+    uint64_t dist2 = sievingPrime * 2 + 1;
+    uint64_t dist3 = sievingPrime * 4 + 3;
+    uint64_t dist4 = sievingPrime * 2 + 2;
+    uint64_t dist5 = sievingPrime * 4 + 3;
+    uint64_t dist6 = sievingPrime * 6 + 5;
+    uint64_t dist7 = sievingPrime * 2 + 1;
 
-    multipleIndex0 -= sieveSize;
-    multipleIndex1 -= sieveSize;
-    multipleIndex2 -= sieveSize;
+    uint64_t off1 = dist0;
+    uint64_t off2 = off1 + dist1;
+    uint64_t off3 = off2 + dist2;
+    uint64_t off4 = off3 + dist3;
+    uint64_t off5 = off4 + dist4;
+    uint64_t off6 = off5 + dist5;
+    uint64_t off7 = off6 + dist6;
+    uint64_t loopDist = off7 + dist7;
+    uint64_t loopLimit = (sieveSize > off7) ? sieveSize - off7 : 0;
 
-    primes[i + 0].set(multipleIndex0, wheelIndex0);
-    primes[i + 1].set(multipleIndex1, wheelIndex1);
-    primes[i + 2].set(multipleIndex2, wheelIndex2);
+    switch (wheelIndex)
+    {
+      for (;;)
+      {
+        case 0: // each fast loop iteration removes the next 8
+                // multiples of the sievingPrime without any
+                // per-multiple bounds checks
+                for (; multipleIndex < loopLimit; multipleIndex += loopDist)
+                {
+                  sieve[multipleIndex] &= BIT5;
+                  sieve[multipleIndex + off1] &= BIT1;
+                  sieve[multipleIndex + off2] &= BIT2;
+                  sieve[multipleIndex + off3] &= BIT6;
+                  sieve[multipleIndex + off4] &= BIT7;
+                  sieve[multipleIndex + off5] &= BIT3;
+                  sieve[multipleIndex + off6] &= BIT4;
+                  sieve[multipleIndex + off7] &= BIT0;
+                }
+                if (multipleIndex >= sieveSize) { wheelIndex = 0; goto out; }
+                sieve[multipleIndex] &= BIT5;
+                multipleIndex += dist0;
+                // fallthrough
+        case 1: if (multipleIndex >= sieveSize) { wheelIndex = 1; goto out; }
+                sieve[multipleIndex] &= BIT1;
+                multipleIndex += dist1;
+                // fallthrough
+        case 2: if (multipleIndex >= sieveSize) { wheelIndex = 2; goto out; }
+                sieve[multipleIndex] &= BIT2;
+                multipleIndex += dist2;
+                // fallthrough
+        case 3: if (multipleIndex >= sieveSize) { wheelIndex = 3; goto out; }
+                sieve[multipleIndex] &= BIT6;
+                multipleIndex += dist3;
+                // fallthrough
+        case 4: if (multipleIndex >= sieveSize) { wheelIndex = 4; goto out; }
+                sieve[multipleIndex] &= BIT7;
+                multipleIndex += dist4;
+                // fallthrough
+        case 5: if (multipleIndex >= sieveSize) { wheelIndex = 5; goto out; }
+                sieve[multipleIndex] &= BIT3;
+                multipleIndex += dist5;
+                // fallthrough
+        case 6: if (multipleIndex >= sieveSize) { wheelIndex = 6; goto out; }
+                sieve[multipleIndex] &= BIT4;
+                multipleIndex += dist6;
+                // fallthrough
+        case 7: if (multipleIndex >= sieveSize) { wheelIndex = 7; goto out; }
+                sieve[multipleIndex] &= BIT0;
+                multipleIndex += dist7;
+      }
+    }
+
+    out:
+    multipleIndex -= sieveSize;
+    prime.set(multipleIndex, wheelIndex);
   }
+}
 
-  // process remaining sieving primes
-  for (; i < size; i++)
+/// Cross-off the multiples of the sieving primes
+/// with prime % 30 == 29. The 8 wheel steps are
+/// hardcoded (bitmask, stride), see wheel30 in
+/// Wheel.cpp.
+///
+PRIMESIEVE_MULTIARCH
+void EratMedium::crossOff_29(byte_t* sieve,
+                             uint64_t sieveSize,
+                             vector<SievingPrime>& primes)
+{
+  for (auto& prime : primes)
   {
-    uint64_t multipleIndex = primes[i].getMultipleIndex();
-    uint64_t wheelIndex    = primes[i].getWheelIndex();
-    uint64_t sievingPrime  = primes[i].getSievingPrime();
+    uint64_t sievingPrime  = prime.getSievingPrime();
+    uint64_t multipleIndex = prime.getMultipleIndex();
+    uint64_t wheelIndex    = prime.getWheelIndex();
 
-    while (multipleIndex < sieveSize)
-      unsetBit(sieve, sievingPrime, &multipleIndex, &wheelIndex);
+    uint64_t dist0 = sievingPrime * 6 + 6;
+    uint64_t dist1 = sievingPrime * 4 + 4;
+    uint64_t dist2 = sievingPrime * 2 + 2;
+    uint64_t dist3 = sievingPrime * 4 + 4;
+    uint64_t dist4 = sievingPrime * 2 + 2;
+    uint64_t dist5 = sievingPrime * 4 + 4;
+    uint64_t dist6 = sievingPrime * 6 + 5;
+    uint64_t dist7 = sievingPrime * 2 + 2;
+
+    uint64_t off1 = dist0;
+    uint64_t off2 = off1 + dist1;
+    uint64_t off3 = off2 + dist2;
+    uint64_t off4 = off3 + dist3;
+    uint64_t off5 = off4 + dist4;
+    uint64_t off6 = off5 + dist5;
+    uint64_t off7 = off6 + dist6;
+    uint64_t loopDist = off7 + dist7;
+    uint64_t loopLimit = (sieveSize > off7) ? sieveSize - off7 : 0;
+
+    switch (wheelIndex)
+    {
+      for (;;)
+      {
+        case 0: // each fast loop iteration removes the next 8
+                // multiples of the sievingPrime without any
+                // per-multiple bounds checks
+                for (; multipleIndex < loopLimit; multipleIndex += loopDist)
+                {
+                  sieve[multipleIndex] &= BIT6;
+                  sieve[multipleIndex + off1] &= BIT5;
+                  sieve[multipleIndex + off2] &= BIT4;
+                  sieve[multipleIndex + off3] &= BIT3;
+                  sieve[multipleIndex + off4] &= BIT2;
+                  sieve[multipleIndex + off5] &= BIT1;
+                  sieve[multipleIndex + off6] &= BIT0;
+                  sieve[multipleIndex + off7] &= BIT7;
+                }
+                if (multipleIndex >= sieveSize) { wheelIndex = 0; goto out; }
+                sieve[multipleIndex] &= BIT6;
+                multipleIndex += dist0;
+                // fallthrough
+        case 1: if (multipleIndex >= sieveSize) { wheelIndex = 1; goto out; }
+                sieve[multipleIndex] &= BIT5;
+                multipleIndex += dist1;
+                // fallthrough
+        case 2: if (multipleIndex >= sieveSize) { wheelIndex = 2; goto out; }
+                sieve[multipleIndex] &= BIT4;
+                multipleIndex += dist2;
+                // fallthrough
+        case 3: if (multipleIndex >= sieveSize) { wheelIndex = 3; goto out; }
+                sieve[multipleIndex] &= BIT3;
+                multipleIndex += dist3;
+                // fallthrough
+        case 4: if (multipleIndex >= sieveSize) { wheelIndex = 4; goto out; }
+                sieve[multipleIndex] &= BIT2;
+                multipleIndex += dist4;
+                // fallthrough
+        case 5: if (multipleIndex >= sieveSize) { wheelIndex = 5; goto out; }
+                sieve[multipleIndex] &= BIT1;
+                multipleIndex += dist5;
+                // fallthrough
+        case 6: if (multipleIndex >= sieveSize) { wheelIndex = 6; goto out; }
+                sieve[multipleIndex] &= BIT0;
+                multipleIndex += dist6;
+                // fallthrough
+        case 7: if (multipleIndex >= sieveSize) { wheelIndex = 7; goto out; }
+                sieve[multipleIndex] &= BIT7;
+                multipleIndex += dist7;
+      }
+    }
+
+    out:
+    multipleIndex -= sieveSize;
+    prime.set(multipleIndex, wheelIndex);
+  }
+}
+
+/// Cross-off the multiples of the sieving primes
+/// with prime % 30 == 1. The 8 wheel steps are
+/// hardcoded (bitmask, stride), see wheel30 in
+/// Wheel.cpp.
+///
+PRIMESIEVE_MULTIARCH
+void EratMedium::crossOff_1(byte_t* sieve,
+                            uint64_t sieveSize,
+                            vector<SievingPrime>& primes)
+{
+  for (auto& prime : primes)
+  {
+    uint64_t sievingPrime  = prime.getSievingPrime();
+    uint64_t multipleIndex = prime.getMultipleIndex();
+    uint64_t wheelIndex    = prime.getWheelIndex();
+
+    uint64_t dist0 = sievingPrime * 6 + 1;
+    uint64_t dist1 = sievingPrime * 4 + 0;
+    uint64_t dist2 = sievingPrime * 2 + 0;
+    uint64_t dist3 = sievingPrime * 4 + 0;
+    uint64_t dist4 = sievingPrime * 2 + 0;
+    uint64_t dist5 = sievingPrime * 4 + 0;
+    uint64_t dist6 = sievingPrime * 6 + 0;
+    uint64_t dist7 = sievingPrime * 2 + 0;
+
+    uint64_t off1 = dist0;
+    uint64_t off2 = off1 + dist1;
+    uint64_t off3 = off2 + dist2;
+    uint64_t off4 = off3 + dist3;
+    uint64_t off5 = off4 + dist4;
+    uint64_t off6 = off5 + dist5;
+    uint64_t off7 = off6 + dist6;
+    uint64_t loopDist = off7 + dist7;
+    uint64_t loopLimit = (sieveSize > off7) ? sieveSize - off7 : 0;
+
+    switch (wheelIndex)
+    {
+      for (;;)
+      {
+        case 0: // each fast loop iteration removes the next 8
+                // multiples of the sievingPrime without any
+                // per-multiple bounds checks
+                for (; multipleIndex < loopLimit; multipleIndex += loopDist)
+                {
+                  sieve[multipleIndex] &= BIT7;
+                  sieve[multipleIndex + off1] &= BIT0;
+                  sieve[multipleIndex + off2] &= BIT1;
+                  sieve[multipleIndex + off3] &= BIT2;
+                  sieve[multipleIndex + off4] &= BIT3;
+                  sieve[multipleIndex + off5] &= BIT4;
+                  sieve[multipleIndex + off6] &= BIT5;
+                  sieve[multipleIndex + off7] &= BIT6;
+                }
+                if (multipleIndex >= sieveSize) { wheelIndex = 0; goto out; }
+                sieve[multipleIndex] &= BIT7;
+                multipleIndex += dist0;
+                // fallthrough
+        case 1: if (multipleIndex >= sieveSize) { wheelIndex = 1; goto out; }
+                sieve[multipleIndex] &= BIT0;
+                multipleIndex += dist1;
+                // fallthrough
+        case 2: if (multipleIndex >= sieveSize) { wheelIndex = 2; goto out; }
+                sieve[multipleIndex] &= BIT1;
+                multipleIndex += dist2;
+                // fallthrough
+        case 3: if (multipleIndex >= sieveSize) { wheelIndex = 3; goto out; }
+                sieve[multipleIndex] &= BIT2;
+                multipleIndex += dist3;
+                // fallthrough
+        case 4: if (multipleIndex >= sieveSize) { wheelIndex = 4; goto out; }
+                sieve[multipleIndex] &= BIT3;
+                multipleIndex += dist4;
+                // fallthrough
+        case 5: if (multipleIndex >= sieveSize) { wheelIndex = 5; goto out; }
+                sieve[multipleIndex] &= BIT4;
+                multipleIndex += dist5;
+                // fallthrough
+        case 6: if (multipleIndex >= sieveSize) { wheelIndex = 6; goto out; }
+                sieve[multipleIndex] &= BIT5;
+                multipleIndex += dist6;
+                // fallthrough
+        case 7: if (multipleIndex >= sieveSize) { wheelIndex = 7; goto out; }
+                sieve[multipleIndex] &= BIT6;
+                multipleIndex += dist7;
+      }
+    }
 
+    out:
     multipleIndex -= sieveSize;
-    primes[i].set(multipleIndex, wheelIndex);
+    prime.set(multipleIndex, wheelIndex);
   }
 }
 
@@ -1,7 +1,11 @@
 ///
 /// @file   EratSmall.cpp
 /// @brief  Segmented sieve of Eratosthenes optimized for
-///         small sieving primes.
+///         small sieving primes. The unrolled crossOff loops
+///         hardcode all bitmasks and strides of the modulo 30
+///         wheel, the inner loop hence reads no wheel tables
+///         at all and the sieve array has the L1 cache to
+///         itself.
 ///
 /// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
 ///
@@ -10,6 +14,7 @@
 ///
 
 #include <primesieve/bits.hpp>
+#include <primesieve/multiarch.hpp>
 #include <primesieve/Bucket.hpp>
 #include <primesieve/CpuInfo.hpp>
 #include <primesieve/EratSmall.hpp>
@@ -92,6 +97,7 @@ void EratSmall::crossOff(byte_t* sieve, uint64_t sieveSize)
 /// per segment. This algorithm uses a hardcoded modulo 30
 /// wheel that skips multiples of 2, 3 and 5
 ///
+PRIMESIEVE_MULTIARCH
 void EratSmall::crossOff(byte_t* sieve, byte_t* sieveEnd)
 {
   for (auto& prime : primes_)
@@ -0,0 +1,201 @@
+///
+/// @file   GapFinder.cpp
+/// @brief  Find large gaps between consecutive primes by scanning
+///         the sieved segments in the bit domain. All-zero 64-bit
+///         words (240 numbers) are skipped with a single compare
+///         and the primes of a word are decoded only if the word
+///         can contain a qualifying gap, which is much faster
+///         than generating all primes and diffing neighbors.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve.hpp>
+#include <primesieve/Erat.hpp>
+#include <primesieve/littleendian_cast.hpp>
+#include <primesieve/pmath.hpp>
+#include <primesieve/PreSieve.hpp>
+#include <primesieve/SievingPrimes.hpp>
+#include <primesieve/types.hpp>
+
+#include <stdint.h>
+#include <algorithm>
+#include <vector>
+
+using namespace std;
+using namespace primesieve;
+
+namespace {
+
+/// Numbers corresponding to the bits of a sieve byte
+const uint64_t bitValues[8] = { 7, 11, 13, 17, 19, 23, 29, 31 };
+
+/// Count trailing zeros, x must be != 0
+uint64_t ctz64(uint64_t x)
+{
+#if defined(__GNUC__) || \
+    defined(__clang__)
+  return (uint64_t) __builtin_ctzll(x);
+#else
+  // portable fallback: the number of 1 bits below
+  // the lowest set bit equals the number of
+  // trailing zeros
+  x = (x & (~x + 1)) - 1;
+  const uint64_t m1 = 0x5555555555555555ull;
+  const uint64_t m2 = 0x3333333333333333ull;
+  const uint64_t m4 = 0x0F0F0F0F0F0F0F0Full;
+  const uint64_t h01 = 0x0101010101010101ull;
+
+  x -= (x >> 1) & m1;
+  x = (x & m2) + ((x >> 2) & m2);
+  x = (x + (x >> 4)) & m4;
+  return (x * h01) >> 56;
+#endif
+}
+
+/// Number corresponding to bit k of a 64-bit
+/// sieve word (8 bytes = 240 numbers)
+///
+uint64_t bitValue(uint64_t k)
+{
+  return (k >> 3) * 30 + bitValues[k & 7];
+}
+
+/// Finds the gaps >= minGap between consecutive primes
+/// within [start, stop] by scanning the sieve array one
+/// 64-bit word at a time
+///
+class GapFinder : public Erat
+{
+public:
+  void find(uint64_t start,
+            uint64_t stop,
+            uint64_t minGap,
+            bool recordGaps,
+            vector<PrimeGap>& gaps)
+  {
+    minGap = max<uint64_t>(1, minGap);
+
+    // primes <= 5 are not sieved
+    for (uint64_t p : { 2ull, 3ull, 5ull })
+      if (p >= start && p <= stop)
+        foundPrime(p, minGap, recordGaps, gaps);
+
+    start = max<uint64_t>(start, 7);
+    if (start > stop)
+      return;
+
+    PreSieve preSieve(start, stop);
+    init(start, stop, get_sieve_size(), preSieve);
+    SievingPrimes sievingPrimes(this, preSieve);
+    uint64_t prime = sievingPrimes.next();
+
+    while (hasNextSegment())
+    {
+      low_ = segmentLow_;
+      uint64_t sqrtHigh = isqrt(segmentHigh_);
+
+      for (; prime <= sqrtHigh; prime = sievingPrimes.next())
+        addSievingPrime(prime);
+
+      sieveSegment();
+      scan(minGap, recordGaps, gaps);
+    }
+  }
+
+private:
+  uint64_t low_ = 0;
+  uint64_t prevPrime_ = 0;
+
+  /// Record the gap between the previous prime and
+  /// prime if it qualifies. In record mode each gap
+  /// found raises minGap, so only successively
+  /// larger (record) gaps are stored.
+  ///
+  void foundPrime(uint64_t prime,
+                  uint64_t& minGap,
+                  bool recordGaps,
+                  vector<PrimeGap>& gaps)
+  {
+    if (prevPrime_ &&
+        prime - prevPrime_ >= minGap)
+    {
+      gaps.push_back({ prevPrime_, prime });
+      if (recordGaps)
+        minGap = (prime - prevPrime_) + 1;
+    }
+
+    prevPrime_ = prime;
+  }
+
+  void scan(uint64_t& minGap,
+            bool recordGaps,
+            vector<PrimeGap>& gaps)
+  {
+    for (uint64_t i = 0; i < sieveSize_; i += 8, low_ += 8 * 30)
+    {
+      uint64_t bits = littleendian_cast<uint64_t>(&sieve_[i]);
+
+      // one compare skips 240 numbers, inside large
+      // prime gaps this is the only work done
+      if (bits == 0)
+        continue;
+
+      // gap between the previous prime (possibly many
+      // words or segments back) and the first prime of
+      // this word. Erat zeroes the bits outside
+      // [start, stop], they cannot produce false primes.
+      foundPrime(low_ + bitValue(ctz64(bits)), minGap, recordGaps, gaps);
+
+      // the numbers of one word span less than 240,
+      // its interior gaps need decoding only if
+      // minGap is small enough to occur inside
+      uint64_t interior = bits & (bits - 1);
+
+      if (interior == 0)
+        continue;
+
+      if (minGap <= 240)
+      {
+        do
+        {
+          uint64_t k = ctz64(interior);
+          interior &= interior - 1;
+          foundPrime(low_ + bitValue(k), minGap, recordGaps, gaps);
+        }
+        while (interior);
+      }
+      else
+        prevPrime_ = low_ + bitValue(ilog2(bits));
+    }
+  }
+};
+
+} // namespace
+
+namespace primesieve {
+
+vector<PrimeGap> find_prime_gaps(uint64_t start, uint64_t stop, uint64_t minGap)
+{
+  vector<PrimeGap> gaps;
+  GapFinder finder;
+  finder.find(start, stop, minGap, false, gaps);
+  return gaps;
+}
+
+PrimeGap max_prime_gap(uint64_t start, uint64_t stop)
+{
+  vector<PrimeGap> records;
+  GapFinder finder;
+  finder.find(start, stop, 1, true, records);
+
+  if (records.empty())
+    return { 0, 0 };
+
+  return records.back();
+}
+
+} // namespace
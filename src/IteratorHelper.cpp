@@ -23,11 +23,12 @@ using namespace primesieve;
 
 namespace {
 
-uint64_t getNextDist(uint64_t n, uint64_t dist)
+uint64_t getNextDist(uint64_t n, uint64_t dist, uint64_t totalPrimes, uint64_t maxCacheBytes)
 {
   double x = (double) n;
   x = max(x, 16.0);
-  x = sqrt(x) / log(log(x));
+  double logx = log(x);
+  x = sqrt(x) / log(logx);
 
   uint64_t minDist = (uint64_t) x;
   uint64_t limit = numeric_limits<uint64_t>::max() / 4;
@@ -36,16 +37,44 @@ uint64_t getNextDist(uint64_t n, uint64_t dist)
   if (dist < limit)
     dist *= 4;
 
+  if (totalPrimes > 0)
+  {
+    // Size the next window from the caller's observed
+    // consumption: a window that yields about 3x the
+    // primes consumed so far keeps the refill count
+    // logarithmic for heavy consumers while light
+    // consumers stop sieving far past their needs.
+    // Inverse of prime_count_approx() in StorePrimes.hpp:
+    // pi(a + d) - pi(a) ~= d / (log(a) - 1.1)
+    double primesDist = totalPrimes * 3 * (logx - 1.1);
+    primesDist = min(primesDist, (double) limit);
+    dist = inBetween(minDist, (uint64_t) primesDist, dist);
+  }
+
+  // translate the cache limit in bytes into a sieving
+  // distance using pi(a + d) - pi(a) ~= d / (log(a) - 1.1)
+  if (maxCacheBytes == 0)
+    maxCacheBytes = config::MAX_CACHE_ITERATOR;
+  double maxPrimes = (double) maxCacheBytes / sizeof(uint64_t);
+  double maxCacheDist = maxPrimes * (logx - 1.1);
+  if ((double) dist > maxCacheDist)
+    dist = max(minDist, (uint64_t) maxCacheDist);
+
   return dist;
 }
 
-uint64_t getPrevDist(uint64_t n, uint64_t* dist)
+uint64_t getPrevDist(uint64_t n, uint64_t* dist, uint64_t minCacheBytes, uint64_t maxCacheBytes)
 {
   double x = (double) n;
   x = max(x, 10.0);
 
-  double minDist = config::MIN_CACHE_ITERATOR;
-  double maxDist = config::MAX_CACHE_ITERATOR;
+  if (minCacheBytes == 0)
+    minCacheBytes = config::MIN_CACHE_ITERATOR;
+  if (maxCacheBytes == 0)
+    maxCacheBytes = config::MAX_CACHE_ITERATOR;
+
+  double minDist = (double) minCacheBytes;
+  double maxDist = (double) maxCacheBytes;
   double logx = log(x);
 
   minDist *= logx;
@@ -89,10 +118,12 @@ namespace primesieve {
 void IteratorHelper::next(uint64_t* start,
                           uint64_t* stop,
                           uint64_t stopHint,
-                          uint64_t* dist)
+                          uint64_t* dist,
+                          uint64_t totalPrimes,
+                          uint64_t maxCacheBytes)
 {
   *start = checkedAdd(*stop, 1);
-  *dist = getNextDist(*start, *dist);
+  *dist = getNextDist(*start, *dist, totalPrimes, maxCacheBytes);
   *stop = checkedAdd(*start, *dist);
 
   if (useStopHint(*start, stopHint))
@@ -102,10 +133,12 @@ void IteratorHelper::next(uint64_t* start,
 void IteratorHelper::prev(uint64_t* start,
                           uint64_t* stop,
                           uint64_t stopHint,
-                          uint64_t* dist)
+                          uint64_t* dist,
+                          uint64_t minCacheBytes,
+                          uint64_t maxCacheBytes)
 {
   *stop = checkedSub(*start, 1);
-  uint64_t prevDist = getPrevDist(*stop, dist);
+  uint64_t prevDist = getPrevDist(*stop, dist, minCacheBytes, maxCacheBytes);
   *start = checkedSub(*stop, prevDist);
 
   if (useStopHint(*start, *stop, stopHint))
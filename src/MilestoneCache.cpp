@@ -0,0 +1,134 @@
+///
+/// @file   MilestoneCache.cpp
+/// @brief  Optional on-disk cache of exact (x, pi(x)) pairs,
+///         see MilestoneCache.hpp.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve/MilestoneCache.hpp>
+#include <primesieve/primesieve_error.hpp>
+#include <primesieve/replaceFile.hpp>
+
+#include <stdint.h>
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+using namespace std;
+
+namespace {
+
+const string magic = "primesieve-milestones";
+
+} // namespace
+
+namespace primesieve {
+
+MilestoneCache& MilestoneCache::getInstance()
+{
+  static MilestoneCache cache;
+  return cache;
+}
+
+/// Lazily reads the milestone file on first use. The cache
+/// stays disabled unless the PRIMESIEVE_MILESTONES
+/// environment variable is set to a file path. A missing
+/// file is not an error, it is created by store().
+///
+void MilestoneCache::init()
+{
+  initialized_ = true;
+
+  const char* path = getenv("PRIMESIEVE_MILESTONES");
+  if (!path)
+    return;
+
+  path_ = path;
+  enabled_ = true;
+
+  ifstream file(path_);
+  if (!file)
+    return;
+
+  string str;
+  if (!(file >> str) || str != magic)
+    throw primesieve_error("invalid milestone file: " + path_);
+
+  Milestone m;
+  while (file >> m.x >> m.count)
+    milestones_.push_back(m);
+
+  if (!is_sorted(milestones_.begin(), milestones_.end(),
+      [](const Milestone& a, const Milestone& b) { return a.x < b.x; }))
+    throw primesieve_error("invalid milestone file: " + path_);
+}
+
+/// Write the milestones to a temporary file first, then
+/// rename it over the old file. A crash can hence never
+/// leave a truncated milestone file behind.
+///
+void MilestoneCache::write()
+{
+  string tmp = path_ + ".tmp";
+  {
+    ofstream file(tmp, ofstream::trunc);
+    file << magic << '\n';
+    for (const Milestone& m : milestones_)
+      file << m.x << ' ' << m.count << '\n';
+
+    if (!file)
+      throw primesieve_error("failed to write " + tmp);
+  }
+
+  if (!replaceFile(tmp, path_))
+    throw primesieve_error("failed to update " + path_);
+}
+
+bool MilestoneCache::lookup(uint64_t stop, uint64_t& x, uint64_t& count)
+{
+  lock_guard<mutex> guard(lock_);
+
+  if (!initialized_)
+    init();
+  if (!enabled_)
+    return false;
+
+  // largest milestone with x <= stop
+  auto iter = upper_bound(milestones_.begin(), milestones_.end(), stop,
+      [](uint64_t n, const Milestone& m) { return n < m.x; });
+
+  if (iter == milestones_.begin())
+    return false;
+
+  iter--;
+  x = iter->x;
+  count = iter->count;
+  return true;
+}
+
+void MilestoneCache::store(uint64_t x, uint64_t count)
+{
+  lock_guard<mutex> guard(lock_);
+
+  if (!initialized_)
+    init();
+  if (!enabled_)
+    return;
+
+  auto iter = lower_bound(milestones_.begin(), milestones_.end(), x,
+      [](const Milestone& m, uint64_t n) { return m.x < n; });
+
+  if (iter != milestones_.end() &&
+      iter->x == x)
+    return;
+
+  milestones_.insert(iter, Milestone{ x, count });
+  write();
+}
+
+} // namespace
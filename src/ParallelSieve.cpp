@@ -8,20 +8,32 @@
 /// file in the top level directory.
 ///
 
+#include <primesieve.hpp>
 #include <primesieve/config.hpp>
+#include <primesieve/CpuInfo.hpp>
 #include <primesieve/ParallelSieve.hpp>
 #include <primesieve/PrimeSieve.hpp>
+#include <primesieve/SievingPrimesCache.hpp>
+#include <primesieve/ThreadPool.hpp>
 #include <primesieve/pmath.hpp>
+#include <primesieve/tracepoints.hpp>
 
 #include <stdint.h>
 #include <algorithm>
 #include <atomic>
 #include <cassert>
 #include <chrono>
+#include <exception>
 #include <future>
-#include <mutex>
 #include <vector>
 
+#if defined(_WIN32)
+  #include <windows.h>
+#elif defined(__linux__)
+  #include <pthread.h>
+  #include <sched.h>
+#endif
+
 using namespace std;
 using namespace primesieve;
 
@@ -34,13 +46,31 @@ counts_t& operator+=(counts_t& v1, const counts_t& v2)
   return v1;
 }
 
+/// Pin the calling thread to the given CPU core.
+/// On unsupported OSes this is a no-op, sieving
+/// then runs correctly but without pinning.
+///
+void pinThread(int cpu)
+{
+#if defined(_WIN32)
+  SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR) 1 << cpu);
+#elif defined(__linux__)
+  cpu_set_t cpuSet;
+  CPU_ZERO(&cpuSet);
+  CPU_SET(cpu, &cpuSet);
+  pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet);
+#else
+  (void) cpu;
+#endif
+}
+
 } // namespace
 
 namespace primesieve {
 
 ParallelSieve::ParallelSieve() :
   shm_(nullptr),
-  numThreads_(getMaxThreads())
+  numThreads_(getDefaultNumThreads())
 { }
 
 void ParallelSieve::init(SharedMemory& shm)
@@ -59,6 +89,22 @@ int ParallelSieve::getMaxThreads()
   return max(1, maxThreads);
 }
 
+/// By default use 1 thread per physical CPU core. Sieving
+/// is ALU and cache bound, 2 SMT siblings compete for the
+/// same execution units and L1 cache and run slower than a
+/// single thread per core. setNumThreads() can still raise
+/// the thread count up to getMaxThreads().
+///
+int ParallelSieve::getDefaultNumThreads()
+{
+  int threads = (int) cpuInfo.cpuCores();
+
+  if (!cpuInfo.hasCpuCores())
+    threads = getMaxThreads();
+
+  return inBetween(1, threads, getMaxThreads());
+}
+
 int ParallelSieve::getNumThreads() const
 {
   return numThreads_;
@@ -69,6 +115,21 @@ void ParallelSieve::setNumThreads(int threads)
   numThreads_ = inBetween(1, threads, getMaxThreads());
 }
 
+/// Pin the i-th sieving thread to cpus[i % cpus.size()].
+/// An empty vector disables pinning (default). On NUMA
+/// systems pinning the threads to the cores of one node
+/// avoids thread migration and remote memory accesses.
+///
+void ParallelSieve::setCpuAffinity(const std::vector<int>& cpus)
+{
+  cpuAffinity_ = cpus;
+}
+
+const std::vector<double>& ParallelSieve::getThreadSeconds() const
+{
+  return threadSeconds_;
+}
+
 /// Get an ideal number of threads for
 /// the start_ and stop_ numbers
 ///
@@ -105,6 +166,41 @@ uint64_t ParallelSieve::getThreadDistance(int threads) const
   return threadDistance;
 }
 
+/// Get the next chunk [low, high] to be sieved. The chunk
+/// size shrinks geometrically as the threads approach
+/// stop_ which prevents a straggling last chunk without
+/// making the chunks so small that the per-chunk sieving
+/// primes initialization dominates.
+///
+bool ParallelSieve::getWork(std::atomic<uint64_t>& low,
+                            int threads,
+                            uint64_t* chunkLow,
+                            uint64_t* chunkHigh) const
+{
+  uint64_t balanced = isqrt(stop_) * 1000;
+  uint64_t oldLow = low.load();
+  uint64_t newLow;
+
+  do
+  {
+    if (oldLow >= stop_)
+      return false;
+
+    uint64_t remaining = stop_ - oldLow;
+    uint64_t chunk = remaining / (threads * 4);
+    chunk = min(chunk, balanced);
+    chunk = max(chunk, config::MIN_THREAD_DISTANCE);
+    chunk += 30 - chunk % 30;
+    newLow = checkedAdd(oldLow, chunk);
+    newLow = min(newLow, stop_);
+  }
+  while (!low.compare_exchange_weak(oldLow, newLow));
+
+  *chunkLow = oldLow;
+  *chunkHigh = newLow;
+  return true;
+}
+
 /// Align n to modulo (30 + 2) to prevent prime k-tuplet
 /// (twin primes, prime triplets) gaps
 ///
@@ -124,6 +220,11 @@ uint64_t ParallelSieve::align(uint64_t n) const
 void ParallelSieve::sieve()
 {
   reset();
+  statusThreads_ = 0;
+  aggregatedProcessed_ = 0;
+  extraProcessed_ = 0;
+
+  threadSeconds_.clear();
 
   if (start_ > stop_)
     return;
@@ -135,43 +236,142 @@ void ParallelSieve::sieve()
   else
   {
     auto t1 = chrono::system_clock::now();
-    uint64_t threadDistance = getThreadDistance(threads);
-    uint64_t iters = ((getDistance() - 1) / threadDistance) + 1;
-    threads = inBetween(1, threads, iters);
-    atomic<uint64_t> i(0);
+
+    // sieve the sieving primes bitmap once using all
+    // threads, the workers then copy their sieving primes
+    // from it instead of each sieving up to sqrt(stop)
+    SievingPrimesCache::getInstance().preGenerate(isqrt(stop_), threads);
+
+    // the shared chunk cursor gets its own cache line so
+    // its CAS traffic does not invalidate neighbouring
+    // stack data used by the main thread
+    alignas(64) atomic<uint64_t> low(start_);
+
+    // 1 cache-line-padded slot per thread holding its
+    // counts and progress counter, the threads update only
+    // their own slot lock-free during sieving and whoever
+    // prints the status aggregates the counters
+    threadSlots_.reset(new ThreadSlot[threads]);
+    statusThreads_ = threads;
+    aggregatedProcessed_ = 0;
+    for (int t = 0; t < threads; t++)
+      threadSlots_[t].processed.store(0, memory_order_relaxed);
+
+    // with a GUI attached the progress counters live in the
+    // shared memory segment so the GUI process can sample
+    // them directly, at zero cost to the sieving threads
+    int shmThreads = 0;
+    if (shm_)
+    {
+      shmThreads = min(threads, (int) MAX_STATUS_THREADS);
+      shm_->statusThreads = shmThreads;
+      for (int t = 0; t < shmThreads; t++)
+        shm_->processed[t].processed.store(0, memory_order_relaxed);
+    }
 
     // each thread executes 1 task
-    auto task = [&]()
+    auto task = [&](int t, ThreadSlot& slot)
     {
+      if (!cpuAffinity_.empty())
+        pinThread(cpuAffinity_[t % cpuAffinity_.size()]);
+
+      auto threadStart = chrono::system_clock::now();
       PrimeSieve ps(this);
-      uint64_t j;
-      counts_t counts;
-      counts.fill(0);
 
-      while ((j = i++) < iters)
+      // Hybrid CPUs (e.g. P/E cores) have asymmetric
+      // per-core caches: re-derive the default sieve size
+      // on this worker's own core so E-core workers get
+      // segments that fit their smaller caches. A sieve
+      // size set explicitly by the user is left alone.
+      if (ps.isDefaultSieveSize() &&
+          cpuInfo.hasAsymmetricCaches())
+        ps.setSieveSize(get_sieve_size());
+      ps.setStatusCounter(t < shmThreads
+          ? &shm_->processed[t].processed : &slot.processed);
+      uint64_t chunkLow;
+      uint64_t chunkHigh;
+      slot.counts.fill(0);
+
+      while (getWork(low, threads, &chunkLow, &chunkHigh))
       {
-        uint64_t start = start_ + j * threadDistance;
-        uint64_t stop = checkedAdd(start, threadDistance);
-        stop = align(stop);
-        if (start > start_)
-          start = align(start) + 1;
-
-        // sieve the range [start, stop]
-        ps.sieve(start, stop);
-        counts += ps.getCounts();
+        PRIMESIEVE_PROBE3(chunk_claim, t, chunkLow, chunkHigh);
+        uint64_t start = chunkLow;
+        uint64_t stop = chunkHigh;
+
+        if (isPrint())
+        {
+          // printing has no chunk overlap, align the chunk
+          // boundaries so no k-tuplet spans two chunks
+          stop = (chunkHigh < stop_) ? align(chunkHigh) : stop_;
+          if (start > start_)
+            start = align(start) + 1;
+          ps.setCountStop(stop);
+          ps.sieve(start, stop);
+        }
+        else
+        {
+          // arbitrary chunk boundaries: sieve 16 numbers
+          // past the chunk so that k-tuplets spanning the
+          // boundary are counted by the chunk containing
+          // their first prime
+          if (start > start_)
+            start += 1;
+          uint64_t sieveStop = stop;
+          if (stop < stop_)
+            sieveStop = min(checkedAdd(stop, 16), stop_);
+          ps.setCountStop(stop);
+          ps.sieve(start, sieveStop);
+        }
+
+        slot.counts += ps.getCounts();
+        PRIMESIEVE_PROBE3(chunk_complete, t, chunkLow, chunkHigh);
       }
 
-      return counts;
+      chrono::duration<double> elapsed = chrono::system_clock::now() - threadStart;
+      slot.seconds = elapsed.count();
     };
 
-    vector<future<counts_t>> futures;
+    // the tasks run on the persistent thread pool
+    // whose threads are reused across sieve() calls
+    ThreadPool& threadPool = ThreadPool::getInstance();
+    vector<future<void>> futures;
     futures.reserve(threads);
 
     for (int t = 0; t < threads; t++)
-      futures.emplace_back(async(launch::async, task));
+      futures.emplace_back(threadPool.submit([&, t] { task(t, threadSlots_[t]); }));
+
+    // Drain all futures before propagating an exception.
+    // Unlike std::async futures the thread pool's
+    // packaged_task futures do not join in their
+    // destructor: if the first get() threw (cancellation,
+    // bad_alloc) the remaining workers would still be
+    // running and still referencing this stack frame (the
+    // low cursor and the task lambda) while sieve()
+    // unwinds. Hence wait for all workers, then rethrow
+    // the first exception.
+    exception_ptr workerException;
+
+    for (auto& f : futures)
+    {
+      try
+      {
+        f.get();
+      }
+      catch (...)
+      {
+        if (!workerException)
+          workerException = current_exception();
+      }
+    }
+
+    if (workerException)
+      rethrow_exception(workerException);
 
-    for (auto &f : futures)
-      counts_ += f.get();
+    for (int t = 0; t < threads; t++)
+    {
+      counts_ += threadSlots_[t].counts;
+      threadSeconds_.push_back(threadSlots_[t].seconds);
+    }
 
     auto t2 = chrono::system_clock::now();
     chrono::duration<double> seconds = t2 - t1;
@@ -187,28 +387,43 @@ void ParallelSieve::sieve()
   }
 }
 
-/// Print status in percent to stdout
+/// Print status in percent to stdout. The worker threads
+/// bump their own padded counter lock-free, this method
+/// merely aggregates the counters and prints, so only the
+/// printing is serialized and threads that fail to acquire
+/// statusLock_ continue sieving instead of waiting.
 /// @processed:  Sum of recently processed segments
 /// @tryLock:    Do not block if tryLock = true
 ///
 bool ParallelSieve::updateStatus(uint64_t processed, bool tryLock)
 {
-  unique_lock<mutex> lock(lock_, defer_lock);
+  while (statusLock_.test_and_set(memory_order_acquire))
+    if (tryLock)
+      return false;
 
-  if (tryLock)
-    lock.try_lock();
-  else
-    lock.lock();
+  // single-threaded sieving calls this method directly
+  // (without a per-thread counter) and passes deltas
+  extraProcessed_ += processed;
 
-  if (lock.owns_lock())
-  {
-    PrimeSieve::updateStatus(processed);
-    if (shm_)
-      shm_->status = getStatus();
-    return true;
-  }
+  // the counters of the first MAX_STATUS_THREADS threads
+  // live in shared memory when a GUI is attached
+  int shmThreads = 0;
+  if (shm_)
+    shmThreads = std::min(statusThreads_, (int) MAX_STATUS_THREADS);
+
+  uint64_t total = extraProcessed_;
+  for (int t = 0; t < shmThreads; t++)
+    total += shm_->processed[t].processed.load(memory_order_relaxed);
+  for (int t = shmThreads; t < statusThreads_; t++)
+    total += threadSlots_[t].processed.load(memory_order_relaxed);
+
+  PrimeSieve::updateStatus(total - aggregatedProcessed_);
+  aggregatedProcessed_ = total;
+  if (shm_)
+    shm_->status = getStatus();
 
-  return false;
+  statusLock_.clear(memory_order_release);
+  return true;
 }
 
 } // namespace
@@ -0,0 +1,87 @@
+///
+/// @file   PiTable.cpp
+/// @brief  Lookup table of the primes below 2^16,
+///         see PiTable.hpp.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve/PiTable.hpp>
+#include <primesieve/types.hpp>
+
+#include <stdint.h>
+#include <algorithm>
+
+using namespace std;
+
+namespace primesieve {
+
+const PiTable& PiTable::getInstance()
+{
+  static const PiTable piTable;
+  return piTable;
+}
+
+/// Sieve the odd numbers < limit() using a simple
+/// (non-segmented) sieve of Eratosthenes, this takes
+/// only a few microseconds
+///
+PiTable::PiTable()
+{
+  bits_.fill(~0ull);
+
+  // 1 is not a prime
+  bits_[0] &= ~1ull;
+
+  for (uint64_t i = 3; i * i < limit(); i += 2)
+    if (bits_[i / 2 / 64] & (1ull << (i / 2 % 64)))
+      for (uint64_t j = i * i; j < limit(); j += i * 2)
+        bits_[j / 2 / 64] &= ~(1ull << (j / 2 % 64));
+
+  uint64_t count = 0;
+
+  for (size_t i = 0; i < bits_.size(); i++)
+  {
+    counts_[i] = (uint32_t) count;
+    count += popcount(&bits_[i], 1);
+  }
+
+  // + 1 for the prime 2
+  primes_.reserve(count + 1);
+  primes_.push_back(2);
+
+  for (uint64_t n = 3; n < limit(); n += 2)
+    if (bits_[n / 2 / 64] & (1ull << (n / 2 % 64)))
+      primes_.push_back((uint16_t) n);
+}
+
+uint64_t PiTable::pi(uint64_t n) const
+{
+  if (n < 2)
+    return 0;
+
+  // largest odd number <= n
+  // corresponds to bit i of the bitmap
+  uint64_t i = (n - 1) / 2;
+  uint64_t word = bits_[i / 64] & (~0ull >> (63 - i % 64));
+
+  // + 1 for the prime 2
+  return 1 + counts_[i / 64] + popcount(&word, 1);
+}
+
+uint64_t PiTable::countPrimes(uint64_t start, uint64_t stop) const
+{
+  if (start > stop)
+    return 0;
+
+  uint64_t count = pi(stop);
+  if (start > 0)
+    count -= pi(start - 1);
+
+  return count;
+}
+
+} // namespace
@@ -11,6 +11,7 @@
 
 #include <primesieve/PreSieve.hpp>
 #include <primesieve/EratSmall.hpp>
+#include <primesieve/cpuid.hpp>
 #include <primesieve/pmath.hpp>
 #include <primesieve/types.hpp>
 
@@ -18,6 +19,22 @@
 #include <algorithm>
 #include <array>
 #include <memory>
+#include <mutex>
+
+#if defined(HAS_CPU_SUPPORTS)
+  #include <immintrin.h>
+#endif
+
+// C++14 relaxed constexpr allows loops, the pre-sieved
+// buffers are then generated at compile time and live in
+// .rodata: zero init cost and the read-only pages are
+// shared across all processes by the page cache. Older
+// C++11 compilers fall back to generating the buffers
+// at runtime.
+#if defined(__cpp_constexpr) && \
+    __cpp_constexpr >= 201304
+  #define CONSTEXPR_PRESIEVE
+#endif
 
 using namespace std;
 using namespace primesieve;
@@ -30,6 +47,274 @@ const array<uint64_t, 5> primes = { 7, 11, 13, 17, 19 };
 // prime products of primes >= 7
 const array<uint64_t, 5> primeProducts = { 210, 2310, 30030, 510510, 9699690 };
 
+// Primes > 19 are pre-sieved using small per-tier buffers
+// which are combined into the sieve array using a bitwise
+// AND. Each tier's buffer uses primeProduct(tier) bytes,
+// i.e. 667 bytes for {23, 29} up to 2491 bytes for {47, 53}.
+const array<array<uint64_t, 2>, 4> tierPrimes =
+{{
+  {{ 23, 29 }},
+  {{ 31, 37 }},
+  {{ 41, 43 }},
+  {{ 47, 53 }}
+}};
+
+#if defined(CONSTEXPR_PRESIEVE)
+
+/// Numbers corresponding to the bits of a sieve byte
+constexpr uint64_t bitValues[8] = { 7, 11, 13, 17, 19, 23, 29, 31 };
+
+/// Pre-sieved primes, [0, 4] are the wheel buffer
+/// primes and [5, 12] the tier buffer primes
+constexpr uint64_t presievePrimes[13] =
+  { 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53 };
+
+/// Aligned to a 64-byte cache line boundary which
+/// speeds up the copying in presieveCopy()
+template <uint64_t N>
+struct alignas(64) PreSieveBuffer
+{
+  byte_t bytes[N];
+};
+
+/// Remove the multiples of presievePrimes[first, last]
+/// from a buffer of N bytes at compile time. The buffer
+/// is cyclic: byte i covers the numbers
+/// [k + i * 30, k + i * 30 + 30[ for any k that is a
+/// multiple of the prime product N * 30, so a bit is
+/// cleared iff its cycle position is divisible by one
+/// of the primes.
+///
+template <uint64_t N>
+constexpr void crossOff(PreSieveBuffer<N>& buffer, uint64_t prime)
+{
+  // for each wheel offset walk the multiples congruent
+  // to it mod 30, they all map to the same bit so the
+  // inner loop needs no modulo. Multiples at the other
+  // residues mod 30 have no bit in the wheel layout.
+  for (int b = 0; b < 8; b++)
+  {
+    // smallest multiple of prime congruent
+    // to bitValues[b] mod 30
+    uint64_t m = bitValues[b];
+    while (m % prime != 0)
+      m += 30;
+
+    // stepping by 30 * prime advances
+    // the byte index by prime
+    byte_t mask = (byte_t) ~(1u << b);
+
+    for (uint64_t i = (m - bitValues[b]) / 30; i < N; i += prime)
+      buffer.bytes[i] &= mask;
+  }
+}
+
+template <uint64_t N>
+constexpr PreSieveBuffer<N> generateBuffer(int first, int last)
+{
+  PreSieveBuffer<N> buffer{};
+
+  // the fill loop is split into chunks of 2^16 iterations
+  // because GCC limits the iteration count of a single
+  // constexpr loop (-fconstexpr-loop-limit, default 2^18)
+  const uint64_t chunk = 1 << 16;
+
+  for (uint64_t i = 0; i < N; i += chunk)
+    for (uint64_t j = i; j < i + chunk && j < N; j++)
+      buffer.bytes[j] = 0xff;
+
+  for (int j = first; j <= last; j++)
+    crossOff(buffer, presievePrimes[j]);
+
+  return buffer;
+}
+
+/// Extend a pre-sieved buffer to the next prime: the
+/// smaller buffer is copied cyclically (its prime product
+/// divides the larger one) and the multiples of the new
+/// prime are removed. Building the large buffers this way
+/// (instead of crossing off all primes again) stays below
+/// GCC's constexpr operation count limit.
+///
+template <uint64_t N, uint64_t M>
+constexpr PreSieveBuffer<N> extendBuffer(const PreSieveBuffer<M>& base, int j)
+{
+  PreSieveBuffer<N> buffer{};
+
+  for (uint64_t i = 0; i < N; i += M)
+    for (uint64_t k = 0; k < M; k++)
+      buffer.bytes[i + k] = base.bytes[k];
+
+  crossOff(buffer, presievePrimes[j]);
+  return buffer;
+}
+
+constexpr auto buffer7  = generateBuffer<210 / 30>(0, 0);
+constexpr auto buffer11 = generateBuffer<2310 / 30>(0, 1);
+constexpr auto buffer13 = generateBuffer<30030 / 30>(0, 2);
+constexpr auto buffer17 = extendBuffer<510510 / 30>(buffer13, 3);
+constexpr auto buffer19 = extendBuffer<9699690 / 30>(buffer17, 4);
+
+constexpr auto tierBuffer0 = generateBuffer<23 * 29>(5, 6);
+constexpr auto tierBuffer1 = generateBuffer<31 * 37>(7, 8);
+constexpr auto tierBuffer2 = generateBuffer<41 * 43>(9, 10);
+constexpr auto tierBuffer3 = generateBuffer<47 * 53>(11, 12);
+
+// verify the buffers are computed at compile time,
+// byte 0 covers [7, 31] whose only multiple of 7
+// with a bit is 7 itself (bit 0)
+static_assert(buffer7.bytes[0] == 0xfe, "pre-sieve error");
+static_assert(buffer19.bytes[0] == 0xe0, "pre-sieve error");
+
+const array<const byte_t*, 5> wheelBuffers =
+{
+  buffer7.bytes,
+  buffer11.bytes,
+  buffer13.bytes,
+  buffer17.bytes,
+  buffer19.bytes
+};
+
+const array<const byte_t*, 4> tierBuffers =
+{
+  tierBuffer0.bytes,
+  tierBuffer1.bytes,
+  tierBuffer2.bytes,
+  tierBuffer3.bytes
+};
+
+#else
+
+/// The pre-sieved buffers are immutable once generated,
+/// they are generated lazily and shared by all PreSieve
+/// objects. trim() may only free them while no PreSieve
+/// object is alive, users counts the live objects.
+///
+struct SharedBuffers
+{
+  mutex lock;
+  uint64_t users = 0;
+  array<unique_ptr<byte_t[]>, 5> deleters;
+  array<byte_t*, 5> buffers = {{ nullptr, nullptr, nullptr, nullptr, nullptr }};
+  array<unique_ptr<byte_t[]>, 4> tierDeleters;
+  array<byte_t*, 4> tierBuffers = {{ nullptr, nullptr, nullptr, nullptr }};
+};
+
+SharedBuffers& sharedBuffers()
+{
+  static SharedBuffers buffers;
+  return buffers;
+}
+
+#endif
+
+#if defined(HAS_CPU_SUPPORTS)
+
+/// Copy using 64-byte AVX-512 stores.
+///
+__attribute__ ((target ("avx512f")))
+void copyAVX512(byte_t* dst, const byte_t* src, uint64_t bytes)
+{
+  uint64_t i = 0;
+
+  for (; i + 64 <= bytes; i += 64)
+    _mm512_storeu_si512((void*) &dst[i],
+        _mm512_loadu_si512((const void*) &src[i]));
+
+  for (; i < bytes; i++)
+    dst[i] = src[i];
+}
+
+/// Copy using 32-byte AVX2 stores.
+///
+__attribute__ ((target ("avx2")))
+void copyAVX2(byte_t* dst, const byte_t* src, uint64_t bytes)
+{
+  uint64_t i = 0;
+
+  for (; i + 32 <= bytes; i += 32)
+    _mm256_storeu_si256((__m256i*) &dst[i],
+        _mm256_loadu_si256((const __m256i*) &src[i]));
+
+  for (; i < bytes; i++)
+    dst[i] = src[i];
+}
+
+/// Combine a tier buffer into the sieve array
+/// using 64-byte AVX-512 bitwise ANDs.
+///
+__attribute__ ((target ("avx512f")))
+void andAVX512(byte_t* dst, const byte_t* src, uint64_t bytes)
+{
+  uint64_t i = 0;
+
+  for (; i + 64 <= bytes; i += 64)
+    _mm512_storeu_si512((void*) &dst[i],
+        _mm512_and_si512(_mm512_loadu_si512((const void*) &dst[i]),
+                         _mm512_loadu_si512((const void*) &src[i])));
+
+  for (; i < bytes; i++)
+    dst[i] &= src[i];
+}
+
+/// Combine a tier buffer into the sieve array
+/// using 32-byte AVX2 bitwise ANDs.
+///
+__attribute__ ((target ("avx2")))
+void andAVX2(byte_t* dst, const byte_t* src, uint64_t bytes)
+{
+  uint64_t i = 0;
+
+  for (; i + 32 <= bytes; i += 32)
+    _mm256_storeu_si256((__m256i*) &dst[i],
+        _mm256_and_si256(_mm256_loadu_si256((const __m256i*) &dst[i]),
+                         _mm256_loadu_si256((const __m256i*) &src[i])));
+
+  for (; i < bytes; i++)
+    dst[i] &= src[i];
+}
+
+#endif
+
+/// Copy the pre-sieved buffer to the sieve array
+/// using the fastest instruction set supported
+/// by the CPU. On non x86 CPUs std::copy_n
+/// (i.e. memcpy) is used.
+///
+void presieveCopy(byte_t* dst, const byte_t* src, uint64_t bytes)
+{
+#if defined(HAS_CPU_SUPPORTS)
+  if (hasAVX512())
+    copyAVX512(dst, src, bytes);
+  else if (hasAVX2())
+    copyAVX2(dst, src, bytes);
+  else
+#endif
+  copy_n(src, bytes, dst);
+}
+
+/// Combine a pre-sieved tier buffer into the sieve
+/// array using a bitwise AND and the fastest
+/// instruction set supported by the CPU.
+///
+void presieveAnd(byte_t* dst, const byte_t* src, uint64_t bytes)
+{
+#if defined(HAS_CPU_SUPPORTS)
+  if (hasAVX512())
+  {
+    andAVX512(dst, src, bytes);
+    return;
+  }
+  if (hasAVX2())
+  {
+    andAVX2(dst, src, bytes);
+    return;
+  }
+#endif
+  for (uint64_t i = 0; i < bytes; i++)
+    dst[i] &= src[i];
+}
+
 } // namespace
 
 namespace primesieve {
@@ -50,30 +335,163 @@ PreSieve::PreSieve(uint64_t start, uint64_t stop)
   maxPrime_ = primes[i];
   primeProduct_ = primeProducts[i];
 
+#if !defined(CONSTEXPR_PRESIEVE)
+  auto& shared = sharedBuffers();
+  unique_lock<mutex> lock(shared.lock);
+  shared.users++;
+#endif
+
   init();
+
+  // the tiered pre-sieve of primes in ]19, 53]
+  // only pays off for large sieve intervals
+  if (maxPrime_ == 19)
+    initTiers();
+}
+
+PreSieve::~PreSieve()
+{
+#if !defined(CONSTEXPR_PRESIEVE)
+  auto& shared = sharedBuffers();
+  unique_lock<mutex> lock(shared.lock);
+  shared.users--;
+#endif
 }
 
-/// Pre-sieve a small buffer by removing the
-/// multiples of primes <= maxPrime.
+/// Free the cached pre-sieved buffers,
+/// used by trim_memory(). The compile time
+/// generated buffers live in .rodata and
+/// cannot (and need not) be freed.
+///
+void PreSieve::trim()
+{
+#if !defined(CONSTEXPR_PRESIEVE)
+  auto& shared = sharedBuffers();
+  unique_lock<mutex> lock(shared.lock);
+
+  if (shared.users == 0)
+  {
+    for (auto& deleter : shared.deleters)
+      deleter.reset();
+    for (auto& deleter : shared.tierDeleters)
+      deleter.reset();
+    shared.buffers.fill(nullptr);
+    shared.tierBuffers.fill(nullptr);
+  }
+#endif
+}
+
+#if defined(CONSTEXPR_PRESIEVE)
+
+/// The buffers were generated at compile time,
+/// simply point at them
 ///
 void PreSieve::init()
 {
   size_ = primeProduct_ / 30;
-  buffer_ = new byte_t[size_];
-  deleter_.reset(buffer_);
-  fill_n(buffer_, size_, 0xff);
+  size_t i = 0;
 
-  EratSmall eratSmall;
-  uint64_t stop = primeProduct_ * 2;
-  eratSmall.init(stop, size_, maxPrime_);
+  while (primes[i] != maxPrime_)
+    i++;
 
-  for (uint64_t prime : primes)
-    if (prime <= maxPrime_)
-      eratSmall.addSievingPrime(prime, primeProduct_);
+  buffer_ = wheelBuffers[i];
+}
 
-  eratSmall.crossOff(buffer_, size_);
+void PreSieve::initTiers()
+{
+  for (size_t t = 0; t < tierPrimes.size(); t++)
+  {
+    tierSizes_[t] = tierPrimes[t][0] * tierPrimes[t][1];
+    tierBuffers_[t] = tierBuffers[t];
+    maxPrime_ = tierPrimes[t][1];
+  }
 }
 
+#else
+
+/// Pre-sieve a small buffer by removing the multiples of
+/// primes <= maxPrime, or reuse the shared buffer if a
+/// previous PreSieve object has already generated it.
+/// The caller holds the sharedBuffers() lock.
+///
+void PreSieve::init()
+{
+  size_ = primeProduct_ / 30;
+  size_t i = 0;
+
+  while (primes[i] != maxPrime_)
+    i++;
+
+  auto& shared = sharedBuffers();
+
+  if (!shared.buffers[i])
+  {
+    // allocate extra bytes so that the buffer can be
+    // aligned to a 64-byte cache line boundary which
+    // speeds up the copying in presieveCopy()
+    shared.deleters[i].reset(new byte_t[size_ + 64]);
+    uintptr_t address = (uintptr_t) shared.deleters[i].get();
+    byte_t* buffer = shared.deleters[i].get() + (64 - address % 64) % 64;
+    fill_n(buffer, size_, 0xff);
+
+    EratSmall eratSmall;
+    uint64_t stop = primeProduct_ * 2;
+    eratSmall.init(stop, size_, maxPrime_);
+
+    for (uint64_t prime : primes)
+      if (prime <= maxPrime_)
+        eratSmall.addSievingPrime(prime, primeProduct_);
+
+    eratSmall.crossOff(buffer, size_);
+    shared.buffers[i] = buffer;
+  }
+
+  buffer_ = shared.buffers[i];
+}
+
+/// Pre-sieve the tier buffers by removing the multiples
+/// of the primes in ]19, 53]. Each tier uses a tiny
+/// L1 cache resident buffer whose size is the product
+/// of its 2 primes (in bytes).
+/// The caller holds the sharedBuffers() lock.
+///
+void PreSieve::initTiers()
+{
+  auto& shared = sharedBuffers();
+
+  for (size_t t = 0; t < tierPrimes.size(); t++)
+  {
+    uint64_t primeProduct = tierPrimes[t][0] * tierPrimes[t][1];
+    tierSizes_[t] = primeProduct;
+
+    if (!shared.tierBuffers[t])
+    {
+      // allocate extra bytes so that the buffer can be
+      // aligned to a 64-byte cache line boundary which
+      // speeds up the bitwise AND in presieveAnd()
+      shared.tierDeleters[t].reset(new byte_t[primeProduct + 64]);
+      uintptr_t address = (uintptr_t) shared.tierDeleters[t].get();
+      byte_t* buffer = shared.tierDeleters[t].get() + (64 - address % 64) % 64;
+      fill_n(buffer, primeProduct, 0xff);
+
+      EratSmall eratSmall;
+      uint64_t stop = primeProduct * 30 * 2;
+      eratSmall.init(stop, primeProduct, tierPrimes[t][1]);
+
+      for (uint64_t prime : tierPrimes[t])
+        eratSmall.addSievingPrime(prime, primeProduct * 30);
+
+      eratSmall.crossOff(buffer, primeProduct);
+      shared.tierBuffers[t] = buffer;
+    }
+
+    tierBuffers_[t] = shared.tierBuffers[t];
+    maxPrime_ = tierPrimes[t][1];
+  }
+}
+
+#endif
+
 /// Copy pre-sieved buffer to sieve array
 void PreSieve::copy(byte_t* sieve,
                     uint64_t sieveSize,
@@ -85,18 +503,51 @@ void PreSieve::copy(byte_t* sieve,
   uint64_t sizeLeft = size_ - i;
 
   if (sieveSize <= sizeLeft)
-    copy_n(&buffer_[i], sieveSize, sieve);
+    presieveCopy(sieve, &buffer_[i], sieveSize);
   else
   {
     // copy the last remaining bytes of buffer
     // to the beginning of the sieve array
-    copy_n(&buffer_[i], sizeLeft, sieve);
+    presieveCopy(sieve, &buffer_[i], sizeLeft);
 
     // restart copying at the beginning of buffer
     for (i = sizeLeft; i + size_ < sieveSize; i += size_)
-      copy_n(buffer_, size_, &sieve[i]);
+      presieveCopy(&sieve[i], buffer_, size_);
+
+    presieveCopy(&sieve[i], buffer_, sieveSize - i);
+  }
+
+  for (size_t t = 0; t < tierPrimes.size(); t++)
+    if (tierBuffers_[t])
+      copyTier(sieve, sieveSize, segmentLow, t);
+}
+
+/// Combine a tier buffer into the sieve
+/// array using a bitwise AND
+///
+void PreSieve::copyTier(byte_t* sieve,
+                        uint64_t sieveSize,
+                        uint64_t segmentLow,
+                        uint64_t tier) const
+{
+  const byte_t* buffer = tierBuffers_[tier];
+  uint64_t size = tierSizes_[tier];
+
+  // find segmentLow index
+  uint64_t remainder = segmentLow % (size * 30);
+  uint64_t i = remainder / 30;
+  uint64_t sizeLeft = size - i;
+
+  if (sieveSize <= sizeLeft)
+    presieveAnd(sieve, &buffer[i], sieveSize);
+  else
+  {
+    presieveAnd(sieve, &buffer[i], sizeLeft);
+
+    for (i = sizeLeft; i + size < sieveSize; i += size)
+      presieveAnd(&sieve[i], buffer, size);
 
-    copy_n(buffer_, sieveSize - i, &sieve[i]);
+    presieveAnd(&sieve[i], buffer, sieveSize - i);
   }
 }
 
@@ -13,9 +13,12 @@
 ///
 
 #include <primesieve/Erat.hpp>
+#include <primesieve/PiTable.hpp>
 #include <primesieve/PreSieve.hpp>
 #include <primesieve/PrimeGenerator.hpp>
+#include <primesieve/multiarch.hpp>
 #include <primesieve/pmath.hpp>
+#include <primesieve/primesieve_error.hpp>
 #include <primesieve/SievingPrimes.hpp>
 #include <primesieve/types.hpp>
 
@@ -26,8 +29,121 @@
 
 using namespace std;
 
+namespace {
+
+/// Bit values of the 8 bits of each sieve
+/// byte: bitValues[i] = 7 + wheel30 offset
+///
+const array<uint64_t, 8> bitValues = { 7, 11, 13, 17, 19, 23, 29, 31 };
+
+/// Generate a lookup table with the bit values of all set
+/// bits for each of the 256 possible sieve byte values.
+/// Each row is 0 terminated. Using this table the primes
+/// of a sieve byte are decoded in batch instead of
+/// scanning the byte one bit at a time.
+///
+array<array<uint8_t, 9>, 256> makeByteBitValues()
+{
+  array<array<uint8_t, 9>, 256> table;
+
+  for (uint64_t byte = 0; byte < 256; byte++)
+  {
+    uint64_t i = 0;
+    for (uint64_t bit = 0; bit < 8; bit++)
+      if (byte & (1ull << bit))
+        table[byte][i++] = (uint8_t) bitValues[bit];
+    table[byte][i] = 0;
+  }
+
+  return table;
+}
+
+/// Bitmask patterns of the prime k-tuplets that fit within
+/// a single sieve byte, one 0 terminated row per tuplet
+/// type (twins, triplets, ..., sextuplets). These are the
+/// same patterns PrintPrimes uses for counting.
+///
+const uint64_t tupletMasks[5][5] =
+{
+  { 0x06, 0x18, 0xc0, 0 },       // Twin primes:       b00000110, b00011000, b11000000
+  { 0x07, 0x0e, 0x1c, 0x38, 0 }, // Prime triplets:    b00000111, b00001110, ...
+  { 0x1e, 0 },                   // Prime quadruplets: b00011110
+  { 0x1f, 0x3e, 0 },             // Prime quintuplets
+  { 0x3f, 0 }                    // Prime sextuplets
+};
+
+/// k-tuplets whose first prime is < 7, they are not
+/// covered by the sieve (which starts at 7)
+///
+const struct { int k; uint64_t first; uint64_t last; } smallTuplets[5] =
+{
+  { 2, 3,  5 },
+  { 2, 5,  7 },
+  { 3, 5, 11 },
+  { 4, 5, 13 },
+  { 5, 5, 17 }
+};
+
+/// Generate a lookup table with the bit value of the first
+/// member of each prime k-tuplet per sieve byte value.
+/// A tuplet mask matches only if all of its bits are set.
+/// Each row is 0 terminated.
+///
+array<array<uint8_t, 5>, 256> makeByteTupletValues(int k)
+{
+  array<array<uint8_t, 5>, 256> table;
+
+  for (uint64_t byte = 0; byte < 256; byte++)
+  {
+    uint64_t i = 0;
+    for (const uint64_t* mask = tupletMasks[k - 2]; *mask; mask++)
+    {
+      if ((byte & *mask) == *mask)
+      {
+        // lowest bit of the bitmask = first member
+        int first = 0;
+        while (!(*mask >> first & 1))
+          first++;
+        table[byte][i++] = (uint8_t) bitValues[first];
+      }
+    }
+    table[byte][i] = 0;
+  }
+
+  return table;
+}
+
+/// Generate a lookup table with the bit value of the
+/// smaller member of each twin pair per sieve byte value.
+/// The twin pairs (11, 13), (17, 19) and (29, 31) each fit
+/// within a single sieve byte, a twin pair is present iff
+/// both of its bits are set. Each row is 0 terminated.
+///
+array<array<uint8_t, 4>, 256> makeByteTwinValues()
+{
+  const uint64_t twinMasks[3] = { 0x06, 0x18, 0xc0 };
+  const uint64_t lowerBits[3] = { 1, 3, 6 };
+  array<array<uint8_t, 4>, 256> table;
+
+  for (uint64_t byte = 0; byte < 256; byte++)
+  {
+    uint64_t i = 0;
+    for (uint64_t m = 0; m < 3; m++)
+      if ((byte & twinMasks[m]) == twinMasks[m])
+        table[byte][i++] = (uint8_t) bitValues[lowerBits[m]];
+    table[byte][i] = 0;
+  }
+
+  return table;
+}
+
+} // namespace
+
 namespace primesieve {
 
+const array<array<uint8_t, 9>, 256> PrimeGenerator::byteBitValues_ = makeByteBitValues();
+const array<array<uint8_t, 4>, 256> PrimeGenerator::byteTwinValues_ = makeByteTwinValues();
+
 /// First 64 primes
 const array<uint64_t, 64> PrimeGenerator::smallPrimes =
 {
@@ -117,25 +233,7 @@ size_t PrimeGenerator::getStopIdx() const
   return stopIdx;
 }
 
-void PrimeGenerator::init(vector<uint64_t>& primes)
-{
-  size_t size = primeCountApprox(start_, stop_);
-  primes.reserve(size);
-
-  if (start_ <= smallPrimes.back())
-  {
-    size_t a = getStartIdx();
-    size_t b = getStopIdx();
-
-    primes.insert(primes.end(),
-             smallPrimes.begin() + a,
-             smallPrimes.begin() + b);
-  }
-
-  init();
-}
-
-void PrimeGenerator::init(vector<uint64_t>& primes, size_t* size)
+void PrimeGenerator::init(uint64_t* primes, size_t* size)
 {
   if (start_ <= smallPrimes.back())
   {
@@ -145,25 +243,13 @@ void PrimeGenerator::init(vector<uint64_t>& primes, size_t* size)
 
     copy(smallPrimes.begin() + a,
          smallPrimes.begin() + b,
-         primes.begin());
+         primes);
   }
 
   init();
 }
 
-bool PrimeGenerator::sieveSegment(vector<uint64_t>& primes)
-{
-  if (!isInit_)
-    init(primes);
-
-  if (!hasNextSegment())
-    return false;
-
-  sieveSegment();
-  return true;
-}
-
-bool PrimeGenerator::sieveSegment(vector<uint64_t>& primes, size_t* size)
+bool PrimeGenerator::sieveSegment(uint64_t* primes, size_t* size)
 {
   if (!isInit_)
   {
@@ -203,20 +289,216 @@ void PrimeGenerator::sieveSegment()
   Erat::sieveSegment();
 }
 
-void PrimeGenerator::fill(vector<uint64_t>& primes)
+/// Store the smaller member of each twin pair (p, p + 2)
+/// with p >= start and p + 2 <= stop in the twins vector.
+/// The twins > 7 are extracted directly from the sieve
+/// bits using byteTwinValues_, without generating an
+/// intermediate list of all primes.
+///
+PRIMESIEVE_MULTIARCH
+void PrimeGenerator::fillTwins(vector<uint64_t>& twins)
+{
+  if (start_ > stop_)
+    return;
+
+  // the twin pairs (3, 5) and (5, 7) contain
+  // primes < 7 not covered by the sieve
+  for (uint64_t p : { 3ull, 5ull })
+    if (p >= start_ && p + 2 <= stop_)
+      twins.push_back(p);
+
+  // the smallest sievable twin pair is (11, 13)
+  if (stop_ < 13)
+    return;
+
+  start_ = max<uint64_t>(7, start_);
+  uint64_t sieveSize = get_sieve_size();
+  Erat::init(start_, stop_, sieveSize, preSieve_);
+  sievingPrimes_.init(this, preSieve_);
+  isInit_ = true;
+
+  while (hasNextSegment())
+  {
+    sieveSegment();
+
+    for (; sieveIdx_ < sieveSize_; sieveIdx_++)
+    {
+      // Erat zeroes the bits outside [start, stop],
+      // a twin mask matches only if both of its bits
+      // are set, hence both members are in [start, stop]
+      for (const uint8_t* v = byteTwinValues_[sieve_[sieveIdx_]].data(); *v; v++)
+        twins.push_back(low_ + *v);
+
+      low_ += 30;
+    }
+  }
+}
+
+/// Invoke the callback once per prime k-tuplet inside
+/// [start, stop] with the tuplet's start value (e.g. p for
+/// each prime triplet (p, p + 4, p + 6)). The tuplets are
+/// extracted directly from the sieve bits using per byte
+/// bitmask matching, without generating a full prime list.
+/// @k: number of tuplet members, 2 = twins, ..., 6 = sextuplets
+///
+void PrimeGenerator::forEachTuplet(int k, const tuplet_callback& callback)
 {
-  while (sieveSegment(primes))
+  if (k < 2 || k > 6)
+    throw primesieve_error("forEachTuplet: k must be within [2, 6]");
+
+  if (start_ > stop_)
+    return;
+
+  // k-tuplets whose first prime is < 7
+  // are not covered by the sieve
+  for (const auto& t : smallTuplets)
+    if (t.k == k &&
+        t.first >= start_ &&
+        t.last <= stop_)
+      callback(t.first);
+
+  // the smallest sievable k-tuplet is (7, 11, 13)
+  if (stop_ < 13)
+    return;
+
+  auto byteTupletValues = makeByteTupletValues(k);
+
+  start_ = max<uint64_t>(7, start_);
+  uint64_t sieveSize = get_sieve_size();
+  Erat::init(start_, stop_, sieveSize, preSieve_);
+  sievingPrimes_.init(this, preSieve_);
+  isInit_ = true;
+
+  while (hasNextSegment())
   {
-    for (; sieveIdx_ < sieveSize_; sieveIdx_ += 8)
+    sieveSegment();
+
+    for (; sieveIdx_ < sieveSize_; sieveIdx_++)
     {
-      uint64_t bits = littleendian_cast<uint64_t>(&sieve_[sieveIdx_]);
+      // Erat zeroes the bits outside [start, stop], a
+      // tuplet mask matches only if all of its bits are
+      // set, hence all members are in [start, stop]
+      for (const uint8_t* v = byteTupletValues[sieve_[sieveIdx_]].data(); *v; v++)
+        callback(low_ + *v);
 
-      while (bits)
-        primes.push_back(nextPrime(&bits, low_));
+      low_ += 30;
+    }
+  }
+}
+
+/// Invoke the callback once per sieved segment with a pointer
+/// to the primes of that segment. The primes are decoded into
+/// an internal buffer which is reused for all segments, hence
+/// the memory usage stays one segment regardless of the size
+/// of [start, stop].
+///
+void PrimeGenerator::forEachBatch(const batch_callback& callback)
+{
+  vector<uint64_t> primes;
 
-      low_ += 8 * 30;
+  if (!isInit_)
+  {
+    // generate the primes < 2^16 from the
+    // lookup table, without sieving
+    if (stop_ < PiTable::limit())
+    {
+      PiTable::getInstance().fillPrimes(primes, start_, stop_);
+
+      if (!primes.empty())
+        callback(primes.data(), primes.size());
+
+      finished_ = true;
+      return;
     }
+
+    // the small primes <= 311 (if any) are
+    // part of the 1st batch
+    if (start_ <= smallPrimes.back())
+    {
+      size_t a = getStartIdx();
+      size_t b = getStopIdx();
+
+      primes.insert(primes.end(),
+               smallPrimes.begin() + a,
+               smallPrimes.begin() + b);
+    }
+
+    init();
   }
+
+  // number of primes in the batch buffer,
+  // the small primes <= 311 (if any)
+  size_t size = primes.size();
+
+  while (hasNextSegment())
+  {
+    sieveSegment();
+
+    // Popcount the segment while it is still L1 resident:
+    // the exact prime count sizes the batch buffer once per
+    // segment and the decode loop below stores the primes
+    // with raw writes (no per-prime capacity checks),
+    // fusing counting and storing into a single pass.
+    uint64_t words = ceilDiv(sieveSize_, 8);
+    size_t count = (size_t) popcount((const uint64_t*) sieve_, words);
+
+    if (size + count > primes.size())
+      primes.resize(size + count);
+
+    uint64_t* out = primes.data() + size;
+
+    for (; sieveIdx_ < sieveSize_; sieveIdx_++)
+    {
+      for (const uint8_t* v = byteBitValues_[sieve_[sieveIdx_]].data(); *v; v++)
+        *out++ = low_ + *v;
+
+      low_ += 30;
+    }
+
+    size += count;
+    if (size > 0)
+      callback(primes.data(), size);
+    size = 0;
+  }
+
+  // [start, stop] is below the sieving threshold,
+  // no segment has been sieved
+  if (size > 0)
+    callback(primes.data(), size);
+
+  finished_ = true;
+}
+
+/// Invoke the callback once per sieved segment with the
+/// segment's raw sieve bytes, before the buffer is reused
+/// for the next segment (zero-copy). The bitmap uses the
+/// modulo 30 layout from bits.hpp: byte i of a segment
+/// stores the numbers low + i * 30 + {7, 11, 13, 17, 19,
+/// 23, 29, 31}, the bits outside [start, stop] are zeroed.
+/// The primes 2, 3 and 5 are not representable in this
+/// layout, consumers must handle them themselves.
+///
+void PrimeGenerator::forEachSegment(const segment_callback& callback)
+{
+  if (start_ <= stop_ && stop_ >= 7)
+  {
+    if (!isInit_)
+    {
+      start_ = max<uint64_t>(7, start_);
+      uint64_t sieveSize = get_sieve_size();
+      Erat::init(start_, stop_, sieveSize, preSieve_);
+      sievingPrimes_.init(this, preSieve_);
+      isInit_ = true;
+    }
+
+    while (hasNextSegment())
+    {
+      sieveSegment();
+      callback(sieve_, (size_t) sieveSize_, low_);
+    }
+  }
+
+  finished_ = true;
 }
 
 } // namespace
@@ -12,6 +12,7 @@
 
 #include <primesieve/PrimeSieve.hpp>
 #include <primesieve/pmath.hpp>
+#include <primesieve/primesieve_error.hpp>
 #include <primesieve/PrintPrimes.hpp>
 #include <primesieve/types.hpp>
 
@@ -19,6 +20,7 @@
 #include <algorithm>
 #include <array>
 #include <chrono>
+#include <cstdio>
 #include <iostream>
 #include <string>
 
@@ -46,6 +48,35 @@ const array<SmallPrime, 8> smallPrimes
   { 5, 17, 4, "(5, 7, 11, 13, 17)" }
 }};
 
+/// Print a single prime to stdout in binary format,
+/// see PrintPrimes::printBinaryPrimes()
+///
+void printBinaryPrime(uint64_t prime, uint64_t* prevPrime, bool varint)
+{
+  primesieve::byte_t buffer[sizeof(uint64_t) + 2];
+  size_t size = 0;
+
+  if (varint)
+  {
+    uint64_t delta = prime - *prevPrime;
+    *prevPrime = prime;
+
+    while (delta >= 0x80)
+    {
+      buffer[size++] = (primesieve::byte_t) (delta | 0x80);
+      delta >>= 7;
+    }
+    buffer[size++] = (primesieve::byte_t) delta;
+  }
+  else
+  {
+    for (int j = 0; j < 64; j += 8)
+      buffer[size++] = (primesieve::byte_t) (prime >> j);
+  }
+
+  fwrite(buffer, 1, size, stdout);
+}
+
 } // namespace
 
 namespace primesieve {
@@ -57,6 +88,7 @@ PrimeSieve::PrimeSieve() :
   parent_(nullptr)
 {
   setSieveSize(get_sieve_size());
+  defaultSieveSize_ = true;
   reset();
 }
 
@@ -65,6 +97,7 @@ PrimeSieve::PrimeSieve() :
 ///
 PrimeSieve::PrimeSieve(PrimeSieve* parent) :
   sieveSize_(parent->sieveSize_),
+  defaultSieveSize_(parent->defaultSieveSize_),
   flags_(parent->flags_),
   parent_(parent)
 { }
@@ -74,11 +107,47 @@ PrimeSieve::~PrimeSieve()
 
 void PrimeSieve::reset()
 {
+  canceled_ = false;
   counts_.fill(0);
   seconds_ = 0.0;
   toUpdate_ = 0;
   processed_ = 0;
   percent_ = -1.0;
+  ewmaRate_ = 0.0;
+  lastProcessed_ = 0;
+  runningCount_ = 0;
+  lastStatusTime_ = chrono::steady_clock::now();
+}
+
+/// Request cancellation of an in-progress sieve(). Can be
+/// called from another thread, the flag is checked at
+/// segment boundaries and the canceled sieve() throws a
+/// primesieve_error once the flag has been seen. For a
+/// ParallelSieve the cancellation stops all worker threads;
+/// sieve() only throws after every worker has terminated
+/// (ParallelSieve::sieve() drains all worker futures before
+/// rethrowing), so no abandoned worker can outlive the call
+/// or miss the flag reset of a subsequent sieve().
+///
+void PrimeSieve::cancel()
+{
+  canceled_ = true;
+}
+
+bool PrimeSieve::isCanceled() const
+{
+  return getCancelFlag()->load();
+}
+
+/// The worker PrimeSieve objects of a ParallelSieve
+/// share their parent's cancellation flag
+///
+const std::atomic<bool>* PrimeSieve::getCancelFlag() const
+{
+  if (parent_)
+    return parent_->getCancelFlag();
+  else
+    return &canceled_;
 }
 
 bool PrimeSieve::isParallelSieve() const
@@ -121,6 +190,16 @@ uint64_t PrimeSieve::getDistance() const
   return stop_ - start_;
 }
 
+uint64_t PrimeSieve::getHistogramWidth() const
+{
+  return histogramWidth_;
+}
+
+uint64_t PrimeSieve::getCountStop() const
+{
+  return min(countStop_, stop_);
+}
+
 uint64_t PrimeSieve::getCount(int i) const
 {
   return counts_.at(i);
@@ -164,6 +243,12 @@ void PrimeSieve::setSieveSize(int sieveSize)
 {
   sieveSize_ = inBetween(8, sieveSize, 4096);
   sieveSize_ = floorPow2(sieveSize_);
+  defaultSieveSize_ = false;
+}
+
+bool PrimeSieve::isDefaultSieveSize() const
+{
+  return defaultSieveSize_;
 }
 
 /// Set a start number (lower bound) for sieving
@@ -178,6 +263,60 @@ void PrimeSieve::setStop(uint64_t stop)
   stop_ = stop;
 }
 
+/// Set an upper bound for counting, used by ParallelSieve
+/// whose chunks are sieved slightly past their boundary so
+/// that spanning prime k-tuplets can be counted
+///
+void PrimeSieve::setCountStop(uint64_t countStop)
+{
+  countStop_ = countStop;
+}
+
+/// Split [start, stop] into intervals [k*width, (k+1)*width[
+/// and print one line "intervalStart primeCount" per interval
+/// while sieving, a width of 0 disables the histogram.
+/// The histogram is accumulated from the per segment
+/// popcounts in a single sequential pass, hence it is only
+/// supported with a single thread.
+///
+void PrimeSieve::setHistogramWidth(uint64_t width)
+{
+  // an interval boundary may split at
+  // most one sieve byte (30 numbers)
+  if (width > 0 && width < 100)
+    throw primesieve_error("histogram width must be >= 100");
+
+  histogramWidth_ = width;
+}
+
+/// Assign this thread's progress counter,
+/// used by ParallelSieve
+///
+void PrimeSieve::setStatusCounter(std::atomic<uint64_t>* statusCounter)
+{
+  statusCounter_ = statusCounter;
+}
+
+/// Get the number of primes found so far. Can be polled
+/// from another thread while sieve() is running to
+/// monitor progress in primes instead of distance.
+///
+uint64_t PrimeSieve::getRunningCount() const
+{
+  return runningCount_.load(std::memory_order_relaxed);
+}
+
+/// Add the prime count of a sieved segment,
+/// worker threads add into their parent's counter
+///
+void PrimeSieve::addRunningCount(uint64_t count)
+{
+  if (parent_)
+    parent_->addRunningCount(count);
+  else
+    runningCount_.fetch_add(count, std::memory_order_relaxed);
+}
+
 /// Print status in percent to stdout.
 /// @processed:  Sum of recently processed segments
 ///
@@ -185,6 +324,16 @@ bool PrimeSieve::updateStatus(uint64_t processed, bool tryLock)
 {
   if (isParallelSieve())
   {
+    // lock-free fast path: bump this thread's padded
+    // counter, the parent aggregates all counters when
+    // it prints the status
+    if (statusCounter_)
+    {
+      statusCounter_->fetch_add(processed, std::memory_order_relaxed);
+      parent_->updateStatus(0, tryLock);
+      return true;
+    }
+
     toUpdate_ += processed;
     if (parent_->updateStatus(toUpdate_, tryLock))
       toUpdate_ = 0;
@@ -197,18 +346,54 @@ bool PrimeSieve::updateStatus(uint64_t processed, bool tryLock)
       percent = processed_ * 100.0 / getDistance();
     double old = percent_;
     percent_ = min(percent, 100.0);
+
+    // update the exponentially weighted throughput
+    // estimate at most 10 times per second
+    auto now = chrono::steady_clock::now();
+    chrono::duration<double> dt = now - lastStatusTime_;
+    if (dt.count() >= 0.1)
+    {
+      double rate = (processed_ - lastProcessed_) / dt.count();
+      if (ewmaRate_ == 0.0)
+        ewmaRate_ = rate;
+      ewmaRate_ = ewmaRate_ * 0.7 + rate * 0.3;
+      lastProcessed_ = processed_;
+      lastStatusTime_ = now;
+    }
+
     if (isFlag(PRINT_STATUS))
       printStatus(old, percent_);
   }
   return true;
 }
 
-void PrimeSieve::printStatus(double old, double current)
+void PrimeSieve::printStatus(double old, double current) const
 {
   int percent = (int) current;
   if (percent > (int) old)
   {
-    cout << '\r' << percent << '%' << flush;
+    cout << '\r' << percent << '%';
+
+    // append throughput and remaining time estimates,
+    // trailing spaces erase the previous, longer line
+    if (ewmaRate_ > 0 &&
+        percent > 0 &&
+        percent < 100)
+    {
+      uint64_t remaining = getDistance() - min(processed_, getDistance());
+      int eta = (int) (remaining / ewmaRate_);
+
+      cout << ", " << (uint64_t) (ewmaRate_ / 1e6) << " M numbers/s, ETA ";
+      if (eta >= 3600)
+        cout << eta / 3600 << "h " << eta % 3600 / 60 << "m";
+      else if (eta >= 60)
+        cout << eta / 60 << "m " << eta % 60 << "s";
+      else
+        cout << eta << "s";
+      cout << "   ";
+    }
+
+    cout << flush;
     if (percent == 100)
       cout << endl;
   }
@@ -217,14 +402,26 @@ void PrimeSieve::printStatus(double old, double current)
 /// Process small primes <= 5 and small k-tuplets <= 17
 void PrimeSieve::processSmallPrimes()
 {
+  uint64_t prevPrime = 0;
+
   for (auto& p : smallPrimes)
   {
-    if (p.first >= start_ && p.last <= stop_)
+    if (p.first >= start_ &&
+        p.first <= getCountStop() &&
+        p.last <= stop_)
     {
+      if (p.index == 0)
+        addRunningCount(1);
       if (isCount(p.index))
         counts_[p.index]++;
       if (isPrint(p.index))
-        cout << p.str << '\n';
+      {
+        if (p.index == 0 &&
+            isFlag(PRINT_BINARY, PRINT_VARINT))
+          printBinaryPrime(p.first, &prevPrime, isFlag(PRINT_VARINT));
+        else
+          cout << p.str << '\n';
+      }
     }
   }
 }
@@ -257,6 +454,11 @@ void PrimeSieve::sieve()
 {
   reset();
 
+  // a worker thread whose ParallelSieve has been
+  // canceled does not start new chunks
+  if (isCanceled())
+    throw primesieve_error("sieving canceled");
+
   if (start_ > stop_)
     return;
 
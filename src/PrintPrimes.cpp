@@ -18,15 +18,108 @@
 #include <primesieve/PrimeSieve.hpp>
 #include <primesieve/Erat.hpp>
 #include <primesieve/SievingPrimes.hpp>
+#include <primesieve/Stats.hpp>
 #include <primesieve/types.hpp>
 
 #include <stdint.h>
 #include <algorithm>
+#include <cstdio>
+#include <cstddef>
+#include <future>
 #include <iostream>
 #include <sstream>
+#include <vector>
 
 using namespace std;
 
+namespace {
+
+/// Numbers corresponding to the bits of a sieve byte
+const uint64_t bitValues[8] = { 7, 11, 13, 17, 19, 23, 29, 31 };
+
+/// Generates the sieving primes in chunks on a background
+/// thread while the main thread sieves segments. This
+/// overlaps sieving-prime generation with segment sieving,
+/// the first segments are hence printed before all sieving
+/// primes (up to n^(1/2)) have been generated.
+///
+class AsyncSievingPrimes
+{
+public:
+  AsyncSievingPrimes(primesieve::Erat* erat,
+                     primesieve::PreSieve& preSieve)
+    : sievingPrimes_(erat, preSieve)
+  {
+    launch();
+  }
+
+  ~AsyncSievingPrimes()
+  {
+    if (future_.valid())
+      future_.wait();
+  }
+
+  /// Get the next sieving prime,
+  /// returns UINT64_MAX after the last one
+  ///
+  uint64_t next()
+  {
+    if (i_ >= primes_.size())
+      swapNext();
+    return primes_[i_++];
+  }
+
+private:
+  enum { CHUNK_SIZE = 1 << 14 };
+
+  void launch()
+  {
+    future_ = std::async(std::launch::async, [this]
+    {
+      buffer_.clear();
+      uint64_t prime = 0;
+
+      while (buffer_.size() < CHUNK_SIZE &&
+             prime != ~0ull)
+      {
+        prime = sievingPrimes_.next();
+        buffer_.push_back(prime);
+      }
+    });
+  }
+
+  /// Swap in the prefetched chunk and start
+  /// generating the next one
+  ///
+  void swapNext()
+  {
+    if (!future_.valid())
+    {
+      // no more sieving primes
+      primes_.assign(1, ~0ull);
+      i_ = 0;
+      return;
+    }
+
+    future_.wait();
+    primes_.swap(buffer_);
+    i_ = 0;
+
+    if (primes_.back() != ~0ull)
+      launch();
+    else
+      future_ = std::future<void>();
+  }
+
+  primesieve::SievingPrimes sievingPrimes_;
+  std::vector<uint64_t> primes_;
+  std::vector<uint64_t> buffer_;
+  std::size_t i_ = 0;
+  std::future<void> future_;
+};
+
+} // namespace
+
 namespace primesieve {
 
 const uint64_t PrintPrimes::bitmasks_[6][5] =
@@ -40,6 +133,7 @@ const uint64_t PrintPrimes::bitmasks_[6][5] =
 };
 
 PrintPrimes::PrintPrimes(PrimeSieve& ps) :
+  countStop_(ps.getCountStop()),
   preSieve_(ps.getStart(), ps.getStop()),
   counts_(ps.getCounts()),
   ps_(ps)
@@ -49,39 +143,63 @@ PrintPrimes::PrintPrimes(PrimeSieve& ps) :
   uint64_t sieveSize = ps.getSieveSize();
 
   Erat::init(start, stop, sieveSize, preSieve_);
+  setCancelFlag(ps.getCancelFlag());
+
+  // in binary varint mode the deltas continue from the
+  // small primes <= 5 printed by processSmallPrimes()
+  for (uint64_t p : { 2ull, 3ull, 5ull })
+    if (p >= ps.getStart() && p <= stop)
+      prevPrime_ = p;
+
+  histWidth_ = ps.getHistogramWidth();
+
+  if (histWidth_ > 0)
+  {
+    // intervals are aligned to multiples of the width
+    histLow_ = ps.getStart() - ps.getStart() % histWidth_;
+
+    // the small primes <= 5 counted by processSmallPrimes()
+    // fall into the first interval
+    for (uint64_t p : { 2ull, 3ull, 5ull })
+      if (p >= ps.getStart() && p <= stop)
+        histCount_++;
+  }
 
   if (ps_.isCountkTuplets())
     initCounts();
 }
 
-/// Initialize the lookup tables to count the number
-/// of twins, triplets, ... per byte
+/// Initialize the lookup table to count the number
+/// of twins, triplets, ... per byte. The counts of
+/// all 5 k-tuplet types are packed into one 64-bit
+/// table entry using 10 bits per type.
 ///
 void PrintPrimes::initCounts()
 {
-  for (uint_t i = 1; i < counts_.size(); i++)
-  {
-    if (!ps_.isCount(i))
-      continue;
+  kCounts_.resize(256);
 
-    kCounts_[i].resize(256);
+  for (uint64_t j = 0; j < 256; j++)
+  {
+    uint64_t packed = 0;
 
-    for (uint64_t j = 0; j < 256; j++)
+    for (uint_t i = 1; i < counts_.size(); i++)
     {
-      byte_t count = 0;
+      uint64_t count = 0;
       for (const uint64_t* b = bitmasks_[i]; *b <= j; b++)
       {
         if ((j & *b) == *b)
           count++;
       }
-      kCounts_[i][j] = count;
+      packed |= count << ((i - 1) * 10);
     }
+
+    kCounts_[j] = packed;
   }
 }
 
 void PrintPrimes::sieve()
 {
-  SievingPrimes sievingPrimes(this, preSieve_);
+  AsyncSievingPrimes sievingPrimes(this, preSieve_);
   uint64_t prime = sievingPrimes.next();
 
   while (hasNextSegment())
@@ -95,17 +213,31 @@ void PrintPrimes::sieve()
     sieveSegment();
     print();
   }
+
+  // emit the last (possibly partial) interval, if stop
+  // is an interval boundary the trailing interval would
+  // contain no number except stop itself
+  if (histWidth_ > 0 &&
+      (histCount_ > 0 || histLow_ < stop_))
+    printHistogramInterval();
 }
 
 /// Executed after each sieved segment
 void PrintPrimes::print()
 {
-  if (ps_.isCountPrimes())
-    countPrimes();
+  countPrimes();
+  if (histWidth_ > 0)
+    countHistogram();
   if (ps_.isCountkTuplets())
     countkTuplets();
   if (ps_.isPrintPrimes())
-    printPrimes();
+  {
+    if (ps_.isFlag(PRINT_BINARY) ||
+        ps_.isFlag(PRINT_VARINT))
+      printBinaryPrimes();
+    else
+      printPrimes();
+  }
   if (ps_.isPrintkTuplets())
     printkTuplets();
 
@@ -113,56 +245,351 @@ void PrintPrimes::print()
     ps_.updateStatus(sieveSize_ * 30);
 }
 
+/// Invoked by Erat::crossOff() for each finished L1-sized
+/// block of the segment while the cross-off continues
+/// ahead. The block's primes are counted here while its
+/// bytes are still cache resident, countPrimes() then only
+/// processes the bytes not covered.
+///
+void PrintPrimes::processBlock(uint64_t i, uint64_t blockSize)
+{
+  // only contiguous, word-sized blocks whose numbers are
+  // all <= countStop_ are counted here, the remaining
+  // bytes (e.g. the chunk overlap in the last segment,
+  // trimmed only after crossOff()) are left to
+  // countPrimes() which handles them bit by bit
+  if (i == pipeBytes_ &&
+      blockSize % 8 == 0 &&
+      checkedAdd(low_, (i + blockSize - 1) * 30 + 31) <= countStop_)
+  {
+    pipeCount_ += popcount((const uint64_t*) &sieve_[i], blockSize / 8);
+    pipeBytes_ += blockSize;
+  }
+}
+
+/// Executed for every segment, even without the
+/// COUNT_PRIMES flag: the segment's popcount is nearly
+/// free and feeds the running progress counter that can
+/// be polled via PrimeSieve::getRunningCount().
+/// Most bytes have usually already been counted by
+/// processBlock() right after they were sieved.
+///
 void PrintPrimes::countPrimes()
 {
-  uint64_t size = ceilDiv(sieveSize_, 8);
-  counts_[0] += popcount((const uint64_t*) sieve_, size);
+  stats::Timer timer(stats::COUNT);
+  uint64_t sum = pipeCount_;
+  uint64_t countedBytes = pipeBytes_;
+  pipeCount_ = 0;
+  pipeBytes_ = 0;
+
+  // all numbers of this segment are <= countStop_,
+  // count the remaining sieve array with whole popcounts
+  if (checkedAdd(low_, (sieveSize_ - 1) * 30 + 31) <= countStop_)
+  {
+    uint64_t size = ceilDiv(sieveSize_ - countedBytes, 8);
+    sum += popcount((const uint64_t*) &sieve_[countedBytes], size);
+  }
+  else
+  {
+    // the segment extends beyond countStop_ (the chunk
+    // overlap is sieved only for counting k-tuplets that
+    // span the chunk boundary), count the bits whose
+    // numbers are <= countStop_. processBlock() only
+    // counts blocks fully below countStop_, hence
+    // countedBytes <= fullBytes
+    uint64_t fullBytes = 0;
+    if (countStop_ >= checkedAdd(low_, 31))
+      fullBytes = min((countStop_ - 31 - low_) / 30 + 1, sieveSize_);
+
+    uint64_t words = (fullBytes - countedBytes) / 8;
+    sum += popcount((const uint64_t*) &sieve_[countedBytes], words);
+
+    for (uint64_t i = countedBytes + words * 8; i < sieveSize_; i++)
+    {
+      uint64_t base = low_ + i * 30;
+      for (int b = 0; b < 8; b++)
+        if (sieve_[i] & (1 << b))
+          sum += (checkedAdd(base, bitValues[b]) <= countStop_);
+    }
+  }
+
+  if (ps_.isCountPrimes())
+    counts_[0] += sum;
+
+  ps_.addRunningCount(sum);
 }
 
-void PrintPrimes::countkTuplets()
+/// Accumulate the segment's primes into the histogram
+/// intervals [k*width, (k+1)*width[. Runs of bytes inside
+/// the current interval are counted with whole 64-bit
+/// popcounts, only the byte containing an interval
+/// boundary is split bit by bit.
+///
+void PrintPrimes::countHistogram()
 {
-  // i = 1 twins, i = 2 triplets, ...
-  for (uint_t i = 1; i < counts_.size(); i++)
+  stats::Timer timer(stats::COUNT);
+  uint64_t i = 0;
+
+  while (i < sieveSize_)
   {
-    if (!ps_.isCount(i))
+    uint64_t base = low_ + i * 30;
+    uint64_t intervalHigh = checkedAdd(histLow_, histWidth_);
+
+    // all numbers of this byte are < intervalHigh,
+    // count the run of such bytes in bulk
+    if (checkedAdd(base, 31) < intervalHigh)
+    {
+      uint64_t j = min((intervalHigh - 32 - low_) / 30 + 1, sieveSize_);
+
+      // the sieve array is 8-byte aligned but i may not be
+      for (; i % 8 != 0 && i < j; i++)
+        for (int b = 0; b < 8; b++)
+          histCount_ += (sieve_[i] >> b) & 1;
+
+      uint64_t words = (j - i) / 8;
+      histCount_ += popcount((const uint64_t*) &sieve_[i], words);
+
+      for (i += words * 8; i < j; i++)
+        for (int b = 0; b < 8; b++)
+          histCount_ += (sieve_[i] >> b) & 1;
+
       continue;
+    }
 
-    uint64_t sum = 0;
+    // the current interval ends before this
+    // byte's first bit value
+    if (intervalHigh <= checkedAdd(base, 7))
+    {
+      printHistogramInterval();
+      continue;
+    }
+
+    // the interval boundary falls inside this byte,
+    // split its bits between the two intervals
+    uint64_t carry = 0;
+
+    for (int b = 0; b < 8; b++)
+    {
+      if (sieve_[i] & (1 << b))
+      {
+        if (checkedAdd(base, bitValues[b]) < intervalHigh)
+          histCount_++;
+        else
+          carry++;
+      }
+    }
+
+    printHistogramInterval();
+    histCount_ = carry;
+    i++;
+  }
+}
+
+/// Print "intervalStart primeCount" for the current
+/// histogram interval and move to the next one
+///
+void PrintPrimes::printHistogramInterval()
+{
+  cout << histLow_ << " " << histCount_ << "\n";
+  histLow_ = checkedAdd(histLow_, histWidth_);
+  histCount_ = 0;
+}
+
+/// Count the twins, triplets, ... of the current segment
+/// in a single pass over the sieve array, one table
+/// lookup per byte serves all requested k-tuplet counts
+///
+void PrintPrimes::countkTuplets()
+{
+  stats::Timer timer(stats::COUNT);
 
-    for (uint64_t j = 0; j < sieveSize_; j += 4)
+  uint64_t sums[6] = { 0, 0, 0, 0, 0, 0 };
+
+  // bytes whose k-tuplets all start at numbers <= countStop_
+  uint64_t fullBytes = sieveSize_;
+  if (checkedAdd(low_, (sieveSize_ - 1) * 30 + 31) > countStop_)
+  {
+    fullBytes = 0;
+    if (countStop_ >= checkedAdd(low_, 31))
+      fullBytes = min((countStop_ - 31 - low_) / 30 + 1, sieveSize_);
+    fullBytes -= fullBytes % 4;
+  }
+
+  for (uint64_t j = 0; j < fullBytes;)
+  {
+    // a byte contains at most 4 k-tuplets of one type,
+    // hence 128 bytes can be accumulated into the
+    // 10-bit fields without overflow
+    uint64_t chunkEnd = min(j + 128, fullBytes);
+    uint64_t packed = 0;
+
+    for (; j < chunkEnd; j += 4)
     {
-      sum += kCounts_[i][sieve_[j+0]];
-      sum += kCounts_[i][sieve_[j+1]];
-      sum += kCounts_[i][sieve_[j+2]];
-      sum += kCounts_[i][sieve_[j+3]];
+      packed += kCounts_[sieve_[j+0]];
+      packed += kCounts_[sieve_[j+1]];
+      packed += kCounts_[sieve_[j+2]];
+      packed += kCounts_[sieve_[j+3]];
     }
 
-    counts_[i] += sum;
+    // i = 1 twins, i = 2 triplets, ...
+    for (uint_t i = 1; i < counts_.size(); i++)
+      sums[i] += (packed >> ((i - 1) * 10)) & 1023;
   }
+
+  // boundary bytes: count only the k-tuplets whose first
+  // prime is <= countStop_, k-tuplets spanning the chunk
+  // boundary belong to the chunk of their first prime
+  for (uint64_t j = fullBytes; j < sieveSize_; j++)
+  {
+    uint64_t base = low_ + j * 30;
+
+    for (uint_t i = 1; i < counts_.size(); i++)
+    {
+      for (const uint64_t* b = bitmasks_[i]; *b != END; b++)
+      {
+        if ((sieve_[j] & *b) == *b)
+        {
+          // lowest bit of the bitmask = first prime
+          int first = 0;
+          while (!(*b >> first & 1))
+            first++;
+          if (checkedAdd(base, bitValues[first]) <= countStop_)
+            sums[i]++;
+        }
+      }
+    }
+  }
+
+  for (uint_t i = 1; i < counts_.size(); i++)
+    if (ps_.isCount(i))
+      counts_[i] += sums[i];
 }
 
-/// Print primes to stdout
+/// Print primes to stdout. The primes are formatted into
+/// a large buffer using a fast integer-to-string routine
+/// and the buffer is flushed with a single write, this is
+/// much faster than formatting each prime individually
+/// using std::ostringstream.
+///
 void PrintPrimes::printPrimes() const
 {
-  uint64_t i = 0;
   uint64_t low = low_;
 
-  while (i < sieveSize_)
+  // up to 21 bytes may be appended
+  // past the flush threshold
+  vector<char> buffer;
+  buffer.reserve((1 << 21) + 21);
+
+  // uint64_t has at most 20 digits
+  char str[20];
+  char* strEnd = str + 20;
+
+  for (uint64_t i = 0; i < sieveSize_; i += 8)
+  {
+    uint64_t bits = littleendian_cast<uint64_t>(&sieve_[i]);
+
+    while (bits)
+    {
+      uint64_t prime = nextPrime(&bits, low);
+
+      // format the digits backwards
+      char* pos = strEnd;
+      do
+      {
+        *--pos = '0' + (char) (prime % 10);
+        prime /= 10;
+      }
+      while (prime > 0);
+
+      buffer.insert(buffer.end(), pos, strEnd);
+      buffer.push_back('\n');
+    }
+
+    low += 8 * 30;
+
+    if (buffer.size() >= (1 << 21))
+    {
+      fwrite(buffer.data(), 1, buffer.size(), stdout);
+      buffer.clear();
+    }
+  }
+
+  if (!buffer.empty())
+    fwrite(buffer.data(), 1, buffer.size(), stdout);
+}
+
+/// Print primes to stdout in binary format, either as raw
+/// little-endian uint64 or as delta encoded varints. The
+/// primes are encoded into a large buffer which is flushed
+/// with a single write per buffer, binary output is
+/// therefore limited by memory bandwidth instead of by
+/// integer-to-string formatting. The varint stream contains
+/// a sync point (0x00 marker + absolute prime) every 2^16
+/// primes which makes it seekable.
+///
+void PrintPrimes::printBinaryPrimes()
+{
+  bool varint = ps_.isFlag(PRINT_VARINT);
+  uint64_t low = low_;
+
+  // up to 64 bytes may be appended
+  // past the flush threshold
+  vector<byte_t> buffer;
+  buffer.reserve((1 << 21) + 64);
+
+  for (uint64_t i = 0; i < sieveSize_; i += 8)
   {
-    uint64_t size = min(i + (1 << 16), sieveSize_);
-    ostringstream primes;
+    uint64_t bits = littleendian_cast<uint64_t>(&sieve_[i]);
 
-    for (; i < size; i += 8)
+    while (bits)
     {
-      uint64_t bits = littleendian_cast<uint64_t>(&sieve_[i]);
-      while (bits)
-        primes << nextPrime(&bits, low) << '\n';
+      uint64_t prime = nextPrime(&bits, low);
+
+      if (varint)
+      {
+        // 7 bits per byte, high bit = continuation
+        uint64_t delta = prime - prevPrime_;
+        prevPrime_ = prime;
+
+        // Every 2^16 primes a sync point is emitted: a
+        // 0x00 marker byte followed by the absolute prime.
+        // A 0x00 byte cannot occur anywhere else in the
+        // stream (gaps are >= 1 and the encoding has no
+        // trailing zero byte), so a decoder can seek to
+        // any byte offset and scan forward to the next
+        // 0x00 to resynchronize.
+        if ((varintCount_++ & 0xffff) == 0)
+        {
+          buffer.push_back(0);
+          delta = prime;
+        }
 
-      low += 8 * 30;
+        while (delta >= 0x80)
+        {
+          buffer.push_back((byte_t) (delta | 0x80));
+          delta >>= 7;
+        }
+        buffer.push_back((byte_t) delta);
+      }
+      else
+      {
+        // raw little-endian uint64
+        for (int j = 0; j < 64; j += 8)
+          buffer.push_back((byte_t) (prime >> j));
+      }
     }
 
-    cout << primes.str();
+    low += 8 * 30;
+
+    if (buffer.size() >= (1 << 21))
+    {
+      fwrite(buffer.data(), 1, buffer.size(), stdout);
+      buffer.clear();
+    }
   }
+
+  if (!buffer.empty())
+    fwrite(buffer.data(), 1, buffer.size(), stdout);
 }
 
 /// Print prime k-tuplets to stdout
@@ -0,0 +1,423 @@
+///
+/// @file   SieveBitmap.cpp
+/// @brief  On-disk sieve bitmap files, see SieveBitmap.hpp.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve/SieveBitmap.hpp>
+#include <primesieve/PrimeGenerator.hpp>
+#include <primesieve/primesieve_error.hpp>
+#include <primesieve/replaceFile.hpp>
+#include <primesieve/types.hpp>
+
+#include <stdint.h>
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+#if !defined(_WIN32)
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+  #define HAS_MMAP
+#endif
+
+using namespace std;
+using namespace primesieve;
+
+namespace {
+
+/// File format: the 64 byte header below followed by the
+/// raw sieve bit array. The bitmap is contiguous and
+/// segment aligned, byte i covers the numbers
+/// low + i * 30 + {7, 11, 13, 17, 19, 23, 29, 31}, so the
+/// per-segment offset index degenerates to
+/// i * segmentBytes and needs no table.
+///
+const char magic[] = "primesieve-bitmap-1\n";
+
+struct Header
+{
+  char magic[sizeof(::magic)];
+  char pad[24 - sizeof(::magic)];
+  /// Base of the 1st bitmap byte, a multiple of 30
+  uint64_t low;
+  uint64_t start;
+  uint64_t stop;
+  /// Segment size in bytes used while writing
+  uint64_t segmentBytes;
+  /// Bitmap size in bytes
+  uint64_t bytes;
+};
+
+static_assert(sizeof(Header) == 64, "bitmap header must be 64 bytes");
+
+/// Bit i of a sieve byte corresponds
+/// to the number byteLow + bitValues[i]
+const array<uint64_t, 8> bitValues = { 7, 11, 13, 17, 19, 23, 29, 31 };
+
+/// unset bits < start
+const array<byte_t, 37> unsetSmaller =
+{
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xfe, 0xfe, 0xfe, 0xfe, 0xfc, 0xfc, 0xf8, 0xf8,
+  0xf8, 0xf8, 0xf0, 0xf0, 0xe0, 0xe0, 0xe0, 0xe0,
+  0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+/// unset bits > stop
+const array<byte_t, 37> unsetLarger =
+{
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x01, 0x01, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07,
+  0x07, 0x0f, 0x0f, 0x1f, 0x1f, 0x1f, 0x1f, 0x3f,
+  0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x7f, 0x7f, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff
+};
+
+/// The rank index stores one cumulative prime count per
+/// 64 kilobytes of bitmap (1 entry per 1,966,080 numbers),
+/// nthPrime() then popcounts at most 64 kilobytes
+const uint64_t rankSampleBytes = 1 << 16;
+
+/// Remainder of n mod 30 mapped into [7, 36] so that
+/// it indexes unsetSmaller & unsetLarger
+uint64_t byteRemainder(uint64_t n)
+{
+  return Erat::byteRemainder(n);
+}
+
+uint64_t popcountByte(byte_t byte)
+{
+  uint64_t n = byte;
+  return popcount(&n, 1);
+}
+
+/// Count the set bits of an arbitrary byte range
+uint64_t popcountBytes(const byte_t* bytes, uint64_t size)
+{
+  uint64_t count = 0;
+  uint64_t i = 0;
+
+  // align to an 8-byte boundary so the bulk of the
+  // bitmap is counted 64 bits at a time
+  for (; i < size && (uintptr_t) &bytes[i] % 8; i++)
+    count += popcountByte(bytes[i]);
+
+  uint64_t words = (size - i) / 8;
+  count += popcount((const uint64_t*) &bytes[i], words);
+  i += words * 8;
+
+  for (; i < size; i++)
+    count += popcountByte(bytes[i]);
+
+  return count;
+}
+
+} // namespace
+
+namespace primesieve {
+
+/// Sieve [start, stop] once and persist the raw sieve
+/// bitmap, streaming each segment to the file before the
+/// sieve reuses its buffer
+///
+void SieveBitmap::write(const string& path,
+                        uint64_t start,
+                        uint64_t stop)
+{
+  if (start > stop)
+    throw primesieve_error("SieveBitmap: start must be <= stop");
+
+  string tmpPath = path + ".tmp";
+  ofstream out(tmpPath, ofstream::binary);
+
+  if (!out)
+    throw primesieve_error("SieveBitmap: cannot write " + path);
+
+  Header header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, magic, sizeof(magic));
+  header.start = start;
+  header.stop = stop;
+  out.write((const char*) &header, sizeof(header));
+
+  PrimeGenerator gen(start, stop);
+  gen.forEachSegment(
+    [&](const uint8_t* sieve, size_t bytes, uint64_t low)
+    {
+      if (header.bytes == 0)
+        header.low = low;
+      if (header.segmentBytes == 0)
+        header.segmentBytes = bytes;
+
+      out.write((const char*) sieve, bytes);
+      header.bytes += bytes;
+    });
+
+  // rewrite the header with the final bitmap size
+  out.seekp(0);
+  out.write((const char*) &header, sizeof(header));
+  out.close();
+
+  if (!out)
+    throw primesieve_error("SieveBitmap: cannot write " + path);
+
+  // move the bitmap file into place,
+  // replacing an existing bitmap
+  if (!replaceFile(tmpPath, path))
+  {
+    remove(tmpPath.c_str());
+    throw primesieve_error("SieveBitmap: cannot update " + path);
+  }
+}
+
+SieveBitmap::SieveBitmap(const string& path)
+{
+  Header header;
+
+#if defined(HAS_MMAP)
+  int fd = open(path.c_str(), O_RDONLY);
+
+  if (fd < 0)
+    throw primesieve_error("SieveBitmap: cannot open " + path);
+
+  struct stat st;
+
+  if (fstat(fd, &st) < 0 ||
+      (uint64_t) st.st_size < sizeof(Header))
+  {
+    close(fd);
+    throw primesieve_error("SieveBitmap: corrupt file " + path);
+  }
+
+  void* addr = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+
+  if (addr == MAP_FAILED)
+    throw primesieve_error("SieveBitmap: cannot mmap " + path);
+
+  mapAddr_ = addr;
+  mapSize_ = st.st_size;
+  memcpy(&header, addr, sizeof(header));
+  bits_ = (const byte_t*) addr + sizeof(Header);
+#else
+  ifstream in(path, ifstream::binary);
+
+  if (!in ||
+      !in.read((char*) &header, sizeof(header)))
+    throw primesieve_error("SieveBitmap: cannot open " + path);
+
+  buffer_ = new byte_t[header.bytes];
+  in.read((char*) buffer_, header.bytes);
+
+  if (!in)
+    throw primesieve_error("SieveBitmap: corrupt file " + path);
+
+  bits_ = buffer_;
+#endif
+
+  if (memcmp(header.magic, magic, sizeof(magic)) != 0)
+    throw primesieve_error("SieveBitmap: corrupt file " + path);
+
+#if defined(HAS_MMAP)
+  if ((uint64_t) mapSize_ < sizeof(Header) + header.bytes)
+    throw primesieve_error("SieveBitmap: corrupt file " + path);
+#endif
+
+  start_ = header.start;
+  stop_ = header.stop;
+  low_ = header.low;
+  bytes_ = header.bytes;
+}
+
+SieveBitmap::~SieveBitmap()
+{
+#if defined(HAS_MMAP)
+  if (mapAddr_)
+    munmap(mapAddr_, mapSize_);
+#endif
+  delete [] buffer_;
+}
+
+void SieveBitmap::checkRange(uint64_t start, uint64_t stop) const
+{
+  if (start < start_ ||
+      stop > stop_)
+    throw primesieve_error("SieveBitmap: [start, stop] outside the file's range");
+}
+
+uint64_t SieveBitmap::countPrimes(uint64_t start, uint64_t stop) const
+{
+  checkRange(start, stop);
+
+  if (start > stop)
+    return 0;
+
+  uint64_t count = 0;
+
+  // the primes 2, 3 and 5 are not
+  // representable in the bitmap
+  for (uint64_t p : { 2ull, 3ull, 5ull })
+    if (p >= start && p <= stop)
+      count++;
+
+  start = max<uint64_t>(start, 7);
+  if (start > stop || bytes_ == 0)
+    return count;
+
+  uint64_t remStart = byteRemainder(start);
+  uint64_t remStop = byteRemainder(stop);
+  uint64_t i = ((start - remStart) - low_) / 30;
+  uint64_t j = ((stop - remStop) - low_) / 30;
+
+  if (i == j)
+    return count + popcountByte(bits_[i] & unsetSmaller[remStart] & unsetLarger[remStop]);
+
+  count += popcountByte(bits_[i] & unsetSmaller[remStart]);
+  count += popcountBytes(&bits_[i + 1], j - (i + 1));
+  count += popcountByte(bits_[j] & unsetLarger[remStop]);
+
+  return count;
+}
+
+void SieveBitmap::forEachPrime(uint64_t start,
+                               uint64_t stop,
+                               const function<void(uint64_t)>& callback) const
+{
+  checkRange(start, stop);
+
+  if (start > stop)
+    return;
+
+  for (uint64_t p : { 2ull, 3ull, 5ull })
+    if (p >= start && p <= stop)
+      callback(p);
+
+  uint64_t low = max<uint64_t>(start, 7);
+  if (low > stop || bytes_ == 0)
+    return;
+
+  uint64_t remStart = byteRemainder(low);
+  uint64_t remStop = byteRemainder(stop);
+  uint64_t i = ((low - remStart) - low_) / 30;
+  uint64_t j = ((stop - remStop) - low_) / 30;
+  uint64_t byteLow = low - remStart;
+
+  for (; i <= j; i++, byteLow += 30)
+  {
+    byte_t byte = bits_[i];
+
+    if (byteLow + 7 < low)
+      byte &= unsetSmaller[byteRemainder(low)];
+    if (i == j)
+      byte &= unsetLarger[remStop];
+
+    for (uint64_t bit = 0; bit < 8; bit++)
+      if (byte & (1u << bit))
+        callback(byteLow + bitValues[bit]);
+  }
+}
+
+/// Build the sampled rank index, rankIndex_[k] is the
+/// number of set bits in the first k * rankSampleBytes
+/// bitmap bytes
+///
+void SieveBitmap::initRankIndex()
+{
+  rankIndex_.reserve(bytes_ / rankSampleBytes + 2);
+  rankIndex_.push_back(0);
+  uint64_t count = 0;
+
+  for (uint64_t i = 0; i < bytes_; i += rankSampleBytes)
+  {
+    uint64_t size = min(rankSampleBytes, bytes_ - i);
+    count += popcountBytes(&bits_[i], size);
+    rankIndex_.push_back(count);
+  }
+}
+
+/// Find the nth prime > start
+uint64_t SieveBitmap::nthPrime(uint64_t n, uint64_t start)
+{
+  checkRange(start, start);
+
+  if (n == 0)
+    throw primesieve_error("SieveBitmap: n must be >= 1");
+
+  // the primes 2, 3 and 5 are not
+  // representable in the bitmap
+  for (uint64_t p : { 2ull, 3ull, 5ull })
+  {
+    if (p > start)
+    {
+      if (p > stop_)
+        throw primesieve_error("SieveBitmap: nth prime > getStop()");
+      if (--n == 0)
+        return p;
+    }
+  }
+
+  if (rankIndex_.empty())
+    initRankIndex();
+
+  // count the set bits below low using the rank
+  // index, the nth prime then corresponds to the
+  // (rank + n)th set bit of the bitmap
+  uint64_t low = max<uint64_t>(start + 1, 7);
+  uint64_t rank = 0;
+
+  if (low > low_ + 6)
+  {
+    uint64_t rem = byteRemainder(low);
+    uint64_t i = ((low - rem) - low_) / 30;
+
+    if (i >= bytes_)
+      throw primesieve_error("SieveBitmap: nth prime > getStop()");
+
+    uint64_t k = i / rankSampleBytes;
+    rank = rankIndex_[k];
+    rank += popcountBytes(&bits_[k * rankSampleBytes], i - k * rankSampleBytes);
+    rank += popcountByte(bits_[i] & (byte_t) ~unsetSmaller[rem]);
+  }
+
+  uint64_t target = rank + n;
+
+  if (target > rankIndex_.back())
+    throw primesieve_error("SieveBitmap: nth prime > getStop()");
+
+  // binary search the sample block containing the
+  // target rank, then scan at most rankSampleBytes
+  auto it = upper_bound(rankIndex_.begin(), rankIndex_.end(), target - 1);
+  uint64_t k = (uint64_t) (it - rankIndex_.begin()) - 1;
+  uint64_t count = rankIndex_[k];
+
+  for (uint64_t i = k * rankSampleBytes; i < bytes_; i++)
+  {
+    byte_t byte = bits_[i];
+    uint64_t c = popcountByte(byte);
+
+    if (count + c >= target)
+    {
+      for (uint64_t bit = 0; bit < 8; bit++)
+        if (byte & (1u << bit))
+          if (++count == target)
+            return low_ + i * 30 + bitValues[bit];
+    }
+
+    count += c;
+  }
+
+  throw primesieve_error("SieveBitmap: corrupt rank index");
+}
+
+} // namespace
@@ -11,10 +11,12 @@
 #include <primesieve/SievingPrimes.hpp>
 #include <primesieve/Erat.hpp>
 #include <primesieve/PreSieve.hpp>
+#include <primesieve/SievingPrimesCache.hpp>
 #include <primesieve/littleendian_cast.hpp>
 #include <primesieve/pmath.hpp>
 
 #include <stdint.h>
+#include <algorithm>
 #include <vector>
 
 namespace primesieve {
@@ -31,6 +33,10 @@ void SievingPrimes::init(Erat* erat, PreSieve& preSieve)
              erat->getSieveSize(),
              preSieve);
 
+  // the 1st segment may not start at 0,
+  // e.g. segmentLow_ = 30 if start_ = 38
+  low_ = segmentLow_;
+
   tinySieve();
 }
 
@@ -72,13 +78,24 @@ bool SievingPrimes::sieveSegment()
   if (hasNextSegment())
   {
     sieveIdx_ = 0;
-    uint64_t high = segmentHigh_;
+    SievingPrimesCache& cache = SievingPrimesCache::getInstance();
+    const byte_t* bits = cache.coveringBits(segmentHigh_);
+
+    // copy the segment from the cache
+    // (if available) instead of sieving it
+    if (bits)
+      copyCachedSegment(bits);
+    else
+    {
+      uint64_t high = segmentHigh_;
 
-    for (uint64_t& i = tinyIdx_; i * i <= high; i += 2)
-      if (tinySieve_[i])
-        addSievingPrime(i);
+      for (uint64_t& i = tinyIdx_; i * i <= high; i += 2)
+        if (tinySieve_[i])
+          addSievingPrime(i);
+
+      Erat::sieveSegment();
+    }
 
-    Erat::sieveSegment();
     return true;
   }
   else
@@ -90,4 +107,44 @@ bool SievingPrimes::sieveSegment()
   }
 }
 
+/// Copy the current segment from the memory mapped
+/// cache file, mirrors Erat::sieveSegment() but
+/// without any sieving.
+///
+void SievingPrimes::copyCachedSegment(const byte_t* bits)
+{
+  if (segmentHigh_ == stop_)
+  {
+    uint64_t rem = byteRemainder(stop_);
+    uint64_t dist = (stop_ - rem) - segmentLow_;
+    sieveSize_ = dist / 30 + 1;
+    std::copy_n(&bits[segmentLow_ / 30], sieveSize_, sieve_);
+
+    // zero the padding bytes read by fill()
+    uint64_t bytes = sieveSize_ % 8;
+    bytes = (8 - bytes) % 8;
+    std::fill_n(&sieve_[sieveSize_], bytes, 0);
+
+    segmentLow_ = stop_;
+  }
+  else
+  {
+    std::copy_n(&bits[segmentLow_ / 30], sieveSize_, sieve_);
+
+    uint64_t dist = sieveSize_ * 30;
+
+    if (uncheckedSegments_)
+    {
+      segmentLow_ += dist;
+      segmentHigh_ = std::min(segmentHigh_ + dist, stop_);
+    }
+    else
+    {
+      segmentLow_ = checkedAdd(segmentLow_, dist);
+      segmentHigh_ = checkedAdd(segmentHigh_, dist);
+      segmentHigh_ = std::min(segmentHigh_, stop_);
+    }
+  }
+}
+
 } // namespace
@@ -0,0 +1,299 @@
+///
+/// @file   SievingPrimesCache.cpp
+/// @brief  Optional on-disk cache of the sieve of Eratosthenes
+///         bit array, see SievingPrimesCache.hpp.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve/SievingPrimesCache.hpp>
+#include <primesieve/Erat.hpp>
+#include <primesieve/PreSieve.hpp>
+#include <primesieve/SievingPrimes.hpp>
+#include <primesieve/calculator.hpp>
+#include <primesieve/pmath.hpp>
+#include <primesieve/replaceFile.hpp>
+#include <primesieve/types.hpp>
+
+#include <stdint.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if !defined(_WIN32)
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+  #define HAS_MMAP
+#endif
+
+using namespace std;
+using namespace primesieve;
+
+namespace {
+
+/// Cache file magic bytes followed
+/// by the limit (8 bytes)
+const char magic[] = "primesieve-cache-1\n";
+
+const uint64_t headerSize = sizeof(magic) + sizeof(uint64_t);
+
+/// Default cache limit, i.e. sieving primes
+/// up to sqrt(1e18) are cached
+const uint64_t defaultLimit = (uint64_t) 1e9;
+
+/// Writes the sieve of Eratosthenes bit array
+/// for [start, stop] to the out buffer
+///
+class BitmapSieve : public Erat
+{
+public:
+  BitmapSieve(uint64_t start, uint64_t stop, byte_t* out) :
+    preSieve_(start, stop),
+    out_(out)
+  {
+    Erat::init(start, stop, get_sieve_size(), preSieve_);
+  }
+
+  void sieve()
+  {
+    SievingPrimes sievingPrimes(this, preSieve_);
+    uint64_t prime = sievingPrimes.next();
+
+    while (hasNextSegment())
+    {
+      uint64_t sqrtHigh = isqrt(segmentHigh_);
+
+      for (; prime <= sqrtHigh; prime = sievingPrimes.next())
+        addSievingPrime(prime);
+
+      sieveSegment();
+      std::copy_n(sieve_, sieveSize_, out_);
+      out_ += sieveSize_;
+    }
+  }
+
+private:
+  PreSieve preSieve_;
+  byte_t* out_;
+};
+
+/// Sieve [7, bytes * 30 + 6] into the bitmap using multiple
+/// threads. The chunks are byte aligned (1 byte covers 30
+/// numbers) so each thread writes a disjoint byte range of
+/// the shared bitmap and no chunk boundary splits a byte.
+///
+void parallelSieve(byte_t* bits, uint64_t bytes, int threads)
+{
+  uint64_t threadBytes = ceilDiv(bytes, threads);
+  // tiny chunks cannot amortize the sieve
+  // initialization, 2^21 bytes cover ~6e7 numbers
+  threadBytes = std::max(threadBytes, (uint64_t) 1 << 21);
+  vector<future<void>> futures;
+
+  for (uint64_t b = 0; b < bytes; b += threadBytes)
+  {
+    uint64_t stopByte = min(b + threadBytes, bytes);
+
+    futures.emplace_back(async(launch::async, [bits, b, stopByte]
+    {
+      // both bounds map to whole sieve bytes: the first
+      // byte's lowest bit is start (no bits are zeroed
+      // below start) and the last byte's highest bit
+      // is below stop (no bits are zeroed above stop)
+      uint64_t start = b * 30 + 7;
+      uint64_t stop = stopByte * 30 + 6;
+      BitmapSieve bitmapSieve(start, stop, &bits[b]);
+      bitmapSieve.sieve();
+    }));
+  }
+
+  for (auto& future : futures)
+    future.get();
+}
+
+} // namespace
+
+namespace primesieve {
+
+SievingPrimesCache& SievingPrimesCache::getInstance()
+{
+  static SievingPrimesCache cache;
+  cache.init();
+  return cache;
+}
+
+void SievingPrimesCache::init()
+{
+#if defined(HAS_MMAP)
+  if (ready_.load(memory_order_acquire))
+    return;
+
+  // generating the cache file sieves using SievingPrimes,
+  // possibly on multiple threads, which call back into
+  // getInstance(), skip the nested init() so that the
+  // generating sieves run uncached
+  if (initializing_.load())
+    return;
+
+  unique_lock<mutex> lock(initLock_);
+
+  if (!ready_.load())
+  {
+    initializing_ = true;
+    const char* path = getenv("PRIMESIEVE_CACHE");
+
+    if (path && !load(path))
+    {
+      uint64_t limit = defaultLimit;
+      const char* str = getenv("PRIMESIEVE_CACHE_LIMIT");
+
+      if (str)
+        limit = calculator::eval<uint64_t>(str);
+
+      generate(path, limit);
+      load(path);
+    }
+
+    initializing_ = false;
+    ready_.store(true, memory_order_release);
+  }
+#endif
+}
+
+SievingPrimesCache::~SievingPrimesCache()
+{
+#if defined(HAS_MMAP)
+  if (mapAddr_)
+    munmap(mapAddr_, mapSize_);
+#endif
+}
+
+/// Sieve [0, limit] and write the sieve bit
+/// array to the cache file
+///
+void SievingPrimesCache::generate(const string& path, uint64_t limit)
+{
+  string tmpPath = path + ".tmp";
+  ofstream out(tmpPath, ofstream::binary);
+
+  if (!out)
+    return;
+
+  // round the limit up to whole sieve bytes so that no
+  // bits of the last byte are zeroed by the sieve,
+  // coverage may then be claimed for all n <= limit
+  uint64_t bytes = limit / 30 + 1;
+  limit = bytes * 30 + 6;
+
+  vector<byte_t> bits(bytes, 0);
+  int threads = max<int>(1, thread::hardware_concurrency());
+  parallelSieve(&bits[0], bytes, threads);
+
+  out.write(magic, sizeof(magic));
+  out.write((const char*) &limit, sizeof(limit));
+  out.write((const char*) &bits[0], bits.size());
+  out.close();
+
+  // move the cache file into place, replacing a stale
+  // cache. Best effort like the write errors above, but a
+  // failed move removes the temporary file instead of
+  // leaking it on every run
+  if (!replaceFile(tmpPath, path))
+    remove(tmpPath.c_str());
+}
+
+/// Generate the shared in-memory bitmap up to limit using
+/// multiple threads. ParallelSieve calls this before
+/// launching its workers so that the sieving primes up to
+/// sqrt(stop) are sieved once, in parallel, instead of
+/// once per worker inside its Erat init. The bitmap is
+/// kept for later sieves, it uses limit / 30 bytes of
+/// memory (e.g. 105 MB at limit = sqrt(1e19)).
+///
+void SievingPrimesCache::preGenerate(uint64_t limit, int threads)
+{
+  // below this limit each worker generates its sieving
+  // primes in a few milliseconds, sharing the bitmap
+  // would only cost memory
+  const uint64_t minLimit = (uint64_t) 1e8;
+
+  if (limit < minLimit ||
+      coveringBits(limit))
+    return;
+
+  unique_lock<mutex> lock(generateLock_);
+
+  if (coveringBits(limit))
+    return;
+
+  uint64_t bytes = limit / 30 + 1;
+  unique_ptr<Bitmap> bitmap(new Bitmap);
+  bitmap->limit = bytes * 30 + 6;
+  bitmap->bits.resize(bytes, 0);
+  parallelSieve(&bitmap->bits[0], bytes, threads);
+
+  const Bitmap* ptr = bitmap.get();
+  bitmaps_.push_back(unique_ptr<const Bitmap>(bitmap.release()));
+  shared_.store(ptr, memory_order_release);
+}
+
+/// Memory map the cache file (zero-copy)
+bool SievingPrimesCache::load(const string& path)
+{
+#if defined(HAS_MMAP)
+  int fd = open(path.c_str(), O_RDONLY);
+
+  if (fd < 0)
+    return false;
+
+  struct stat st;
+
+  if (fstat(fd, &st) < 0 ||
+      (uint64_t) st.st_size <= headerSize)
+  {
+    close(fd);
+    return false;
+  }
+
+  void* addr = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+
+  if (addr == MAP_FAILED)
+    return false;
+
+  uint64_t limit;
+  memcpy(&limit, (const char*) addr + sizeof(magic), sizeof(limit));
+
+  // verify the header and that the bitmap
+  // is complete up to limit
+  if (memcmp(addr, magic, sizeof(magic)) != 0 ||
+      (uint64_t) st.st_size < headerSize + (limit - 6) / 30)
+  {
+    munmap(addr, st.st_size);
+    return false;
+  }
+
+  mapAddr_ = addr;
+  mapSize_ = st.st_size;
+  bits_ = (byte_t*) addr + headerSize;
+  limit_ = limit;
+  return true;
+#else
+  (void) path;
+  return false;
+#endif
+}
+
+} // namespace
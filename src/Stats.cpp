@@ -0,0 +1,270 @@
+///
+/// @file   Stats.cpp
+/// @brief  Phase-level performance instrumentation, only
+///         compiled in with -DENABLE_STATS.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve/Stats.hpp>
+
+#if defined(ENABLE_STATS)
+
+#include <stdint.h>
+#include <atomic>
+#include <chrono>
+#include <sstream>
+
+#if defined(__linux__)
+  #include <linux/perf_event.h>
+  #include <sys/syscall.h>
+  #include <unistd.h>
+  #include <cstring>
+#endif
+
+namespace {
+
+const char* phaseNames[primesieve::stats::PHASES] =
+{
+  "preSieve",
+  "eratSmall",
+  "eratMedium",
+  "eratBig",
+  "count"
+};
+
+const char* counterNames[primesieve::stats::COUNTERS] =
+{
+  "segments",
+  "bucketAllocs",
+  "buckets"
+};
+
+std::atomic<uint64_t> phaseNanos[primesieve::stats::PHASES];
+std::atomic<uint64_t> counters[primesieve::stats::COUNTERS];
+
+#if defined(__linux__)
+
+const char* perfNames[primesieve::stats::PERF_EVENTS] =
+{
+  "cycles",
+  "instructions",
+  "llcMisses",
+  "dtlbMisses"
+};
+
+std::atomic<uint64_t> perfCounts[primesieve::stats::PHASES]
+                                [primesieve::stats::PERF_EVENTS];
+
+/// true if at least one thread has successfully
+/// opened its hardware counters
+std::atomic<bool> perfAvailable(false);
+
+/// Per-thread set of hardware counters. The counters run
+/// freely from the moment they are opened, the Timer reads
+/// them at scope entry and exit and accumulates the deltas.
+/// If perf_event_open() is not permitted (e.g. inside
+/// containers or with kernel.perf_event_paranoid > 2) the
+/// perf section is simply omitted from the JSON report.
+///
+class PerfCounters
+{
+public:
+  PerfCounters()
+  {
+    using namespace primesieve::stats;
+
+    const uint32_t types[PERF_EVENTS] =
+    {
+      PERF_TYPE_HARDWARE,
+      PERF_TYPE_HARDWARE,
+      PERF_TYPE_HW_CACHE,
+      PERF_TYPE_HW_CACHE
+    };
+
+    const uint64_t configs[PERF_EVENTS] =
+    {
+      PERF_COUNT_HW_CPU_CYCLES,
+      PERF_COUNT_HW_INSTRUCTIONS,
+      PERF_COUNT_HW_CACHE_LL |
+      (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+      (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+      PERF_COUNT_HW_CACHE_DTLB |
+      (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+      (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)
+    };
+
+    ok_ = true;
+
+    for (int i = 0; i < PERF_EVENTS; i++)
+    {
+      perf_event_attr attr;
+      std::memset(&attr, 0, sizeof(attr));
+      attr.size = sizeof(attr);
+      attr.type = types[i];
+      attr.config = configs[i];
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+
+      fds_[i] = (int) syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+      ok_ &= (fds_[i] >= 0);
+    }
+
+    if (ok_)
+      perfAvailable.store(true);
+  }
+
+  ~PerfCounters()
+  {
+    using namespace primesieve::stats;
+
+    for (int i = 0; i < PERF_EVENTS; i++)
+      if (fds_[i] >= 0)
+        close(fds_[i]);
+  }
+
+  bool read(uint64_t values[primesieve::stats::PERF_EVENTS])
+  {
+    using namespace primesieve::stats;
+
+    if (!ok_)
+      return false;
+
+    for (int i = 0; i < PERF_EVENTS; i++)
+      if (::read(fds_[i], &values[i], sizeof(uint64_t)) != sizeof(uint64_t))
+        return false;
+
+    return true;
+  }
+
+private:
+  int fds_[primesieve::stats::PERF_EVENTS];
+  bool ok_;
+};
+
+thread_local PerfCounters perfCounters;
+
+#endif
+
+uint64_t nanosNow()
+{
+  using namespace std::chrono;
+  auto now = steady_clock::now().time_since_epoch();
+  return duration_cast<nanoseconds>(now).count();
+}
+
+} // namespace
+
+namespace primesieve {
+namespace stats {
+
+void addNanos(Phase phase, uint64_t nanos)
+{
+  phaseNanos[phase].fetch_add(nanos, std::memory_order_relaxed);
+}
+
+void inc(Counter counter, uint64_t count)
+{
+  counters[counter].fetch_add(count, std::memory_order_relaxed);
+}
+
+void reset()
+{
+  for (auto& nanos : phaseNanos)
+    nanos.store(0);
+  for (auto& counter : counters)
+    counter.store(0);
+
+#if defined(__linux__)
+  for (auto& phase : perfCounts)
+    for (auto& count : phase)
+      count.store(0);
+#endif
+}
+
+std::string getJson()
+{
+  std::ostringstream json;
+  json << "{\n";
+  json << "  \"seconds\": {\n";
+
+  for (int i = 0; i < PHASES; i++)
+  {
+    json << "    \"" << phaseNames[i] << "\": "
+         << phaseNanos[i].load() / 1e9
+         << ((i + 1 < PHASES) ? ",\n" : "\n");
+  }
+
+  json << "  },\n";
+  json << "  \"counters\": {";
+
+  for (int i = 0; i < COUNTERS; i++)
+  {
+    json << "\n    \"" << counterNames[i] << "\": "
+         << counters[i].load()
+         << ((i + 1 < COUNTERS) ? "," : "\n  }");
+  }
+
+#if defined(__linux__)
+  if (perfAvailable.load())
+  {
+    json << ",\n";
+    json << "  \"perf\": {\n";
+
+    for (int i = 0; i < PHASES; i++)
+    {
+      json << "    \"" << phaseNames[i] << "\": {";
+
+      for (int j = 0; j < PERF_EVENTS; j++)
+      {
+        json << " \"" << perfNames[j] << "\": "
+             << perfCounts[i][j].load()
+             << ((j + 1 < PERF_EVENTS) ? "," : " }");
+      }
+
+      json << ((i + 1 < PHASES) ? ",\n" : "\n");
+    }
+
+    json << "  }";
+  }
+#endif
+
+  json << "\n}";
+
+  return json.str();
+}
+
+Timer::Timer(Phase phase)
+  : phase_(phase),
+    start_(nanosNow())
+{
+#if defined(__linux__)
+  if (!perfCounters.read(perf_))
+    std::memset(perf_, 0xff, sizeof(perf_));
+#endif
+}
+
+Timer::~Timer()
+{
+  addNanos(phase_, nanosNow() - start_);
+
+#if defined(__linux__)
+  uint64_t values[PERF_EVENTS];
+
+  if (perf_[0] != ~0ull &&
+      perfCounters.read(values))
+  {
+    for (int i = 0; i < PERF_EVENTS; i++)
+      perfCounts[phase_][i].fetch_add(values[i] - perf_[i],
+                                      std::memory_order_relaxed);
+  }
+#endif
+}
+
+} // namespace stats
+} // namespace primesieve
+
+#endif
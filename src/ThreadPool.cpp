@@ -0,0 +1,144 @@
+///
+/// @file   ThreadPool.cpp
+/// @brief  Persistent thread pool used by ParallelSieve. The
+///         worker threads are created lazily on first use and
+///         are reused by subsequent sieve() invocations, this
+///         avoids the thread creation and teardown overhead
+///         when sieving many medium ranges back to back.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve/ThreadPool.hpp>
+#include <primesieve/CpuInfo.hpp>
+#include <primesieve/ParallelSieve.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#if defined(__linux__)
+  #include <pthread.h>
+  #include <sched.h>
+#endif
+
+using namespace std;
+using namespace primesieve;
+
+namespace {
+
+/// On multi-socket systems pin each worker thread to one
+/// NUMA node (round robin) so that the sieve array, the
+/// PreSieve buffers and the EratBig buckets it allocates
+/// are placed on the local node via first touch.
+///
+void pinToNumaNode(size_t threadIdx)
+{
+#if defined(__linux__)
+  size_t nodes = cpuInfo.numaNodes();
+
+  if (nodes < 2)
+    return;
+
+  const vector<size_t>& cpus = cpuInfo.numaNodeCpus(threadIdx % nodes);
+  cpu_set_t cpuSet;
+  CPU_ZERO(&cpuSet);
+  size_t count = 0;
+
+  for (size_t cpu : cpus)
+    if (cpu < CPU_SETSIZE)
+    {
+      CPU_SET(cpu, &cpuSet);
+      count++;
+    }
+
+  if (count > 0)
+    pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet);
+#else
+  (void) threadIdx;
+#endif
+}
+
+} // namespace
+
+namespace primesieve {
+
+ThreadPool& ThreadPool::getInstance()
+{
+  static ThreadPool pool;
+  return pool;
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    unique_lock<mutex> lock(lock_);
+    stop_ = true;
+  }
+
+  pending_.notify_all();
+
+  for (auto& thread : threads_)
+    thread.join();
+}
+
+/// Start one worker thread per CPU core,
+/// executed on first submit() invocation
+///
+void ThreadPool::startThreads()
+{
+  int maxThreads = ParallelSieve::getMaxThreads();
+  threads_.reserve(maxThreads);
+
+  for (int i = 0; i < maxThreads; i++)
+    threads_.emplace_back(&ThreadPool::workerLoop, this, (size_t) i);
+}
+
+future<void> ThreadPool::submit(function<void()> task)
+{
+  packaged_task<void()> packagedTask(move(task));
+  future<void> future = packagedTask.get_future();
+
+  {
+    unique_lock<mutex> lock(lock_);
+    if (threads_.empty())
+      startThreads();
+    tasks_.emplace_back(move(packagedTask));
+  }
+
+  pending_.notify_one();
+  return future;
+}
+
+void ThreadPool::workerLoop(size_t threadIdx)
+{
+  pinToNumaNode(threadIdx);
+
+  for (;;)
+  {
+    packaged_task<void()> task;
+
+    {
+      unique_lock<mutex> lock(lock_);
+      pending_.wait(lock, [this] {
+        return stop_ || !tasks_.empty();
+      });
+
+      if (tasks_.empty())
+        return;
+
+      task = move(tasks_.front());
+      tasks_.pop_front();
+    }
+
+    task();
+  }
+}
+
+} // namespace
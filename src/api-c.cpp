@@ -12,6 +12,7 @@
 
 #include <primesieve.h>
 #include <primesieve.hpp>
+#include <primesieve/PrimeGenerator.hpp>
 #include <primesieve/PrimeSieve.hpp>
 #include <primesieve/ParallelSieve.hpp>
 #include <primesieve/malloc_vector.hpp>
@@ -21,6 +22,7 @@
 #include <cstddef>
 #include <cerrno>
 #include <exception>
+#include <limits>
 
 using namespace std;
 using namespace primesieve;
@@ -38,6 +40,76 @@ void* store_primes(uint64_t start, uint64_t stop, size_t* size)
     if (size)
       *size = primes.size();
 
+    // hand the caller an exactly sized array, the reserve
+    // in store_primes() is an upper bound approximation
+    primes.shrink_to_fit();
+    primes.disable_free();
+    return primes.data();
+  }
+  catch (exception&)
+  {
+    errno = EDOM;
+    if (size)
+      *size = 0;
+  }
+
+  return NULL;
+}
+
+template <typename T>
+size_t store_primes_buf(uint64_t start, uint64_t stop, void* buf, size_t capacity)
+{
+  try
+  {
+    T* primes = (T*) buf;
+    size_t i = 0;
+
+    if (start > 0)
+      start--;
+    if (~stop == 0)
+      stop--;
+
+    if (start < stop)
+    {
+      primesieve::iterator it(start, stop);
+      uint64_t prime = it.next_prime();
+      for (; prime <= stop && i < capacity; prime = it.next_prime())
+        primes[i++] = (T) prime;
+    }
+
+    return i;
+  }
+  catch (exception&)
+  {
+    errno = EDOM;
+  }
+
+  return ~((size_t) 0);
+}
+
+/// Store native 32-bit primes straight from the sieve,
+/// without the widening/narrowing round-trip through
+/// the iterator's uint64_t buffer
+///
+void* store_primes_uint32(uint64_t start, uint64_t stop, size_t* size)
+{
+  try
+  {
+    malloc_vector<uint32_t> primes;
+
+    if (start <= stop)
+    {
+      if (stop > numeric_limits<uint32_t>::max())
+        throw primesieve_error("start and stop must be <= 2^32 - 1 for UINT32_PRIMES");
+
+      PrimeGenerator gen(start, stop);
+      gen.fill(primes);
+    }
+
+    if (size)
+      *size = primes.size();
+
+    primes.shrink_to_fit();
     primes.disable_free();
     return primes.data();
   }
@@ -58,6 +130,7 @@ void* store_n_primes(uint64_t n, uint64_t start)
   {
     malloc_vector<T> primes;
     store_n_primes(n, start, primes);
+    primes.shrink_to_fit();
     primes.disable_free();
     return primes.data();
   }
@@ -86,7 +159,7 @@ void* primesieve_generate_primes(uint64_t start, uint64_t stop, size_t* size, in
     case INT16_PRIMES:     return store_primes<int16_t>(start, stop, size);
     case UINT16_PRIMES:    return store_primes<uint16_t>(start, stop, size);
     case INT32_PRIMES:     return store_primes<int32_t>(start, stop, size);
-    case UINT32_PRIMES:    return store_primes<uint32_t>(start, stop, size);
+    case UINT32_PRIMES:    return store_primes_uint32(start, stop, size);
     case INT64_PRIMES:     return store_primes<int64_t>(start, stop, size);
     case UINT64_PRIMES:    return store_primes<uint64_t>(start, stop, size);
   }
@@ -96,6 +169,29 @@ void* primesieve_generate_primes(uint64_t start, uint64_t stop, size_t* size, in
   return NULL;
 }
 
+size_t primesieve_generate_primes_buf(uint64_t start, uint64_t stop, void* buf, size_t capacity, int type)
+{
+  switch (type)
+  {
+    case SHORT_PRIMES:     return store_primes_buf<short>(start, stop, buf, capacity);
+    case USHORT_PRIMES:    return store_primes_buf<unsigned short>(start, stop, buf, capacity);
+    case INT_PRIMES:       return store_primes_buf<int>(start, stop, buf, capacity);
+    case UINT_PRIMES:      return store_primes_buf<unsigned int>(start, stop, buf, capacity);
+    case LONG_PRIMES:      return store_primes_buf<long>(start, stop, buf, capacity);
+    case ULONG_PRIMES:     return store_primes_buf<unsigned long>(start, stop, buf, capacity);
+    case LONGLONG_PRIMES:  return store_primes_buf<long long>(start, stop, buf, capacity);
+    case ULONGLONG_PRIMES: return store_primes_buf<unsigned long long>(start, stop, buf, capacity);
+    case INT16_PRIMES:     return store_primes_buf<int16_t>(start, stop, buf, capacity);
+    case UINT16_PRIMES:    return store_primes_buf<uint16_t>(start, stop, buf, capacity);
+    case INT32_PRIMES:     return store_primes_buf<int32_t>(start, stop, buf, capacity);
+    case UINT32_PRIMES:    return store_primes_buf<uint32_t>(start, stop, buf, capacity);
+    case INT64_PRIMES:     return store_primes_buf<int64_t>(start, stop, buf, capacity);
+    case UINT64_PRIMES:    return store_primes_buf<uint64_t>(start, stop, buf, capacity);
+  }
+  errno = EDOM;
+  return ~((size_t) 0);
+}
+
 void* primesieve_generate_n_primes(uint64_t n, uint64_t start, int type)
 {
   switch (type)
@@ -140,6 +236,19 @@ uint64_t primesieve_nth_prime(int64_t n, uint64_t start)
   return PRIMESIEVE_ERROR;
 }
 
+namespace primesieve {
+
+/// Defined in api.cpp, enqueues the counting job on the
+/// internal thread pool and invokes the callback with the
+/// result on the worker thread
+///
+void count_primes_async_callback(uint64_t start,
+                                 uint64_t stop,
+                                 void (*callback)(uint64_t, void*),
+                                 void* data);
+
+} // namespace
+
 uint64_t primesieve_count_primes(uint64_t start, uint64_t stop)
 {
   try
@@ -157,6 +266,14 @@ uint64_t primesieve_count_primes(uint64_t start, uint64_t stop)
   return PRIMESIEVE_ERROR;
 }
 
+void primesieve_count_primes_async(uint64_t start,
+                                   uint64_t stop,
+                                   void (*callback)(uint64_t count, void* data),
+                                   void* data)
+{
+  count_primes_async_callback(start, stop, callback, data);
+}
+
 uint64_t primesieve_count_twins(uint64_t start, uint64_t stop)
 {
   try
@@ -336,16 +453,41 @@ int primesieve_get_num_threads()
   return get_num_threads();
 }
 
+int primesieve_get_async_threads()
+{
+  return get_async_threads();
+}
+
 void primesieve_set_sieve_size(int sieve_size)
 {
   set_sieve_size(sieve_size);
 }
 
+void primesieve_set_thread_sieve_size(int sieve_size)
+{
+  set_thread_sieve_size(sieve_size);
+}
+
 void primesieve_set_num_threads(int num_threads)
 {
   set_num_threads(num_threads);
 }
 
+void primesieve_set_thread_num_threads(int num_threads)
+{
+  set_thread_num_threads(num_threads);
+}
+
+void primesieve_set_async_threads(int async_threads)
+{
+  set_async_threads(async_threads);
+}
+
+void primesieve_tune()
+{
+  tune();
+}
+
 uint64_t primesieve_get_max_stop()
 {
   return get_max_stop();
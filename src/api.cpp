@@ -11,21 +11,160 @@
 ///
 
 #include <primesieve.hpp>
+#include <primesieve/BucketArena.hpp>
+#include <primesieve/PiTable.hpp>
+#include <primesieve/PreSieve.hpp>
+#include <primesieve/config.hpp>
 #include <primesieve/CpuInfo.hpp>
+#include <primesieve/MilestoneCache.hpp>
 #include <primesieve/pmath.hpp>
+#include <primesieve/PrimeGenerator.hpp>
 #include <primesieve/PrimeSieve.hpp>
 #include <primesieve/ParallelSieve.hpp>
+#include <primesieve/ThreadPool.hpp>
 
 #include <stdint.h>
+#include <algorithm>
+
+#if defined(__linux__)
+  #include <sched.h>
+#endif
+#include <cerrno>
 #include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
 #include <limits>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace {
 
-int sieve_size = 0;
+/// Process-global tunables gathered into one immutable
+/// snapshot (RCU-style). Readers grab the current snapshot
+/// with a single atomic shared_ptr load, writers copy the
+/// snapshot, modify the copy and publish it wholesale.
+/// The getters on the sieve init paths thereby read only
+/// immutable memory that is never adjacent to a writer's
+/// cache line, and knobs added to this struct later stay
+/// off the hot path by construction.
+///
+struct Settings
+{
+  int sieveSize = 0;
+  int numThreads = 0;
+  int asyncThreads = 0;
+  double factorEratSmall = 0.0;
+  double factorEratMedium = 0.0;
+};
+
+std::shared_ptr<const Settings> settings = std::make_shared<Settings>();
+
+/// Writers are rare (setup time), they are serialized
+/// by a lock and never block the readers
+std::mutex settings_lock;
+
+std::shared_ptr<const Settings> getSettings()
+{
+  return std::atomic_load_explicit(&settings, std::memory_order_acquire);
+}
+
+template <typename F>
+void updateSettings(F update)
+{
+  std::unique_lock<std::mutex> lock(settings_lock);
+  auto newSettings = std::make_shared<Settings>(*getSettings());
+  update(*newSettings);
+  std::atomic_store_explicit(&settings,
+      std::shared_ptr<const Settings>(std::move(newSettings)),
+      std::memory_order_release);
+}
+
+/// Per-thread overrides of the process-global settings
+/// above, 0 = no override. Threads with mixed workloads in
+/// one process (e.g. a latency-sensitive service thread and
+/// a background bulk job) can thereby use different tunings
+/// without clobbering each other's settings.
+thread_local int thread_sieve_size = 0;
+
+thread_local int thread_num_threads = 0;
+
+/// Queue of pending asynchronous jobs. At most
+/// get_async_threads() jobs run concurrently on the thread
+/// pool, each job sieves on a single pool thread.
+///
+int async_running = 0;
+std::mutex async_lock;
+std::deque<std::packaged_task<uint64_t()>> async_jobs;
+
+/// Executed on a thread pool worker, runs queued
+/// jobs until the queue is empty
+///
+void asyncWorker()
+{
+  for (;;)
+  {
+    std::packaged_task<uint64_t()> job;
+
+    {
+      std::unique_lock<std::mutex> lock(async_lock);
+
+      if (async_jobs.empty())
+      {
+        async_running--;
+        return;
+      }
+
+      job = std::move(async_jobs.front());
+      async_jobs.pop_front();
+    }
+
+    job();
+  }
+}
+
+std::future<uint64_t> submitAsyncJob(std::function<uint64_t()> func)
+{
+  std::packaged_task<uint64_t()> job(std::move(func));
+  std::future<uint64_t> future = job.get_future();
+  bool startWorker = false;
+
+  {
+    std::unique_lock<std::mutex> lock(async_lock);
+    async_jobs.emplace_back(std::move(job));
+
+    if (async_running < primesieve::get_async_threads())
+    {
+      async_running++;
+      startWorker = true;
+    }
+  }
+
+  if (startWorker)
+    primesieve::ThreadPool::getInstance().submit(asyncWorker);
+
+  return future;
+}
+
+/// Single-threaded version of count_primes(),
+/// executed on a thread pool worker
+///
+uint64_t countPrimes1Thread(uint64_t start, uint64_t stop)
+{
+  using namespace primesieve;
 
-int num_threads = 0;
+  if (stop < PiTable::limit())
+    return PiTable::getInstance().countPrimes(start, stop);
+
+  PrimeSieve ps;
+  ps.setSieveSize(get_sieve_size());
+  ps.sieve(start, stop, COUNT_PRIMES);
+  return ps.getCount(0);
+}
 
 }
 
@@ -41,11 +180,147 @@ uint64_t nth_prime(int64_t n, uint64_t start)
 
 uint64_t count_primes(uint64_t start, uint64_t stop)
 {
+  // tiny requests are answered from the
+  // primes < 2^16 lookup table
+  if (stop < PiTable::limit())
+    return PiTable::getInstance().countPrimes(start, stop);
+
+  // Optional persistent milestone cache for services that
+  // repeatedly count [0, X] with a slowly growing X: load
+  // the largest milestone x <= stop, sieve only the
+  // remainder [x + 1, stop] and persist (stop, pi(stop))
+  // as a milestone for the next call. Disabled unless the
+  // PRIMESIEVE_MILESTONES environment variable is set,
+  // see MilestoneCache.hpp.
+  bool useMilestones = (start == 0);
+  uint64_t milestoneCount = 0;
+
+  if (useMilestones)
+  {
+    uint64_t x;
+    if (MilestoneCache::getInstance().lookup(stop, x, milestoneCount))
+    {
+      if (x == stop)
+        return milestoneCount;
+      start = x + 1;
+    }
+  }
+
+  // Narrow but high ranges e.g. [1e18, 1e18 + 1e10]:
+  // ParallelSieve limits the thread count because each of
+  // its worker chunks regenerates the sieving primes up to
+  // sqrt(stop), which dominates for short chunks. In that
+  // case the range is split into small chunks counted by
+  // count_primes_batch() which generates the sieving primes
+  // only once and shares them read-only between the worker
+  // threads, so such ranges scale across all CPU cores.
+  uint64_t threads = (uint64_t) get_num_threads();
+  uint64_t dist = (start <= stop) ? stop - start : 0;
+  uint64_t threshold = isqrt(stop) / 5;
+  threshold = std::max(threshold, config::MIN_THREAD_DISTANCE);
+
+  if (threads > 1 &&
+      dist / threshold < threads &&
+      dist / config::MIN_THREAD_DISTANCE >= 2)
+  {
+    uint64_t chunks = threads * 4;
+    uint64_t chunkDist = std::max(dist / chunks, config::MIN_THREAD_DISTANCE);
+    chunkDist += 30 - chunkDist % 30;
+    std::vector<Range> ranges;
+    uint64_t low = start;
+
+    while (true)
+    {
+      uint64_t high = (stop - low < chunkDist)
+          ? stop : low + (chunkDist - 1);
+      ranges.push_back({ low, high });
+      if (high == stop)
+        break;
+      low = high + 1;
+    }
+
+    uint64_t count = milestoneCount;
+    for (uint64_t c : count_primes_batch(ranges.data(), ranges.size()))
+      count += c;
+
+    if (useMilestones)
+      MilestoneCache::getInstance().store(stop, count);
+
+    return count;
+  }
+
   ParallelSieve ps;
   ps.setSieveSize(get_sieve_size());
   ps.setNumThreads(get_num_threads());
   ps.sieve(start, stop, COUNT_PRIMES);
-  return ps.getCount(0);
+  uint64_t count = milestoneCount + ps.getCount(0);
+
+  if (useMilestones)
+    MilestoneCache::getInstance().store(stop, count);
+
+  return count;
+}
+
+std::vector<Range> split_range(uint64_t start, uint64_t stop, int chunks)
+{
+  std::vector<Range> ranges;
+
+  if (start > stop)
+    return ranges;
+
+  chunks = std::max(1, chunks);
+
+  // reuse ParallelSieve's chunking: the same chunk
+  // distance and (30 + 2) aligned boundaries its worker
+  // threads would use when sieving [start, stop]
+  ParallelSieve ps;
+  ps.setStart(start);
+  ps.setStop(stop);
+  uint64_t dist = ps.getThreadDistance(chunks);
+  uint64_t low = start;
+
+  while (true)
+  {
+    uint64_t high = checkedAdd(low, dist);
+    high = (high < stop) ? ps.align(high) : stop;
+    ranges.push_back({ low, high });
+    if (high >= stop)
+      return ranges;
+    low = high + 1;
+  }
+}
+
+std::future<uint64_t> count_primes_async(uint64_t start, uint64_t stop)
+{
+  return submitAsyncJob([start, stop] {
+    return countPrimes1Thread(start, stop);
+  });
+}
+
+/// Used by the C API, invokes the callback with the
+/// result on the worker thread, see api-c.cpp
+///
+void count_primes_async_callback(uint64_t start,
+                                 uint64_t stop,
+                                 void (*callback)(uint64_t, void*),
+                                 void* data)
+{
+  submitAsyncJob([start, stop, callback, data] {
+    uint64_t count;
+
+    try
+    {
+      count = countPrimes1Thread(start, stop);
+    }
+    catch (std::exception&)
+    {
+      errno = EDOM;
+      count = std::numeric_limits<uint64_t>::max();
+    }
+
+    callback(count, data);
+    return count;
+  });
 }
 
 uint64_t count_twins(uint64_t start, uint64_t stop)
@@ -93,6 +368,38 @@ uint64_t count_sextuplets(uint64_t start, uint64_t stop)
   return ps.getCount(5);
 }
 
+void generate_primes(uint64_t stop, std::vector<uint32_t>* primes)
+{
+  generate_primes(0, stop, primes);
+}
+
+void generate_primes(uint64_t start, uint64_t stop, std::vector<uint32_t>* primes)
+{
+  if (!primes || start > stop)
+    return;
+
+  if (stop > std::numeric_limits<uint32_t>::max())
+    throw primesieve_error("generate_primes: stop must be <= 2^32 - 1 for uint32_t primes");
+
+  PrimeGenerator gen(start, stop);
+  gen.fill(*primes);
+}
+
+void generate_twin_primes(uint64_t start, uint64_t stop, std::vector<uint64_t>& twins)
+{
+  PrimeGenerator gen(start, stop);
+  gen.fillTwins(twins);
+}
+
+void generate_ktuplets(uint64_t start, uint64_t stop, int k, std::vector<uint64_t>& tuplets)
+{
+  PrimeGenerator gen(start, stop);
+  gen.forEachTuplet(k, [&](uint64_t tuplet)
+  {
+    tuplets.push_back(tuplet);
+  });
+}
+
 void print_primes(uint64_t start, uint64_t stop)
 {
   PrimeSieve ps;
@@ -137,15 +444,48 @@ void print_sextuplets(uint64_t start, uint64_t stop)
 
 int get_num_threads()
 {
-  if (num_threads)
-    return num_threads;
+  if (thread_num_threads)
+    return thread_num_threads;
+
+  int numThreads = getSettings()->numThreads;
+  if (numThreads)
+    return numThreads;
   else
-    return ParallelSieve::getMaxThreads();
+    return ParallelSieve::getDefaultNumThreads();
 }
 
 void set_num_threads(int threads)
 {
-  num_threads = inBetween(1, threads, ParallelSieve::getMaxThreads());
+  updateSettings([&](Settings& s)
+  {
+    s.numThreads = inBetween(1, threads, ParallelSieve::getMaxThreads());
+  });
+}
+
+void set_thread_num_threads(int threads)
+{
+  // 0 removes the calling thread's override
+  if (threads == 0)
+    thread_num_threads = 0;
+  else
+    thread_num_threads = inBetween(1, threads, ParallelSieve::getMaxThreads());
+}
+
+int get_async_threads()
+{
+  int asyncThreads = getSettings()->asyncThreads;
+  if (asyncThreads)
+    return asyncThreads;
+  else
+    return get_num_threads();
+}
+
+void set_async_threads(int threads)
+{
+  updateSettings([&](Settings& s)
+  {
+    s.asyncThreads = inBetween(1, threads, ParallelSieve::getMaxThreads());
+  });
 }
 
 uint64_t get_max_stop()
@@ -153,6 +493,46 @@ uint64_t get_max_stop()
   return std::numeric_limits<uint64_t>::max();
 }
 
+void trim_memory()
+{
+  BucketArena::getInstance().trim();
+  PreSieve::trim();
+}
+
+double get_factor_eratsmall()
+{
+  double factor = getSettings()->factorEratSmall;
+  if (factor)
+    return factor;
+  else
+    return config::FACTOR_ERATSMALL;
+}
+
+double get_factor_eratmedium()
+{
+  double factor = getSettings()->factorEratMedium;
+  if (factor)
+    return factor;
+  else
+    return config::FACTOR_ERATMEDIUM;
+}
+
+void set_factor_eratsmall(double factor)
+{
+  updateSettings([&](Settings& s)
+  {
+    s.factorEratSmall = inBetween(0.1, factor, 3.0);
+  });
+}
+
+void set_factor_eratmedium(double factor)
+{
+  updateSettings([&](Settings& s)
+  {
+    s.factorEratMedium = inBetween(0.1, factor, 5.0);
+  });
+}
+
 std::string primesieve_version()
 {
   return PRIMESIEVE_VERSION;
@@ -160,19 +540,54 @@ std::string primesieve_version()
 
 void set_sieve_size(int kilobytes)
 {
-  sieve_size = inBetween(8, kilobytes, 4096);
-  sieve_size = floorPow2(sieve_size);
+  updateSettings([&](Settings& s)
+  {
+    s.sieveSize = inBetween(8, kilobytes, 4096);
+    s.sieveSize = floorPow2(s.sieveSize);
+  });
+}
+
+void set_thread_sieve_size(int kilobytes)
+{
+  // 0 removes the calling thread's override
+  if (kilobytes == 0)
+    thread_sieve_size = 0;
+  else
+  {
+    thread_sieve_size = inBetween(8, kilobytes, 4096);
+    thread_sieve_size = floorPow2(thread_sieve_size);
+  }
 }
 
 int get_sieve_size()
 {
+  // per-thread override
+  if (thread_sieve_size)
+    return thread_sieve_size;
+
   // user specified sieve size
-  if (sieve_size)
-    return sieve_size;
+  int sieveSize = getSettings()->sieveSize;
+  if (sieveSize)
+    return sieveSize;
 
   size_t l1CacheSize = cpuInfo.l1CacheSize();
   size_t l2CacheSize = cpuInfo.l2CacheSize();
 
+#if defined(__linux__)
+  // hybrid CPUs (e.g. P/E cores, big.LITTLE) have
+  // asymmetric per-core caches, use the cache sizes of
+  // the core the calling thread currently runs on
+  if (cpuInfo.hasAsymmetricCaches())
+  {
+    int cpu = sched_getcpu();
+    if (cpu >= 0)
+    {
+      l1CacheSize = cpuInfo.l1CacheSize((size_t) cpu);
+      l2CacheSize = cpuInfo.l2CacheSize((size_t) cpu);
+    }
+  }
+#endif
+
   // convert to kilobytes
   l1CacheSize /= 1024;
   l2CacheSize /= 1024;
@@ -0,0 +1,213 @@
+///
+/// @file   checkpoint.cpp
+/// @brief  Checkpoint/resume support for long sieving runs.
+///         The range is sieved in chunks of roughly 1 minute
+///         each, after every chunk the accumulated counts and
+///         the lowest not yet sieved number are persisted to
+///         the checkpoint file. Since sieving is deterministic
+///         per range, a killed run restarted with --resume=FILE
+///         continues from the last completed chunk.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve/ParallelSieve.hpp>
+#include <primesieve/pmath.hpp>
+#include <primesieve/primesieve_error.hpp>
+#include <primesieve/replaceFile.hpp>
+#include "cmdoptions.hpp"
+
+#include <stdint.h>
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+using namespace std;
+using namespace primesieve;
+
+namespace {
+
+struct Checkpoint
+{
+  uint64_t start = 0;
+  uint64_t stop = 0;
+  /// Lowest not yet sieved number
+  uint64_t low = 0;
+  int flags = 0;
+  array<uint64_t, 6> counts{{ 0, 0, 0, 0, 0, 0 }};
+  double seconds = 0;
+};
+
+const string magic = "primesieve-checkpoint";
+
+Checkpoint readCheckpoint(const string& path)
+{
+  ifstream file(path);
+  Checkpoint cp;
+  string str;
+
+  if (!(file >> str) || str != magic)
+    throw primesieve_error("invalid checkpoint file: " + path);
+
+  file >> cp.start >> cp.stop >> cp.low >> cp.flags;
+  for (auto& count : cp.counts)
+    file >> count;
+  file >> cp.seconds;
+
+  if (!file)
+    throw primesieve_error("invalid checkpoint file: " + path);
+
+  return cp;
+}
+
+/// Write the checkpoint to a temporary file first, then
+/// rename it over the old checkpoint. A crash can hence
+/// never leave a truncated checkpoint behind.
+///
+void writeCheckpoint(const string& path, const Checkpoint& cp)
+{
+  string tmp = path + ".tmp";
+  {
+    ofstream file(tmp, ofstream::trunc);
+    file << magic << '\n';
+    file << cp.start << ' ' << cp.stop << ' ' << cp.low << ' ' << cp.flags << '\n';
+    for (auto count : cp.counts)
+      file << count << ' ';
+    file << '\n' << fixed << setprecision(3) << cp.seconds << '\n';
+
+    if (!file)
+      throw primesieve_error("failed to write " + tmp);
+  }
+
+  if (!replaceFile(tmp, path))
+    throw primesieve_error("failed to update " + path);
+}
+
+/// Align n to modulo (30 + 2) to prevent prime k-tuplet
+/// (twin primes, prime triplets) gaps at chunk borders,
+/// same as ParallelSieve::align()
+///
+uint64_t align(uint64_t n, uint64_t stop)
+{
+  uint64_t n32 = checkedAdd(n, 32);
+
+  if (n32 >= stop)
+    return stop;
+
+  return n32 - n % 30;
+}
+
+void printResults(ParallelSieve& ps, Checkpoint& cp, CmdOptions& opt)
+{
+  cout << left;
+
+  const string text[6] =
+  {
+    "Primes: ",
+    "Twin primes: ",
+    "Prime triplets: ",
+    "Prime quadruplets: ",
+    "Prime quintuplets: ",
+    "Prime sextuplets: "
+  };
+
+  for (int i = 0; i < 6; i++)
+    if (ps.isCount(i))
+      cout << text[i] << cp.counts[i] << endl;
+
+  if (opt.time)
+    cout << "Seconds: " << fixed << setprecision(3) << cp.seconds << endl;
+}
+
+} // namespace
+
+/// Count primes and prime k-tuplets, persisting the
+/// progress to opt.checkpointFile after each chunk
+///
+void checkpointSieve(CmdOptions& opt)
+{
+  Checkpoint cp;
+  string file = !opt.checkpointFile.empty() ? opt.checkpointFile : opt.resumeFile;
+
+  if (!opt.resumeFile.empty())
+    cp = readCheckpoint(opt.resumeFile);
+  else
+  {
+    auto& numbers = opt.numbers;
+    if (numbers.size() < 2)
+      numbers.push_front(0);
+
+    cp.start = numbers[0];
+    cp.stop = numbers[1];
+    cp.low = cp.start;
+    cp.flags = opt.flags ? opt.flags : COUNT_PRIMES;
+  }
+
+  ParallelSieve ps;
+  ps.setFlags(cp.flags);
+
+  if (ps.isPrint())
+    throw primesieve_error("--checkpoint only supports counting, not printing");
+  if (opt.sieveSize)
+    ps.setSieveSize(opt.sieveSize);
+  if (opt.threads)
+    ps.setNumThreads(opt.threads);
+
+  if (!opt.quiet)
+  {
+    cout << "Sieve size = " << ps.getSieveSize() << " kilobytes" << endl;
+    cout << "Threads = " << ps.idealNumThreads() << endl;
+    if (!opt.resumeFile.empty())
+      cout << "Resuming at " << cp.low << endl;
+  }
+
+  // initial chunk size, adapted below so that one
+  // chunk takes about 1 minute to sieve
+  uint64_t chunk = (uint64_t) 1e10;
+  double targetSeconds = 60;
+
+  while (cp.low <= cp.stop)
+  {
+    uint64_t high = checkedAdd(cp.low, chunk);
+    high = min(high, cp.stop);
+    if (high < cp.stop)
+      high = align(high, cp.stop);
+
+    ps.sieve(cp.low, high, cp.flags);
+
+    for (int i = 0; i < 6; i++)
+      cp.counts[i] += ps.getCount(i);
+    cp.seconds += ps.getSeconds();
+    cp.low = checkedAdd(high, 1);
+    writeCheckpoint(file, cp);
+
+    if (opt.status)
+    {
+      double dist = (double) (cp.stop - cp.start) + 1;
+      double percent = ((double) (high - cp.start) + 1) * 100.0 / dist;
+      cout << '\r' << (int) min(percent, 100.0) << '%' << flush;
+    }
+
+    if (high >= cp.stop)
+      break;
+
+    // grow or shrink the next chunk towards the
+    // target duration, at most 10x per step
+    double seconds = max(ps.getSeconds(), 0.01);
+    double factor = min(targetSeconds / seconds, 10.0);
+    chunk = (uint64_t) max(chunk * factor, 1e8);
+    chunk += 30 - chunk % 30;
+  }
+
+  if (opt.status)
+    cout << endl;
+
+  printResults(ps, cp, opt);
+}
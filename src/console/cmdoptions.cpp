@@ -46,15 +46,25 @@ struct Option
 
 enum OptionID
 {
+  OPTION_BINARY,
+  OPTION_CHECKPOINT,
   OPTION_COUNT,
+  OPTION_CPUS,
+  OPTION_GAPS,
   OPTION_HELP,
+  OPTION_HISTOGRAM,
+  OPTION_MERGE,
   OPTION_NTHPRIME,
   OPTION_NO_STATUS,
   OPTION_NUMBER,
   OPTION_DISTANCE,
+  OPTION_OUT,
   OPTION_PRINT,
   OPTION_QUIET,
+  OPTION_RESUME,
+  OPTION_SHARD,
   OPTION_SIZE,
+  OPTION_STATS,
   OPTION_THREADS,
   OPTION_TIME,
   OPTION_VERSION
@@ -63,22 +73,33 @@ enum OptionID
 /// Command-line options
 map<string, OptionID> optionMap =
 {
+  { "--binary",    OPTION_BINARY },
+  { "--checkpoint", OPTION_CHECKPOINT },
   { "-c",          OPTION_COUNT },
   { "--count",     OPTION_COUNT },
+  { "--cpus",      OPTION_CPUS },
+  { "-g",          OPTION_GAPS },
+  { "--gaps",      OPTION_GAPS },
   { "-h",          OPTION_HELP },
   { "--help",      OPTION_HELP },
+  { "--histogram", OPTION_HISTOGRAM },
+  { "--merge",     OPTION_MERGE },
   { "-n",          OPTION_NTHPRIME },
   { "--nthprime",  OPTION_NTHPRIME },
   { "--no-status", OPTION_NO_STATUS },
   { "--number",    OPTION_NUMBER },
+  { "--out",       OPTION_OUT },
   { "-d",          OPTION_DISTANCE },
   { "--dist",      OPTION_DISTANCE },
   { "-p",          OPTION_PRINT },
   { "--print",     OPTION_PRINT },
   { "-q",          OPTION_QUIET },
   { "--quiet",     OPTION_QUIET },
+  { "--resume",    OPTION_RESUME },
+  { "--shard",     OPTION_SHARD },
   { "-s",          OPTION_SIZE },
   { "--size",      OPTION_SIZE },
+  { "--stats",     OPTION_STATS },
   { "-t",          OPTION_THREADS },
   { "--threads",   OPTION_THREADS },
   { "--time",      OPTION_TIME },
@@ -107,6 +128,34 @@ void optionPrint(Option& opt,
   }
 }
 
+void optionBinary(Option& opt,
+                  CmdOptions& opts)
+{
+  opts.quiet = true;
+
+  // by default print raw 64-bit primes
+  if (opt.val.empty())
+    opt.val = "1";
+
+  switch (opt.getValue<int>())
+  {
+    case 1: opts.flags |= PRINT_PRIMES | PRINT_BINARY; break;
+    case 2: opts.flags |= PRINT_PRIMES | PRINT_VARINT; break;
+    default: throw primesieve_error("invalid option " + opt.str);
+  }
+}
+
+void optionGaps(Option& opt,
+                CmdOptions& opts)
+{
+  opts.gaps = true;
+
+  // without a threshold only the
+  // maximal gap is searched
+  if (!opt.val.empty())
+    opts.minGap = opt.getValue<uint64_t>();
+}
+
 void optionCount(Option& opt,
                  CmdOptions& opts)
 {
@@ -131,6 +180,78 @@ void optionCount(Option& opt,
   }
 }
 
+/// e.g. "--histogram=1e9"
+void optionHistogram(Option& opt,
+                     CmdOptions& opts)
+{
+  opts.histogramWidth = opt.getValue<uint64_t>();
+
+  if (opts.histogramWidth == 0)
+    throw primesieve_error("invalid option " + opt.str + ", usage: --histogram=1e9");
+
+  // the histogram lines go to stdout
+  opts.quiet = true;
+}
+
+/// e.g. "--cpus=0-15,32-47"
+void optionCpus(Option& opt,
+                CmdOptions& opts)
+{
+  string usage = "invalid option " + opt.str + ", usage: --cpus=0-3,8-11";
+  string& val = opt.val;
+
+  for (size_t pos = 0; pos < val.size(); )
+  {
+    size_t comma = val.find(',', pos);
+    if (comma == string::npos)
+      comma = val.size();
+
+    string range = val.substr(pos, comma - pos);
+    size_t dash = range.find('-');
+    int first, last;
+
+    if (dash == string::npos)
+      first = last = calculator::eval<int>(range);
+    else
+    {
+      first = calculator::eval<int>(range.substr(0, dash));
+      last = calculator::eval<int>(range.substr(dash + 1));
+    }
+
+    if (first < 0 || last < first)
+      throw primesieve_error(usage);
+
+    for (int cpu = first; cpu <= last; cpu++)
+      opts.cpus.push_back(cpu);
+
+    pos = comma + 1;
+  }
+
+  if (opts.cpus.empty())
+    throw primesieve_error(usage);
+}
+
+/// e.g. "--shard=3/8"
+void optionShard(Option& opt,
+                 CmdOptions& opts)
+{
+  size_t pos = opt.val.find('/');
+
+  if (pos == string::npos)
+    throw primesieve_error("invalid option " + opt.str + ", usage: --shard=i/N");
+
+  opts.shardIndex = calculator::eval<int>(opt.val.substr(0, pos));
+  opts.shardCount = calculator::eval<int>(opt.val.substr(pos + 1));
+
+  if (opts.shardCount < 1 ||
+      opts.shardIndex < 0 ||
+      opts.shardIndex >= opts.shardCount)
+    throw primesieve_error("--shard: i must be within [0, N[");
+
+  // the shard output must stay parsable by --merge
+  opts.quiet = true;
+}
+
 /// e.g. "--thread=4" -> return "--thread"
 string getOption(const string& str)
 {
@@ -162,6 +283,20 @@ Option makeOption(const string& str)
   Option opt;
 
   opt.str = str;
+
+  // options with a string value,
+  // e.g. "--out=primes.bin"
+  for (const string& strOpt : { "--out", "--checkpoint", "--resume" })
+  {
+    string prefix = strOpt + "=";
+    if (str.compare(0, prefix.size(), prefix) == 0)
+    {
+      opt.opt = strOpt;
+      opt.val = str.substr(prefix.size());
+      return opt;
+    }
+  }
+
   opt.opt = getOption(str);
   opt.val = getValue(str);
 
@@ -186,13 +321,23 @@ CmdOptions parseOptions(int argc, char* argv[])
 
     switch (optionMap[opt.opt])
     {
+      case OPTION_BINARY:    optionBinary(opt, opts); break;
+      case OPTION_CHECKPOINT: opts.checkpointFile = opt.val; break;
       case OPTION_COUNT:     optionCount(opt, opts); break;
+      case OPTION_CPUS:      optionCpus(opt, opts); break;
+      case OPTION_GAPS:      optionGaps(opt, opts); break;
+      case OPTION_HISTOGRAM: optionHistogram(opt, opts); break;
+      case OPTION_MERGE:     opts.merge = true; break;
+      case OPTION_SHARD:     optionShard(opt, opts); break;
       case OPTION_PRINT:     optionPrint(opt, opts); break;
       case OPTION_SIZE:      opts.sieveSize = opt.getValue<int>(); break;
+      case OPTION_STATS:     opts.stats = true; break;
       case OPTION_THREADS:   opts.threads = opt.getValue<int>(); break;
       case OPTION_QUIET:     opts.quiet = true; break;
       case OPTION_NTHPRIME:  opts.nthPrime = true; break;
       case OPTION_NO_STATUS: opts.status = false; break;
+      case OPTION_OUT:       opts.outFile = opt.val; opts.quiet = true; break;
+      case OPTION_RESUME:    opts.resumeFile = opt.val; break;
       case OPTION_TIME:      opts.time = true; break;
       case OPTION_NUMBER:    opts.numbers.push_back(opt.getValue<uint64_t>()); break;
       case OPTION_DISTANCE:  opts.numbers.push_back(opt.getValue<uint64_t>() + opts.numbers[0]); break;
@@ -201,7 +346,11 @@ CmdOptions parseOptions(int argc, char* argv[])
     }
   }
 
-  if (opts.numbers.empty())
+  // --resume restores START and STOP from the checkpoint
+  // file, --merge reads the shard outputs from stdin
+  if (opts.numbers.empty() &&
+      opts.resumeFile.empty() &&
+      !opts.merge)
     throw primesieve_error("missing STOP number");
 
   if (opts.quiet)
@@ -12,25 +12,47 @@
 
 #include <stdint.h>
 #include <deque>
+#include <string>
+#include <vector>
 
 struct CmdOptions
 {
   std::deque<uint64_t> numbers;
+  /// CPU cores the sieving threads are pinned to
+  std::vector<int> cpus;
+  std::string outFile;
+  std::string checkpointFile;
+  std::string resumeFile;
+  uint64_t minGap;
+  /// --histogram interval width, 0 = disabled
+  uint64_t histogramWidth;
   int flags;
+  int shardIndex;
+  int shardCount;
   int sieveSize;
   int threads;
   bool quiet;
   bool nthPrime;
+  bool gaps;
+  bool merge;
   bool status;
+  bool stats;
   bool time;
 
   CmdOptions() :
+    minGap(0),
+    histogramWidth(0),
     flags(0),
+    shardIndex(0),
+    shardCount(0),
     sieveSize(0),
     threads(0),
     quiet(false),
     nthPrime(false),
+    gaps(false),
+    merge(false),
     status(true),
+    stats(false),
     time(false)
   { }
 };
@@ -0,0 +1,119 @@
+///
+/// @file   fileout.cpp
+/// @brief  Write primes as raw little-endian uint64 directly into
+///         a memory mapped output file (--out=FILE). The file is
+///         sized using prime_count_approx() and truncated to the
+///         exact size once all primes have been written, the
+///         primes hence go straight from the sieve decode buffer
+///         into the page cache without any intermediate stdio or
+///         pipe copies.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve/PrimeGenerator.hpp>
+#include <primesieve/StorePrimes.hpp>
+#include <primesieve/primesieve_error.hpp>
+
+#include <stdint.h>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#if !defined(_WIN32)
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <unistd.h>
+  #define HAS_MMAP
+#endif
+
+using namespace std;
+using namespace primesieve;
+
+#if defined(HAS_MMAP)
+
+void writeBinaryFile(uint64_t start,
+                     uint64_t stop,
+                     const string& path)
+{
+  // prime_count_approx() >= pi(stop) - pi(start),
+  // the file is shrunk to the exact size at the end
+  uint64_t maxPrimes = prime_count_approx(start, stop);
+  uint64_t maxBytes = maxPrimes * sizeof(uint64_t);
+
+  int fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+
+  if (fd < 0)
+    throw primesieve_error("failed to create " + path);
+
+  if (maxBytes == 0)
+  {
+    close(fd);
+    return;
+  }
+
+  if (ftruncate(fd, maxBytes) < 0)
+  {
+    close(fd);
+    throw primesieve_error("failed to resize " + path);
+  }
+
+  void* addr = mmap(nullptr, maxBytes, PROT_WRITE, MAP_SHARED, fd, 0);
+
+  if (addr == MAP_FAILED)
+  {
+    close(fd);
+    throw primesieve_error("failed to mmap " + path);
+  }
+
+  uint64_t* out = (uint64_t*) addr;
+  uint64_t count = 0;
+
+  PrimeGenerator primeGenerator(start, stop);
+  primeGenerator.forEachBatch(
+    [&](const uint64_t* primes, size_t size)
+    {
+      memcpy(&out[count], primes, size * sizeof(uint64_t));
+      count += size;
+    });
+
+  munmap(addr, maxBytes);
+
+  // shrink the file to the exact size
+  uint64_t bytes = count * sizeof(uint64_t);
+  if (ftruncate(fd, bytes) < 0)
+  {
+    close(fd);
+    throw primesieve_error("failed to resize " + path);
+  }
+
+  close(fd);
+}
+
+#else
+
+/// Portable fallback using buffered stdio
+void writeBinaryFile(uint64_t start,
+                     uint64_t stop,
+                     const string& path)
+{
+  FILE* file = fopen(path.c_str(), "wb");
+
+  if (!file)
+    throw primesieve_error("failed to create " + path);
+
+  PrimeGenerator primeGenerator(start, stop);
+  primeGenerator.forEachBatch(
+    [&](const uint64_t* primes, size_t size)
+    {
+      fwrite(primes, sizeof(uint64_t), size, file);
+    });
+
+  fclose(file);
+}
+
+#endif
@@ -27,16 +27,42 @@ const string helpMenu
   "\n"
   "Options:\n"
   "\n"
+  "          --binary[=N]    Print primes in binary format to stdout,\n"
+  "                          N = 1 raw little-endian uint64 (default),\n"
+  "                          N = 2 delta encoded varints with a sync\n"
+  "                          point (0x00 + absolute prime) every 2^16\n"
+  "                          primes for seekability\n"
+  "          --checkpoint=FILE  Persist the sieving progress to FILE\n"
+  "                          after each chunk (~1 minute), see --resume\n"
   "  -c[N+], --count[=N+]    Count primes and prime k-tuplets, N <= 6,\n"
   "                          e.g. -c1 primes, -c2 twins, -c3 triplets, ...\n"
   "  -d<N>,  --dist=<N>      Sieve the interval [START, START + N]\n"
+  "          --cpus=<L>      Pin the sieving threads to the CPU cores in\n"
+  "                          list L, e.g. --cpus=0-3,8-11. Without -t the\n"
+  "                          thread count equals the number of cores\n"
+  "  -g[N],  --gaps[=N]      Find the maximal prime gap, or print all\n"
+  "                          gaps of size >= N between consecutive primes\n"
   "  -h,     --help          Print this help menu\n"
+  "          --histogram=<N> Count primes per interval of width N in one\n"
+  "                          sieving pass, prints one line per interval:\n"
+  "                          \"intervalStart primeCount\" (single-threaded)\n"
   "  -n,     --nthprime      Calculate the nth prime,\n"
   "                          e.g. 1 100 -n finds the 1st prime > 100\n"
   "          --no-status     Turn off the progressing status\n"
+  "          --stats         Print performance statistics as JSON,\n"
+  "                          requires building with -DENABLE_STATS\n"
+  "          --out=FILE      Write the primes as raw little-endian uint64\n"
+  "                          to FILE (memory mapped, no stdout copies)\n"
   "  -p[N],  --print[=N]     Print primes or prime k-tuplets, N <= 6,\n"
   "                          e.g. -p1 primes, -p2 twins, -p3 triplets, ...\n"
   "  -q,     --quiet         Quiet mode, prints less output\n"
+  "          --merge         Combine shard outputs read from stdin\n"
+  "                          into exact totals, see --shard\n"
+  "          --resume=FILE   Resume a sieving run from a checkpoint file,\n"
+  "                          continues from the last completed chunk\n"
+  "          --shard=<I/N>   Sieve the I-th of N equal subranges\n"
+  "                          (0 <= I < N) and print mergeable counts,\n"
+  "                          for distributing a range across machines\n"
   "  -s<N>,  --size=<N>      Set the sieve size in kilobytes, N <= 4096\n"
   "  -t<N>,  --threads=<N>   Set the number of threads, N <= CPU cores\n"
   "          --time          Print the time elapsed in seconds\n"
@@ -8,10 +8,13 @@
 /// file in the top level directory.
 ///
 
+#include <primesieve.hpp>
 #include <primesieve/ParallelSieve.hpp>
+#include <primesieve/Stats.hpp>
 #include "cmdoptions.hpp"
 
 #include <stdint.h>
+#include <chrono>
 #include <iostream>
 #include <exception>
 #include <iomanip>
@@ -20,6 +23,11 @@
 using namespace std;
 using namespace primesieve;
 
+void writeBinaryFile(uint64_t start, uint64_t stop, const string& path);
+void checkpointSieve(CmdOptions& opt);
+void shardSieve(CmdOptions& opt);
+void mergeShards(CmdOptions& opt);
+
 namespace {
 
 void printResults(ParallelSieve& ps, CmdOptions& opt)
@@ -40,6 +48,15 @@ void printResults(ParallelSieve& ps, CmdOptions& opt)
     if (ps.isCount(i))
       cout << text[i] << ps.getCount(i) << endl;
 
+  // per-thread wall times reveal load imbalance,
+  // e.g. threads pinned to a busy or remote core
+  auto& threadSeconds = ps.getThreadSeconds();
+
+  if (opt.status && !threadSeconds.empty())
+    for (size_t t = 0; t < threadSeconds.size(); t++)
+      cout << "Thread " << t << ": " << fixed << setprecision(3)
+           << threadSeconds[t] << " sec" << endl;
+
   if (opt.time)
     cout << "Seconds: " << fixed << setprecision(3) << ps.getSeconds() << endl;
 }
@@ -47,6 +64,13 @@ void printResults(ParallelSieve& ps, CmdOptions& opt)
 /// Count & print primes and prime k-tuplets
 void sieve(CmdOptions& opt)
 {
+  if (!opt.checkpointFile.empty() ||
+      !opt.resumeFile.empty())
+  {
+    checkpointSieve(opt);
+    return;
+  }
+
   ParallelSieve ps;
   auto& numbers = opt.numbers;
 
@@ -56,11 +80,33 @@ void sieve(CmdOptions& opt)
     ps.setSieveSize(opt.sieveSize);
   if (opt.threads)
     ps.setNumThreads(opt.threads);
+  if (!opt.cpus.empty())
+  {
+    // pin the sieving threads to the listed cores,
+    // without -t the thread count defaults to the
+    // number of listed cores
+    ps.setCpuAffinity(opt.cpus);
+    if (!opt.threads)
+      ps.setNumThreads((int) opt.cpus.size());
+  }
+  if (opt.histogramWidth)
+  {
+    // the histogram is accumulated in
+    // a single sequential pass
+    ps.setHistogramWidth(opt.histogramWidth);
+    ps.setNumThreads(1);
+  }
   if (ps.isPrint())
     ps.setNumThreads(1);
   if (numbers.size() < 2)
     numbers.push_front(0);
 
+  if (!opt.outFile.empty())
+  {
+    writeBinaryFile(numbers[0], numbers[1], opt.outFile);
+    return;
+  }
+
   ps.setStart(numbers[0]);
   ps.setStop(numbers[1]);
 
@@ -75,6 +121,56 @@ void sieve(CmdOptions& opt)
 
   ps.sieve();
   printResults(ps, opt);
+
+  if (opt.stats)
+  {
+    if (stats::enabled)
+      cout << stats::getJson() << endl;
+    else
+      cerr << "primesieve: --stats requires building with -DENABLE_STATS" << endl;
+  }
+}
+
+/// Find prime gaps by scanning the sieve bits,
+/// see find_prime_gaps() in primesieve.hpp
+///
+void primeGaps(CmdOptions& opt)
+{
+  auto& numbers = opt.numbers;
+
+  if (numbers.size() < 2)
+    numbers.push_front(0);
+
+  auto t1 = chrono::system_clock::now();
+
+  if (opt.minGap > 0)
+  {
+    auto gaps = find_prime_gaps(numbers[0], numbers[1], opt.minGap);
+
+    for (auto& gap : gaps)
+      cout << gap.prevPrime << " "
+           << gap.nextPrime << " "
+           << (gap.nextPrime - gap.prevPrime) << "\n";
+
+    cout << "Gaps >= " << opt.minGap << ": " << gaps.size() << endl;
+  }
+  else
+  {
+    PrimeGap maxGap = max_prime_gap(numbers[0], numbers[1]);
+
+    if (maxGap.nextPrime == 0)
+      cout << "Maximal gap: none, the interval contains < 2 primes" << endl;
+    else
+      cout << "Maximal gap: " << (maxGap.nextPrime - maxGap.prevPrime)
+           << " between " << maxGap.prevPrime
+           << " and " << maxGap.nextPrime << endl;
+  }
+
+  auto t2 = chrono::system_clock::now();
+  chrono::duration<double> seconds = t2 - t1;
+
+  if (opt.time)
+    cout << "Seconds: " << fixed << setprecision(3) << seconds.count() << endl;
 }
 
 void nthPrime(CmdOptions& opt)
@@ -118,8 +214,14 @@ int main(int argc, char* argv[])
   {
     CmdOptions opt = parseOptions(argc, argv);
 
-    if (opt.nthPrime)
+    if (opt.merge)
+      mergeShards(opt);
+    else if (opt.shardCount > 0)
+      shardSieve(opt);
+    else if (opt.nthPrime)
       nthPrime(opt);
+    else if (opt.gaps)
+      primeGaps(opt);
     else
       sieve(opt);
   }
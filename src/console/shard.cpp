@@ -0,0 +1,203 @@
+///
+/// @file   shard.cpp
+/// @brief  Distributed sharding: --shard=i/N sieves the i-th of N
+///         subranges of [START, STOP] and prints the counts in a
+///         mergeable format, --merge reads shard outputs from
+///         stdin and combines them into exact totals. Each shard
+///         counts only the primes and prime k-tuplets whose first
+///         member lies within its subrange but sieves a few
+///         numbers past it (the same boundary convention as the
+///         ParallelSieve thread chunks), hence merging is a plain
+///         sum and no boundary fixups are needed.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include "cmdoptions.hpp"
+
+#include <primesieve/ParallelSieve.hpp>
+#include <primesieve/pmath.hpp>
+#include <primesieve/primesieve_error.hpp>
+
+#include <stdint.h>
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace primesieve;
+
+/// Sieve the i-th of N equal subranges and print
+/// the counts in a mergeable format
+///
+void shardSieve(CmdOptions& opt)
+{
+  auto& numbers = opt.numbers;
+
+  if (numbers.size() < 2)
+    numbers.push_front(0);
+
+  uint64_t start = numbers[0];
+  uint64_t stop = numbers[1];
+  uint64_t i = opt.shardIndex;
+  uint64_t n = opt.shardCount;
+
+  if (start > stop)
+    throw primesieve_error("--shard: START must be <= STOP");
+
+  // Equal subranges with the ParallelSieve chunk boundary
+  // convention: shard 0 covers [start, start + dist],
+  // shard i > 0 covers ]start + i * dist, start + (i+1) * dist],
+  // the last shard ends at stop.
+  uint64_t dist = (stop - start) / n;
+  uint64_t low = checkedAdd(start, i * dist);
+  uint64_t high = (i + 1 == n) ? stop : checkedAdd(low, dist);
+
+  ParallelSieve ps;
+
+  if (opt.flags)
+    ps.setFlags(opt.flags);
+  if (opt.sieveSize)
+    ps.setSieveSize(opt.sieveSize);
+  if (opt.threads)
+    ps.setNumThreads(opt.threads);
+
+  uint64_t sieveStart = low;
+  if (i > 0)
+    sieveStart = checkedAdd(sieveStart, 1);
+
+  // sieve a few numbers past the shard boundary so that
+  // k-tuplets spanning two shards are counted by the
+  // shard containing their first prime
+  uint64_t sieveStop = high;
+  if (i + 1 < n)
+    sieveStop = min(checkedAdd(high, 16), stop);
+
+  ps.setCountStop(high);
+  ps.sieve(sieveStart, sieveStop);
+
+  cout << "# primesieve shard, merge with: primesieve --merge < shards.txt" << "\n";
+  cout << "shard: " << i << "/" << n << "\n";
+  cout << "range: " << start << " " << stop << "\n";
+  cout << "counts:";
+  for (int j = 0; j < 6; j++)
+    cout << " " << ps.getCount(j);
+  cout << endl;
+
+  if (opt.time)
+    cout << "# seconds: " << ps.getSeconds() << endl;
+}
+
+/// Read shard outputs from stdin and combine
+/// them into exact totals
+///
+void mergeShards(CmdOptions&)
+{
+  const string text[6] =
+  {
+    "Primes: ",
+    "Twin primes: ",
+    "Prime triplets: ",
+    "Prime quadruplets: ",
+    "Prime quintuplets: ",
+    "Prime sextuplets: "
+  };
+
+  uint64_t counts[6] = { 0, 0, 0, 0, 0, 0 };
+  uint64_t shards = 0;
+  uint64_t start = 0;
+  uint64_t stop = 0;
+  bool haveShard = false;
+  bool haveRange = false;
+  vector<bool> seen;
+  string line;
+
+  while (getline(cin, line))
+  {
+    istringstream iss(line);
+    string key;
+    iss >> key;
+
+    if (key == "shard:")
+    {
+      uint64_t i, n;
+      char slash;
+
+      if (!(iss >> i >> slash >> n) || slash != '/' || i >= n)
+        throw primesieve_error("--merge: malformed line: " + line);
+      if (shards == 0)
+      {
+        shards = n;
+        seen.resize(n, false);
+      }
+      if (n != shards)
+        throw primesieve_error("--merge: mixed shard counts");
+      if (seen[i])
+        throw primesieve_error("--merge: duplicate shard " + to_string(i));
+
+      seen[i] = true;
+      haveShard = true;
+    }
+    else if (key == "range:")
+    {
+      uint64_t a, b;
+
+      if (!(iss >> a >> b))
+        throw primesieve_error("--merge: malformed line: " + line);
+      if (!haveRange)
+      {
+        start = a;
+        stop = b;
+        haveRange = true;
+      }
+      if (a != start || b != stop)
+        throw primesieve_error("--merge: shards cover different ranges");
+    }
+    else if (key == "counts:")
+    {
+      if (!haveShard)
+        throw primesieve_error("--merge: counts without a shard line");
+
+      for (int j = 0; j < 6; j++)
+      {
+        uint64_t count;
+        if (!(iss >> count))
+          throw primesieve_error("--merge: malformed line: " + line);
+        counts[j] += count;
+      }
+
+      haveShard = false;
+    }
+  }
+
+  if (shards == 0)
+    throw primesieve_error("--merge: no shard output on stdin");
+
+  uint64_t missing = 0;
+  for (uint64_t i = 0; i < shards; i++)
+    if (!seen[i])
+      missing++;
+
+  if (missing > 0)
+    throw primesieve_error("--merge: " + to_string(missing) +
+                           " of " + to_string(shards) + " shards missing");
+
+  cout << "Merged " << shards << " shards, range ["
+       << start << ", " << stop << "]" << endl;
+
+  bool printed = false;
+  for (int j = 0; j < 6; j++)
+    if (counts[j] > 0)
+    {
+      cout << text[j] << counts[j] << endl;
+      printed = true;
+    }
+
+  if (!printed)
+    cout << text[0] << counts[0] << endl;
+}
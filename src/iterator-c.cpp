@@ -14,7 +14,9 @@
 #include <primesieve/types.hpp>
 
 #include <stdint.h>
+#include <algorithm>
 #include <cerrno>
+#include <cstring>
 #include <exception>
 #include <vector>
 
@@ -35,8 +37,15 @@ void clearPrimeGenerator(primesieve_iterator* it)
   it->primeGenerator = nullptr;
 }
 
+/// The vector is only needed (and only allocated) for
+/// backward iteration, primesieve_next_prime() refills
+/// the fixed buffer inside primesieve_iterator instead
+///
 vector<uint64_t>& getPrimes(primesieve_iterator* it)
 {
+  if (!it->vector)
+    it->vector = new vector<uint64_t>;
+
   using T = vector<uint64_t>;
   T* primes = (T*) it->vector;
   return *primes;
@@ -53,7 +62,9 @@ void primesieve_init(primesieve_iterator* it)
   it->i = 0;
   it->last_idx = 0;
   it->dist = PrimeGenerator::maxCachedPrime();
-  it->vector = new vector<uint64_t>;
+  it->min_cache_bytes = 0;
+  it->max_cache_bytes = 0;
+  it->vector = nullptr;
   it->primeGenerator = nullptr;
   it->is_error = false;
 }
@@ -68,42 +79,58 @@ void primesieve_skipto(primesieve_iterator* it,
   it->i = 0;
   it->last_idx = 0;
   it->dist = PrimeGenerator::maxCachedPrime();
-  auto& primes = getPrimes(it);
-  primes.clear();
+  if (it->vector)
+    getPrimes(it).clear();
   clearPrimeGenerator(it);
 }
 
+/// Set the iterator's cache size policy,
+/// 0 keeps the compile time default
+///
+void primesieve_set_cache_size(primesieve_iterator* it,
+                               uint64_t min_bytes,
+                               uint64_t max_bytes)
+{
+  it->min_cache_bytes = min_bytes;
+  it->max_cache_bytes = max_bytes;
+
+  if (it->max_cache_bytes != 0)
+    it->max_cache_bytes = max(it->min_cache_bytes, it->max_cache_bytes);
+}
+
 /// C destructor
 void primesieve_free_iterator(primesieve_iterator* it)
 {
   if (it)
   {
     clearPrimeGenerator(it);
-    auto* primes = &getPrimes(it);
-    delete primes;
+    if (it->vector)
+      delete &getPrimes(it);
+    it->vector = nullptr;
   }
 }
 
 void primesieve_generate_next_primes(primesieve_iterator* it)
 {
-  auto& primes = getPrimes(it);
   auto primeGenerator = getPrimeGenerator(it);
 
+  // the sieve fills the iterator's fixed buffer
+  // directly, no vector round-trip
+  it->primes = it->buffer;
+
   try
   {
     while (true)
     {
       if (!it->primeGenerator)
       {
-        IteratorHelper::next(&it->start, &it->stop, it->stop_hint, &it->dist);
+        IteratorHelper::next(&it->start, &it->stop, it->stop_hint, &it->dist, 0, it->max_cache_bytes);
         it->primeGenerator = new PrimeGenerator(it->start, it->stop);
         primeGenerator = getPrimeGenerator(it);
-        primes.resize(64);
-        it->primes = &primes[0];
       }
 
       for (it->last_idx = 0; !it->last_idx;)
-        primeGenerator->fill(primes, &it->last_idx);
+        primeGenerator->fill(it->buffer, &it->last_idx);
 
       if (primeGenerator->finished())
         clearPrimeGenerator(it);
@@ -114,8 +141,7 @@ void primesieve_generate_next_primes(primesieve_iterator* it)
   catch (exception&)
   {
     clearPrimeGenerator(it);
-    primes.resize(1);
-    primes[0] = PRIMESIEVE_ERROR;
+    it->buffer[0] = PRIMESIEVE_ERROR;
     it->last_idx = 1;
     it->is_error = true;
     errno = EDOM;
@@ -125,6 +151,35 @@ void primesieve_generate_next_primes(primesieve_iterator* it)
   it->last_idx--;
 }
 
+size_t primesieve_next_primes(primesieve_iterator* it,
+                              uint64_t* primes,
+                              size_t size)
+{
+  size_t count = 0;
+
+  while (count < size)
+  {
+    if (it->i == it->last_idx)
+      primesieve_generate_next_primes(it);
+    else
+      it->i++;
+
+    // copy the unconsumed primes of the current block
+    size_t copy = min(it->last_idx - it->i + 1, size - count);
+    memcpy(&primes[count], &it->primes[it->i], copy * sizeof(uint64_t));
+    it->i += copy - 1;
+    count += copy;
+
+    // UINT64_MAX marks the end of the primes < 2^64,
+    // it is also returned if an error occurred
+    // (PRIMESIEVE_ERROR, it->is_error is set)
+    if (primes[count - 1] == PRIMESIEVE_ERROR)
+      return count - 1;
+  }
+
+  return count;
+}
+
 void primesieve_generate_prev_primes(primesieve_iterator* it)
 {
   auto& primes = getPrimes(it);
@@ -132,14 +187,14 @@ void primesieve_generate_prev_primes(primesieve_iterator* it)
   try
   {
     if (it->primeGenerator)
-      it->start = primes.front();
+      it->start = it->primes[0];
 
     primes.clear();
     clearPrimeGenerator(it);
 
     while (primes.empty())
     {
-      IteratorHelper::prev(&it->start, &it->stop, it->stop_hint, &it->dist);
+      IteratorHelper::prev(&it->start, &it->stop, it->stop_hint, &it->dist, it->min_cache_bytes, it->max_cache_bytes);
       it->primeGenerator = new PrimeGenerator(it->start, it->stop);
       auto primeGenerator = getPrimeGenerator(it);
       if (it->start <= 2)
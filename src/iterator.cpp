@@ -10,8 +10,15 @@
 #include <primesieve/iterator.hpp>
 #include <primesieve/IteratorHelper.hpp>
 #include <primesieve/PrimeGenerator.hpp>
+#include <primesieve/types.hpp>
 
 #include <stdint.h>
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <future>
+#include <utility>
 #include <vector>
 #include <memory>
 
@@ -23,22 +30,179 @@ void clear(std::unique_ptr<T>& ptr)
   ptr.reset(nullptr);
 }
 
+/// Numbers corresponding to the bits of a sieve byte
+const uint64_t bitValues[8] = { 7, 11, 13, 17, 19, 23, 29, 31 };
+
+/// Index of the highest set bit
+uint64_t highestBit(uint64_t bits)
+{
+#if defined(__GNUC__) || \
+    defined(__clang__)
+  return 63 - (uint64_t) __builtin_clzll(bits);
+#else
+  uint64_t bit = 0;
+  while (bits >>= 1)
+    bit++;
+  return bit;
+#endif
+}
+
 } // namespace
 
 namespace primesieve {
 
+/// Background producer used in prefetch mode. While the
+/// caller iterates over the current block of primes a
+/// worker thread sieves the next block, swapNext() then
+/// merely swaps the two buffers.
+///
+class AsyncPrefetcher
+{
+public:
+  ~AsyncPrefetcher()
+  {
+    wait();
+  }
+
+  /// Start sieving the block following stop
+  void restart(uint64_t stop,
+               uint64_t stopHint,
+               uint64_t dist,
+               uint64_t maxCacheBytes)
+  {
+    wait();
+    start_ = stop;
+    stop_ = stop;
+    stopHint_ = stopHint;
+    dist_ = dist;
+    maxCacheBytes_ = maxCacheBytes;
+    launch();
+  }
+
+  /// Swap the prefetched block into primes and
+  /// start sieving the next block
+  ///
+  void swapNext(std::vector<uint64_t>& primes)
+  {
+    wait();
+    primes.swap(primes_);
+    // the worker thread updates stop_,
+    // take a copy before relaunching it
+    blockStop_ = stop_;
+    launch();
+  }
+
+  /// Stop number of the last swapped block
+  uint64_t getBlockStop() const { return blockStop_; }
+
+private:
+  void launch()
+  {
+    future_ = std::async(std::launch::async,
+                         [this] { produce(); });
+  }
+
+  void wait()
+  {
+    if (future_.valid())
+      future_.wait();
+  }
+
+  void produce()
+  {
+    primes_.clear();
+
+    while (primes_.empty() &&
+           stop_ < get_max_stop())
+    {
+      IteratorHelper::next(&start_, &stop_, stopHint_, &dist_, totalPrimes_, maxCacheBytes_);
+      PrimeGenerator primeGenerator(start_, stop_);
+      primeGenerator.fill(primes_);
+    }
+
+    totalPrimes_ += primes_.size();
+
+    // no more primes < 2^64
+    if (primes_.empty())
+      primes_.push_back(~0ull);
+  }
+
+  std::vector<uint64_t> primes_;
+  std::future<void> future_;
+  uint64_t start_ = 0;
+  uint64_t stop_ = 0;
+  uint64_t stopHint_ = 0;
+  uint64_t dist_ = 0;
+  uint64_t blockStop_ = 0;
+  uint64_t totalPrimes_ = 0;
+  uint64_t maxCacheBytes_ = 0;
+};
+
 iterator::~iterator()
 { }
 
 iterator::iterator(uint64_t start,
-                   uint64_t stop_hint)
+                   uint64_t stop_hint,
+                   bool prefetch,
+                   bool compact)
 {
+  prefetch_ = prefetch;
+  compact_ = compact;
   skipto(start, stop_hint);
 }
 
+/// Set this iterator's cache size policy, 0 keeps
+/// the config.hpp default
+///
+void iterator::set_cache_size(uint64_t min_bytes,
+                              uint64_t max_bytes)
+{
+  minCacheBytes_ = min_bytes;
+  maxCacheBytes_ = max_bytes;
+
+  if (maxCacheBytes_ != 0)
+    maxCacheBytes_ = std::max(minCacheBytes_, maxCacheBytes_);
+}
+
 void iterator::skipto(uint64_t start,
                       uint64_t stop_hint)
 {
+  // keep the current fully sieved window, a later
+  // skipto() into it then merely repositions
+  // instead of rebuilding the sieve
+  if (haveWindow_)
+  {
+    haveWindow_ = false;
+
+    // keep whichever window covers the new start
+    if (cacheStop_ == 0 ||
+        start + 1 < cacheStart_ ||
+        start > cacheStop_ + 1)
+    {
+      cachePrimes_.swap(primes_);
+      cacheStart_ = start_;
+      cacheStop_ = stop_;
+      cacheNextPrime_ = 0;
+    }
+  }
+
+  // same for the gap-encoded block (compact mode),
+  // decode_next_primes() then repositions into it
+  // using the sampled index
+  if (compact_ &&
+      !gaps_.empty() &&
+      (cacheGapLast_ == 0 ||
+       start + 1 < cacheGapStart_ ||
+       start >= cacheGapLast_))
+  {
+    cacheGaps_.swap(gaps_);
+    cacheGapSamples_.swap(gapSamples_);
+    cacheGapStart_ = gapStart_;
+    cacheGapStop_ = stop_;
+    cacheGapBase_ = gapBase_;
+    cacheGapLast_ = gapLast_;
+  }
+
   start_ = start;
   stop_ = start;
   stop_hint_ = stop_hint;
@@ -47,22 +211,299 @@ void iterator::skipto(uint64_t start,
   dist_ = PrimeGenerator::maxCachedPrime();
   clear(primeGenerator_);
   primes_.clear();
+  gaps_.clear();
+  gapSamples_.clear();
+  gapIdx_ = 0;
+  prevBitmap_.clear();
+  prevWordIdx_ = 0;
+  consumedPrimes_ = 0;
+
+  clear(prefetcher_);
+  if (prefetch_ &&
+      !compact_)
+  {
+    prefetcher_.reset(new AsyncPrefetcher());
+    prefetcher_->restart(stop_, stop_hint_, dist_, maxCacheBytes_);
+  }
+}
+
+/// Sieve the next block of primes and store it as 16-bit
+/// gaps between consecutive primes (4x less memory than
+/// absolute 64-bit values). The first prime of the block
+/// is kept as the base value, its gap entry is 0.
+///
+void iterator::generate_next_gaps()
+{
+  // the previous gap-encoded block has been fully consumed
+  consumedPrimes_ += gaps_.size();
+  gaps_.clear();
+  gapSamples_.clear();
+  gapIdx_ = 0;
+  uint64_t prev = 0;
+  bool firstRange = true;
+
+  while (gaps_.empty() &&
+         stop_ < get_max_stop())
+  {
+    IteratorHelper::next(&start_, &stop_, stop_hint_, &dist_, consumedPrimes_, maxCacheBytes_);
+    if (firstRange)
+    {
+      gapStart_ = start_;
+      firstRange = false;
+    }
+    PrimeGenerator primeGenerator(start_, stop_);
+
+    primeGenerator.forEachBatch(
+      [&](const uint64_t* primes, std::size_t size)
+      {
+        std::size_t i = 0;
+
+        if (gaps_.empty() && size > 0)
+        {
+          gapBase_ = primes[0];
+          prev = primes[0];
+          gaps_.push_back(0);
+          gapSamples_.push_back(prev);
+          i = 1;
+        }
+
+        for (; i < size; i++)
+        {
+          // the gaps between consecutive primes
+          // < 2^64 fit into 16 bits
+          assert(primes[i] - prev < (1 << 16));
+          gaps_.push_back((uint16_t) (primes[i] - prev));
+          prev = primes[i];
+
+          // sample the absolute prime value every 1024
+          // gap entries so that skipto() can later
+          // reposition into this block via binary search
+          if ((gaps_.size() & 1023) == 1)
+            gapSamples_.push_back(prev);
+        }
+      });
+  }
+
+  gapLast_ = prev;
+}
+
+/// Decode the next window of primes from the gap-encoded
+/// block using an unrolled prefix sum. The window vector
+/// is reused for the whole iteration, no allocation
+/// happens per decode.
+///
+void iterator::decode_next_primes()
+{
+  bool repositioned = false;
+  uint64_t skipValue = 0;
+
+  if (gapIdx_ >= gaps_.size())
+  {
+    // skipto() into the cached gap-encoded block:
+    // binary search the sampled index and decode only
+    // the residual window instead of re-sieving
+    if (gaps_.empty() &&
+        cacheGapLast_ != 0 &&
+        start_ + 1 >= cacheGapStart_ &&
+        start_ < cacheGapLast_)
+    {
+      skipValue = start_;
+      repositioned = true;
+      gaps_.swap(cacheGaps_);
+      gapSamples_.swap(cacheGapSamples_);
+      gapStart_ = cacheGapStart_;
+      gapBase_ = cacheGapBase_;
+      gapLast_ = cacheGapLast_;
+      start_ = cacheGapStart_;
+      stop_ = cacheGapStop_;
+      cacheGapLast_ = 0;
+
+      // index of the closest sample <= skipValue, its
+      // decode window contains the next prime
+      auto it = std::upper_bound(gapSamples_.begin(), gapSamples_.end(), skipValue);
+      std::size_t k = (it == gapSamples_.begin()) ? 0
+          : (std::size_t) (it - gapSamples_.begin()) - 1;
+      gapIdx_ = k * 1024;
+      runningValue_ = gapSamples_[k] - gaps_[gapIdx_];
+    }
+    else
+    {
+      generate_next_gaps();
+
+      // no more primes < 2^64
+      if (gaps_.empty())
+      {
+        primes_.resize(1);
+        primes_[0] = ~0ull;
+        i_ = 0;
+        last_idx_ = 0;
+        return;
+      }
+
+      runningValue_ = gapBase_;
+    }
+  }
+
+  std::size_t n = std::min(gaps_.size() - gapIdx_, (std::size_t) 1024);
+  primes_.resize(n);
+  const uint16_t* gaps = &gaps_[gapIdx_];
+  uint64_t value = runningValue_;
+  std::size_t i = 0;
+
+  for (; i + 4 <= n; i += 4)
+  {
+    primes_[i + 0] = value + gaps[i + 0];
+    primes_[i + 1] = value + gaps[i + 0] + gaps[i + 1];
+    primes_[i + 2] = value + gaps[i + 0] + gaps[i + 1] + gaps[i + 2];
+    primes_[i + 3] = value + gaps[i + 0] + gaps[i + 1] + gaps[i + 2] + gaps[i + 3];
+    value = primes_[i + 3];
+  }
+
+  for (; i < n; i++)
+  {
+    value += gaps[i];
+    primes_[i] = value;
+  }
+
+  runningValue_ = value;
+  gapIdx_ += n;
+  i_ = 0;
+  last_idx_ = n - 1;
+
+  if (repositioned)
+  {
+    std::size_t pos = (std::size_t)
+        (std::upper_bound(primes_.begin(), primes_.begin() + n, skipValue) - primes_.begin());
+
+    // the next prime is the 1st entry
+    // of the following decode window
+    if (pos > last_idx_)
+      decode_next_primes();
+    else
+      i_ = pos;
+  }
 }
 
 void iterator::generate_next_primes()
 {
+  if (compact_)
+  {
+    // direction flip inside a backward bitmap window:
+    // all decoded chunks have been served, continue
+    // sieving above the last served prime
+    if (prevWordIdx_ > 0 &&
+        !primes_.empty())
+    {
+      stop_ = primes_.back();
+      prevBitmap_.clear();
+      prevWordIdx_ = 0;
+    }
+
+    decode_next_primes();
+    return;
+  }
+
+  if (prefetcher_)
+  {
+    prefetcher_->swapNext(primes_);
+    start_ = primes_.front();
+    stop_ = prefetcher_->getBlockStop();
+    i_ = 0;
+    last_idx_ = primes_.size() - 1;
+    return;
+  }
+
+  // the previous block has been fully consumed
+  if (!primes_.empty())
+    consumedPrimes_ += last_idx_ + 1;
+
+  // fresh skipto() state
+  if (primes_.empty())
+  {
+    // skipto() inside the cached window,
+    // reposition instead of sieving
+    if (cacheStop_ != 0 &&
+        start_ + 1 >= cacheStart_ &&
+        start_ < cachePrimes_.back())
+    {
+      uint64_t s = start_;
+      primes_.swap(cachePrimes_);
+      start_ = cacheStart_;
+      stop_ = cacheStop_;
+      cacheStop_ = 0;
+      cacheNextPrime_ = 0;
+      haveWindow_ = true;
+      last_idx_ = primes_.size() - 1;
+      i_ = std::upper_bound(primes_.begin(), primes_.end(), s) - primes_.begin();
+      return;
+    }
+
+    // sieve the first window into a retainable
+    // vector so that later skipto() calls
+    // nearby can reposition into it
+    while (primes_.empty() &&
+           stop_ < get_max_stop())
+    {
+      IteratorHelper::next(&start_, &stop_, stop_hint_, &dist_, consumedPrimes_, maxCacheBytes_);
+      PrimeGenerator primeGenerator(start_, stop_);
+      primeGenerator.fill(primes_);
+    }
+
+    // no more primes < 2^64
+    if (primes_.empty())
+      primes_.push_back(~0ull);
+    else
+      haveWindow_ = true;
+
+    i_ = 0;
+    last_idx_ = primes_.size() - 1;
+    return;
+  }
+
+  bool cachedWindow = false;
+
+  if (haveWindow_)
+  {
+    haveWindow_ = false;
+
+    // the cache holds the adjacent window above,
+    // swap the two windows so that both iteration
+    // directions become pure index moves
+    if (cacheStop_ != 0 &&
+        stop_ != ~0ull &&
+        cacheStart_ == stop_ + 1)
+    {
+      primes_.swap(cachePrimes_);
+      std::swap(start_, cacheStart_);
+      std::swap(stop_, cacheStop_);
+      cacheNextPrime_ = 0;
+      haveWindow_ = true;
+      i_ = 0;
+      last_idx_ = primes_.size() - 1;
+      return;
+    }
+
+    // keep the current window for a possible
+    // direction flip later on
+    primes_.swap(cachePrimes_);
+    cacheStart_ = start_;
+    cacheStop_ = stop_;
+    cacheNextPrime_ = 0;
+    cachedWindow = true;
+  }
+
   while (true)
   {
     if (!primeGenerator_)
     {
-      IteratorHelper::next(&start_, &stop_, stop_hint_, &dist_);
+      IteratorHelper::next(&start_, &stop_, stop_hint_, &dist_, consumedPrimes_, maxCacheBytes_);
       auto p = new PrimeGenerator(start_, stop_);
       primeGenerator_.reset(p);
       primes_.resize(64);
     }
 
     for (last_idx_ = 0; !last_idx_;)
-      primeGenerator_->fill(primes_, &last_idx_);
+      primeGenerator_->fill(&primes_[0], &last_idx_);
 
     if (primeGenerator_->finished())
       clear(primeGenerator_);
@@ -72,18 +513,196 @@ void iterator::generate_next_primes()
 
   i_ = 0;
   last_idx_--;
+
+  // first prime above the cached window, used to
+  // detect a direction flip right at its top
+  if (cachedWindow)
+    cacheNextPrime_ = primes_[0];
+}
+
+/// Sieve the backward window [start_, stop_] once and
+/// keep its raw sieve bitmap, 8 bits per 30 numbers
+///
+void iterator::sieve_prev_bitmap()
+{
+  prevBitmap_.clear();
+
+  PrimeGenerator primeGenerator(start_, stop_);
+  primeGenerator.forEachSegment(
+    [&](const uint8_t* sieve, std::size_t bytes, uint64_t low)
+    {
+      if (prevBitmap_.empty())
+        prevLow_ = low;
+
+      // the sieve zero-fills the last segment
+      // up to an 8 byte boundary
+      std::size_t words = (bytes + 7) / 8;
+      std::size_t size = prevBitmap_.size();
+      prevBitmap_.resize(size + words);
+      std::memcpy(&prevBitmap_[size], sieve, words * 8);
+    });
+
+  prevWordIdx_ = prevBitmap_.size();
+}
+
+/// Decode the next (lower) chunk of primes from the
+/// backward window's sieve bitmap. The words are walked
+/// high-to-low and each word's bits are extracted highest
+/// bit first, the mirror image of Erat::nextPrime(), so
+/// primes_ is filled back to front without a reversal.
+///
+void iterator::decode_prev_chunk()
+{
+  primes_.clear();
+
+  while (primes_.empty() &&
+         prevWordIdx_ > 0)
+  {
+    // 128 words cover 30720 numbers
+    std::size_t lowIdx = (prevWordIdx_ > 128) ? prevWordIdx_ - 128 : 0;
+    uint64_t count = popcount(&prevBitmap_[lowIdx], prevWordIdx_ - lowIdx);
+
+    if (count > 0)
+    {
+      primes_.resize((std::size_t) count);
+      std::size_t idx = (std::size_t) count;
+
+      for (std::size_t w = prevWordIdx_; w-- > lowIdx;)
+      {
+        uint64_t bits = prevBitmap_[w];
+        uint64_t base = prevLow_ + w * 240;
+
+        while (bits)
+        {
+          uint64_t bit = highestBit(bits);
+          primes_[--idx] = base + (bit >> 3) * 30 + bitValues[bit & 7];
+          bits ^= 1ull << bit;
+        }
+      }
+    }
+
+    prevWordIdx_ = lowIdx;
+  }
+
+  if (!primes_.empty())
+  {
+    last_idx_ = primes_.size() - 1;
+    i_ = last_idx_;
+  }
 }
 
 void iterator::generate_prev_primes()
 {
-  if (primeGenerator_)
+  if (compact_)
+  {
+    // serve the next chunk straight from the
+    // backward window's sieve bitmap
+    if (prevWordIdx_ > 0)
+    {
+      decode_prev_chunk();
+      if (!primes_.empty())
+        return;
+    }
+
+    // the decode window covers only part of the
+    // gap-encoded block, rewind from the window's
+    // first prime and discard the stale gaps
+    if (!primes_.empty())
+      start_ = primes_.front();
+    gaps_.clear();
+    gapSamples_.clear();
+    gapIdx_ = 0;
+  }
+  else if (primeGenerator_ ||
+           (prefetcher_ && !primes_.empty()))
     start_ = primes_.front();
 
+  if (!compact_ &&
+      !prefetcher_ &&
+      cacheStop_ != 0)
+  {
+    // flipping below the current window, the cache
+    // holds the adjacent window below: swap them
+    if (haveWindow_ &&
+        start_ > 0 &&
+        cacheStop_ == start_ - 1)
+    {
+      primes_.swap(cachePrimes_);
+      std::swap(start_, cacheStart_);
+      std::swap(stop_, cacheStop_);
+      cacheNextPrime_ = 0;
+      last_idx_ = primes_.size() - 1;
+      i_ = last_idx_;
+      return;
+    }
+
+    // skipto() inside the cached window,
+    // reposition instead of sieving
+    if (primes_.empty() &&
+        start_ > 0 &&
+        start_ - 1 <= cacheStop_ &&
+        cachePrimes_.front() < start_)
+    {
+      uint64_t s = start_;
+      primes_.swap(cachePrimes_);
+      start_ = cacheStart_;
+      stop_ = cacheStop_;
+      cacheStop_ = 0;
+      cacheNextPrime_ = 0;
+      haveWindow_ = true;
+      last_idx_ = primes_.size() - 1;
+      i_ = (std::lower_bound(primes_.begin(), primes_.end(), s) - primes_.begin()) - 1;
+      return;
+    }
+
+    // flipping right below the window cached by
+    // generate_next_primes, swap it back in
+    if (primeGenerator_ &&
+        cacheNextPrime_ != 0 &&
+        start_ == cacheNextPrime_)
+    {
+      clear(primeGenerator_);
+      primes_.swap(cachePrimes_);
+      start_ = cacheStart_;
+      stop_ = cacheStop_;
+      cacheStop_ = 0;
+      cacheNextPrime_ = 0;
+      haveWindow_ = true;
+      last_idx_ = primes_.size() - 1;
+      i_ = last_idx_;
+      return;
+    }
+  }
+
+  // continuing downwards leaves the current window,
+  // keep it for a possible direction flip
+  if (haveWindow_)
+  {
+    primes_.swap(cachePrimes_);
+    cacheStart_ = start_;
+    cacheStop_ = stop_;
+    cacheNextPrime_ = 0;
+    haveWindow_ = false;
+  }
+
   primes_.clear();
 
   while (primes_.empty())
   {
-    IteratorHelper::prev(&start_, &stop_, stop_hint_, &dist_);
+    IteratorHelper::prev(&start_, &stop_, stop_hint_, &dist_, minCacheBytes_, maxCacheBytes_);
+
+    // compact mode: sieve the backward window once into
+    // a raw sieve bitmap and decode it high-to-low in
+    // chunks, 1 byte per 30 numbers instead of a 64-bit
+    // vector of all the window's primes
+    if (compact_ &&
+        start_ >= 7)
+    {
+      sieve_prev_bitmap();
+      decode_prev_chunk();
+      continue;
+    }
+
     if (start_ <= 2)
       primes_.push_back(0);
     auto p = new PrimeGenerator(start_, stop_);
@@ -94,6 +713,16 @@ void iterator::generate_prev_primes()
 
   last_idx_ = primes_.size() - 1;
   i_ = last_idx_;
+
+  if (!compact_ &&
+      !prefetcher_)
+    haveWindow_ = true;
+
+  // discard the prefetched block (it no longer
+  // follows primes_) and sieve the block after
+  // the current one instead
+  if (prefetcher_)
+    prefetcher_->restart(stop_, stop_hint_, dist_, maxCacheBytes_);
 }
 
 } // namespace
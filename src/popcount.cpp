@@ -1,7 +1,10 @@
 ///
 /// @file   popcount.cpp
-/// @brief  Fast algorithm to count the number of 1 bits in an
-///         array using only integer operations.
+/// @brief  Fast algorithms to count the number of 1 bits in an
+///         array. At startup the fastest implementation supported
+///         by the CPU is selected: AVX-512 VPOPCNTQ, AVX2
+///         Harley-Seal or the portable integer Harley-Seal
+///         algorithm.
 ///
 /// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
 ///
@@ -9,8 +12,14 @@
 /// file in the top level directory.
 ///
 
+#include <primesieve/cpuid.hpp>
+
 #include <stdint.h>
 
+#if defined(HAS_CPU_SUPPORTS)
+  #include <immintrin.h>
+#endif
+
 namespace {
 
 /// This uses fewer arithmetic operations than any other known
@@ -41,17 +50,13 @@ void CSA(uint64_t& h, uint64_t& l, uint64_t a, uint64_t b, uint64_t c)
   l = u ^ c;
 }
 
-} // namespace
-
-namespace primesieve {
-
 /// Harley-Seal popcount (4th iteration).
 /// The Harley-Seal popcount algorithm is one of the fastest algorithms
 /// for counting 1 bits in an array using only integer operations.
 /// This implementation uses only 5.69 instructions per 64-bit word.
 /// @see Chapter 5 in "Hacker's Delight" 2nd edition.
 ///
-uint64_t popcount(const uint64_t* array, uint64_t size)
+uint64_t popcountDefault(const uint64_t* array, uint64_t size)
 {
   uint64_t total = 0;
   uint64_t ones = 0, twos = 0, fours = 0, eights = 0, sixteens = 0;
@@ -92,4 +97,141 @@ uint64_t popcount(const uint64_t* array, uint64_t size)
   return total;
 }
 
+#if defined(HAS_CPU_SUPPORTS_VPOPCNT)
+
+/// Count the number of 1 bits in a 512-bit
+/// vector using AVX-512 VPOPCNTQ
+///
+__attribute__ ((target ("avx512f,avx512vpopcntdq")))
+uint64_t popcountAVX512(const uint64_t* array, uint64_t size)
+{
+  __m512i total = _mm512_setzero_si512();
+  uint64_t i = 0;
+
+  for (; i + 8 <= size; i += 8)
+    total = _mm512_add_epi64(total,
+        _mm512_popcnt_epi64(_mm512_loadu_si512((const void*) &array[i])));
+
+  uint64_t count = _mm512_reduce_add_epi64(total);
+
+  for (; i < size; i++)
+    count += popcount64(array[i]);
+
+  return count;
+}
+
+#endif
+
+#if defined(HAS_CPU_SUPPORTS)
+
+/// Count the number of 1 bits in a 256-bit vector
+/// using the positional popcount algorithm
+/// by Wojciech Mula
+///
+__attribute__ ((target ("avx2")))
+__m256i popcount256(__m256i v)
+{
+  __m256i lookup = _mm256_setr_epi8(
+      0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+      0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+
+  __m256i lowMask = _mm256_set1_epi8(0x0f);
+  __m256i lo = _mm256_and_si256(v, lowMask);
+  __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), lowMask);
+  __m256i cnt = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, lo),
+                                _mm256_shuffle_epi8(lookup, hi));
+
+  return _mm256_sad_epu8(cnt, _mm256_setzero_si256());
+}
+
+/// Carry-save adder (CSA) using 256-bit vectors
+__attribute__ ((target ("avx2")))
+void CSA256(__m256i& h, __m256i& l, __m256i a, __m256i b, __m256i c)
+{
+  __m256i u = _mm256_xor_si256(a, b);
+  h = _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(u, c));
+  l = _mm256_xor_si256(u, c);
+}
+
+/// AVX2 Harley-Seal popcount (4th iteration)
+/// which processes 512 bytes per loop iteration.
+///
+__attribute__ ((target ("avx2")))
+uint64_t popcountAVX2(const uint64_t* array, uint64_t size)
+{
+  __m256i total = _mm256_setzero_si256();
+  __m256i ones = _mm256_setzero_si256();
+  __m256i twos = _mm256_setzero_si256();
+  __m256i fours = _mm256_setzero_si256();
+  __m256i eights = _mm256_setzero_si256();
+  __m256i sixteens, twosA, twosB, foursA, foursB, eightsA, eightsB;
+
+  const __m256i* data = (const __m256i*) array;
+  uint64_t vecSize = size / 4;
+  uint64_t limit = vecSize - vecSize % 16;
+  uint64_t i = 0;
+
+  for (; i < limit; i += 16)
+  {
+    CSA256(twosA, ones, ones, _mm256_loadu_si256(&data[i+0]), _mm256_loadu_si256(&data[i+1]));
+    CSA256(twosB, ones, ones, _mm256_loadu_si256(&data[i+2]), _mm256_loadu_si256(&data[i+3]));
+    CSA256(foursA, twos, twos, twosA, twosB);
+    CSA256(twosA, ones, ones, _mm256_loadu_si256(&data[i+4]), _mm256_loadu_si256(&data[i+5]));
+    CSA256(twosB, ones, ones, _mm256_loadu_si256(&data[i+6]), _mm256_loadu_si256(&data[i+7]));
+    CSA256(foursB, twos, twos, twosA, twosB);
+    CSA256(eightsA, fours, fours, foursA, foursB);
+    CSA256(twosA, ones, ones, _mm256_loadu_si256(&data[i+8]), _mm256_loadu_si256(&data[i+9]));
+    CSA256(twosB, ones, ones, _mm256_loadu_si256(&data[i+10]), _mm256_loadu_si256(&data[i+11]));
+    CSA256(foursA, twos, twos, twosA, twosB);
+    CSA256(twosA, ones, ones, _mm256_loadu_si256(&data[i+12]), _mm256_loadu_si256(&data[i+13]));
+    CSA256(twosB, ones, ones, _mm256_loadu_si256(&data[i+14]), _mm256_loadu_si256(&data[i+15]));
+    CSA256(foursB, twos, twos, twosA, twosB);
+    CSA256(eightsB, fours, fours, foursA, foursB);
+    CSA256(sixteens, eights, eights, eightsA, eightsB);
+
+    total = _mm256_add_epi64(total, popcount256(sixteens));
+  }
+
+  total = _mm256_slli_epi64(total, 4);
+  total = _mm256_add_epi64(total, _mm256_slli_epi64(popcount256(eights), 3));
+  total = _mm256_add_epi64(total, _mm256_slli_epi64(popcount256(fours), 2));
+  total = _mm256_add_epi64(total, _mm256_slli_epi64(popcount256(twos), 1));
+  total = _mm256_add_epi64(total, popcount256(ones));
+
+  uint64_t count = 0;
+  count += (uint64_t) _mm256_extract_epi64(total, 0);
+  count += (uint64_t) _mm256_extract_epi64(total, 1);
+  count += (uint64_t) _mm256_extract_epi64(total, 2);
+  count += (uint64_t) _mm256_extract_epi64(total, 3);
+
+  for (i *= 4; i < size; i++)
+    count += popcount64(array[i]);
+
+  return count;
+}
+
+#endif
+
+} // namespace
+
+namespace primesieve {
+
+/// Count the number of 1 bits in the array using
+/// the fastest instruction set supported by the
+/// CPU. On non x86 CPUs the portable integer
+/// Harley-Seal algorithm is used.
+///
+uint64_t popcount(const uint64_t* array, uint64_t size)
+{
+#if defined(HAS_CPU_SUPPORTS_VPOPCNT)
+  if (hasAVX512VPOPCNT())
+    return popcountAVX512(array, size);
+#endif
+#if defined(HAS_CPU_SUPPORTS)
+  if (hasAVX2())
+    return popcountAVX2(array, size);
+#endif
+  return popcountDefault(array, size);
+}
+
 } // namespace
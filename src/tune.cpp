@@ -0,0 +1,109 @@
+///
+/// @file   tune.cpp
+/// @brief  Runtime calibration of the EratSmall/EratMedium/
+///         EratBig crossover points. The hardcoded factors in
+///         config.hpp are good averages but the ideal values
+///         differ by a few percent between CPU generations,
+///         tune() measures them on the running CPU by timing
+///         a few short sieving runs.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve.hpp>
+#include <primesieve/PrimeSieve.hpp>
+
+#include <stdint.h>
+#include <chrono>
+
+using namespace std;
+
+namespace {
+
+/// Time a single-threaded sieving run, the range starts
+/// at 10^12 so that the EratSmall, EratMedium and EratBig
+/// algorithms all get their share of the work
+///
+double timeSieve()
+{
+  uint64_t start = (uint64_t) 1e12;
+  uint64_t dist = (uint64_t) 1e8;
+
+  primesieve::PrimeSieve ps;
+  ps.setSieveSize(primesieve::get_sieve_size());
+
+  auto t1 = chrono::steady_clock::now();
+  ps.sieve(start, start + dist, primesieve::COUNT_PRIMES);
+  auto t2 = chrono::steady_clock::now();
+
+  return chrono::duration<double>(t2 - t1).count();
+}
+
+/// Return the best of 2 runs, this filters
+/// out scheduling noise
+///
+double benchFactor()
+{
+  double seconds = timeSieve();
+  return min(seconds, timeSieve());
+}
+
+} // namespace
+
+namespace primesieve {
+
+/// Calibrate the crossover factors for the running CPU.
+/// Each factor is swept independently over a small set of
+/// candidates (the hardcoded default is among them) and the
+/// fastest one wins. Tuning takes about 1 second and runs
+/// at most once per process.
+///
+void tune()
+{
+  static bool tuned = false;
+  if (tuned)
+    return;
+
+  // warm up the CPU and the sieving primes cache
+  timeSieve();
+
+  const double smallFactors[] = { 0.3, 0.4, 0.5, 0.6, 0.8 };
+  const double mediumFactors[] = { 1.5, 2.0, 2.5, 3.0, 4.0, 5.0 };
+
+  double bestTime = 0;
+  double bestFactor = 0;
+
+  for (double factor : smallFactors)
+  {
+    set_factor_eratsmall(factor);
+    double seconds = benchFactor();
+    if (!bestFactor || seconds < bestTime)
+    {
+      bestTime = seconds;
+      bestFactor = factor;
+    }
+  }
+  set_factor_eratsmall(bestFactor);
+
+  bestTime = 0;
+  bestFactor = 0;
+
+  for (double factor : mediumFactors)
+  {
+    set_factor_eratmedium(factor);
+    double seconds = benchFactor();
+    if (!bestFactor || seconds < bestTime)
+    {
+      bestTime = seconds;
+      bestFactor = factor;
+    }
+  }
+  set_factor_eratmedium(bestFactor);
+
+  tuned = true;
+}
+
+} // namespace
@@ -0,0 +1,93 @@
+///
+/// @file   cancel_sieve.cpp
+/// @brief  Test PrimeSieve::cancel() and ParallelSieve::cancel()
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve/PrimeSieve.hpp>
+#include <primesieve/ParallelSieve.hpp>
+#include <primesieve/primesieve_error.hpp>
+
+#include <stdint.h>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+
+using namespace std;
+using namespace primesieve;
+
+void check(bool OK)
+{
+  cout << "   " << (OK ? "OK" : "ERROR") << "\n";
+  if (!OK)
+    exit(1);
+}
+
+/// Cancel the sieve after 50 milliseconds,
+/// the sieve must stop within a few seconds
+///
+template <typename Sieve>
+void testCancel()
+{
+  Sieve ps;
+  bool canceled = false;
+
+  thread canceler([&ps] {
+    this_thread::sleep_for(chrono::milliseconds(50));
+    ps.cancel();
+  });
+
+  auto t1 = chrono::steady_clock::now();
+
+  try
+  {
+    // without cancellation this runs for hours
+    ps.sieve(0, (uint64_t) 1e18, COUNT_PRIMES);
+  }
+  catch (primesieve_error&)
+  {
+    canceled = true;
+  }
+
+  canceler.join();
+  auto t2 = chrono::steady_clock::now();
+  chrono::duration<double> seconds = t2 - t1;
+
+  cout << "sieve() canceled = " << canceled;
+  check(canceled);
+
+  cout << "seconds until canceled = " << seconds.count();
+  check(seconds.count() < 30);
+
+  // the sieve object remains usable
+  ps.sieve(0, 1000000, COUNT_PRIMES);
+  cout << "count after cancellation = " << ps.getCount(0);
+  check(ps.getCount(0) == 78498);
+}
+
+int main()
+{
+  cout << "PrimeSieve:" << endl;
+  testCancel<PrimeSieve>();
+
+  cout << "ParallelSieve:" << endl;
+  testCancel<ParallelSieve>();
+
+  // cancel() before sieve() has no effect,
+  // the flag is reset when sieving starts
+  PrimeSieve ps;
+  ps.cancel();
+  ps.sieve(0, 1000, COUNT_PRIMES);
+  cout << "count after early cancel() = " << ps.getCount(0);
+  check(ps.getCount(0) == 168);
+
+  cout << endl;
+  cout << "All tests passed successfully!" << endl;
+
+  return 0;
+}
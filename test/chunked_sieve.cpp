@@ -0,0 +1,105 @@
+///
+/// @file   chunked_sieve.cpp
+/// @brief  Test primesieve::ChunkedSieve, the pull-based
+///         parallel sieve driven by an external threading
+///         runtime.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve.hpp>
+#include <primesieve/ChunkedSieve.hpp>
+
+#include <stdint.h>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace primesieve;
+
+void check(bool OK)
+{
+  cout << "   " << (OK ? "OK" : "ERROR") << "\n";
+  if (!OK)
+    exit(1);
+}
+
+int main()
+{
+  uint64_t start = 0;
+  uint64_t stop = (uint64_t) 1e9;
+
+  // host threads drive the sieve, as an OpenMP or
+  // TBB runtime would
+  ChunkedSieve chunkedSieve(start, stop, COUNT_PRIMES | COUNT_TWINS, 4);
+
+  auto worker = [&]()
+  {
+    counts_t counts{};
+    SieveChunk chunk;
+
+    while (chunkedSieve.claimNextChunk(chunk))
+      chunkedSieve.sieveChunk(chunk, counts);
+
+    chunkedSieve.merge(counts);
+  };
+
+  vector<thread> threads;
+  for (int t = 0; t < 4; t++)
+    threads.emplace_back(worker);
+  for (auto& t : threads)
+    t.join();
+
+  cout << "ChunkedSieve prime count [0, 1e9]";
+  check(chunkedSieve.getCount(0) == count_primes(start, stop));
+  cout << "ChunkedSieve twin count [0, 1e9]";
+  check(chunkedSieve.getCount(1) == count_twins(start, stop));
+
+  // a single host thread drains all chunks
+  uint64_t start2 = (uint64_t) 1e12;
+  uint64_t stop2 = (uint64_t) 1e12 + 100000000;
+  ChunkedSieve single(start2, stop2);
+  counts_t counts{};
+  SieveChunk chunk;
+  uint64_t chunks = 0;
+
+  while (single.claimNextChunk(chunk))
+  {
+    single.sieveChunk(chunk, counts);
+    chunks++;
+  }
+
+  single.merge(counts);
+
+  cout << "ChunkedSieve single-threaded, " << chunks << " chunks";
+  check(single.getCount(0) == count_primes(start2, stop2));
+
+  // start > stop yields no chunks
+  ChunkedSieve empty(100, 10);
+  cout << "ChunkedSieve with start > stop yields no chunks";
+  check(!empty.claimNextChunk(chunk));
+
+  // printing flags are rejected
+  bool error = false;
+  try
+  {
+    ChunkedSieve invalid(0, 1000, PRINT_PRIMES);
+  }
+  catch (const primesieve_error&)
+  {
+    error = true;
+  }
+
+  cout << "ChunkedSieve rejects PRINT_* flags";
+  check(error);
+
+  cout << endl;
+  cout << "All tests passed successfully!" << endl;
+
+  return 0;
+}
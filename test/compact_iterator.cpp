@@ -0,0 +1,172 @@
+///
+/// @file   compact_iterator.cpp
+/// @brief  Test the iterator's compact (gap-encoded) mode.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve.hpp>
+
+#include <stdint.h>
+#include <iostream>
+#include <cstdlib>
+
+using namespace std;
+using namespace primesieve;
+
+void check(bool OK)
+{
+  cout << "   " << (OK ? "OK" : "ERROR") << "\n";
+  if (!OK)
+    exit(1);
+}
+
+int main()
+{
+  cout << left;
+
+  // compact mode must generate exactly the same
+  // primes as the default mode
+  {
+    primesieve::iterator it(0, get_max_stop(), false, true);
+    primesieve::iterator ref;
+    bool OK = true;
+    uint64_t prime = 0;
+
+    for (int i = 0; OK && i < 300000; i++)
+    {
+      prime = it.next_prime();
+      OK = (prime == ref.next_prime());
+    }
+
+    cout << "300000th prime (compact) = " << prime;
+    check(OK && prime == 4256233);
+  }
+
+  // skipto() and a start offset
+  {
+    primesieve::iterator it(1000000, get_max_stop(), false, true);
+    cout << "next_prime(10^6) = " << it.next_prime();
+    check(it.next_prime() == 1000033);
+
+    it.skipto(999999999);
+    uint64_t prime = it.next_prime();
+    cout << "next_prime(10^9 - 1) = " << prime;
+    check(prime == 1000000007);
+  }
+
+  // mix next_prime() and prev_prime()
+  {
+    primesieve::iterator it(10000, get_max_stop(), false, true);
+    primesieve::iterator ref(10000);
+    bool OK = true;
+
+    for (int i = 0; OK && i < 10000; i++)
+      OK = (it.next_prime() == ref.next_prime());
+    for (int i = 0; OK && i < 5000; i++)
+      OK = (it.prev_prime() == ref.prev_prime());
+    for (int i = 0; OK && i < 8000; i++)
+      OK = (it.next_prime() == ref.next_prime());
+
+    cout << "Mixed next_prime() / prev_prime()";
+    check(OK);
+  }
+
+  // large start, stop_hint limits sieving
+  {
+    primesieve::iterator it(1000000000000000ull, 1000000000001000ull, false, true);
+    uint64_t prime = it.next_prime();
+    cout << "next_prime(10^15) = " << prime;
+    check(prime == 1000000000000037ull);
+  }
+
+  // prev_prime() decodes the backward window's sieve
+  // bitmap high-to-low, compare against default mode
+  {
+    primesieve::iterator it(1000000000ull, get_max_stop(), false, true);
+    primesieve::iterator ref(1000000000ull);
+    bool OK = true;
+
+    for (int i = 0; OK && i < 100000; i++)
+      OK = (it.prev_prime() == ref.prev_prime());
+
+    cout << "prev_prime() from 10^9 (compact)";
+    check(OK);
+
+    // flip to next_prime() mid window
+    for (int i = 0; OK && i < 50000; i++)
+      OK = (it.next_prime() == ref.next_prime());
+
+    cout << "next_prime() after backward decode";
+    check(OK);
+  }
+
+  // prev_prime() down to 0 returns the 0 sentinel
+  {
+    primesieve::iterator it(1000, get_max_stop(), false, true);
+    uint64_t prime = it.prev_prime();
+    cout << "prev_prime(1000) = " << prime;
+    check(prime == 997);
+
+    while (prime > 2)
+      prime = it.prev_prime();
+
+    cout << "prev_prime(2) = " << it.prev_prime();
+    check(it.prev_prime() == 0);
+  }
+
+  // skipto() into the current gap-encoded block
+  // repositions via the sampled index instead of
+  // re-sieving, the primes must stay identical
+  {
+    primesieve::iterator it(0, get_max_stop(), false, true);
+
+    // generate a large block
+    for (int i = 0; i < 200000; i++)
+      it.next_prime();
+
+    bool OK = true;
+
+    for (uint64_t start : { 0ull, 17ull, 1000ull, 99991ull,
+                            1000000ull, 2750159ull, 2750160ull })
+    {
+      it.skipto(start);
+      primesieve::iterator ref(start);
+
+      for (int i = 0; OK && i < 2000; i++)
+        OK = (it.next_prime() == ref.next_prime());
+    }
+
+    cout << "skipto() inside the gap-encoded block";
+    check(OK);
+
+    // skipto() outside the block re-sieves
+    it.skipto(100000000);
+    cout << "next_prime(10^8) = " << it.next_prime();
+    check(it.prev_prime() == 99999989);
+  }
+
+  // the largest prime < 2^64 is 18446744073709551557,
+  // the next next_prime() call returns UINT64_MAX
+  {
+    uint64_t p1 = 18446744073709551556ull;
+    primesieve::iterator it(p1, get_max_stop(), false, true);
+    uint64_t prime = it.next_prime();
+    cout << "Largest prime < 2^64 = " << prime;
+    check(prime == 18446744073709551557ull);
+    cout << "next_prime(2^64) = UINT64_MAX";
+    check(it.next_prime() == ~0ull);
+
+    // rewind below the sentinel
+    cout << "prev_prime() after UINT64_MAX = " << 18446744073709551557ull;
+    check(it.prev_prime() == 18446744073709551557ull);
+  }
+
+  cout << endl;
+  cout << "All tests passed successfully!" << endl;
+
+  return 0;
+}
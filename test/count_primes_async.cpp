@@ -0,0 +1,114 @@
+///
+/// @file   count_primes_async.cpp
+/// @brief  Test count_primes_async() against count_primes()
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve.h>
+#include <primesieve.hpp>
+
+#include <stdint.h>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <future>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace primesieve;
+
+void check(bool OK)
+{
+  cout << "   " << (OK ? "OK" : "ERROR") << "\n";
+  if (!OK)
+    exit(1);
+}
+
+std::atomic<uint64_t> callbackSum(0);
+std::atomic<int> callbackCalls(0);
+
+extern "C"
+void countCallback(uint64_t count, void* data)
+{
+  callbackSum += count;
+  callbackCalls += *(int*) data;
+}
+
+int main()
+{
+  cout << "get_async_threads() = " << get_async_threads();
+  check(get_async_threads() >= 1);
+
+  // the cap is clamped to the number of CPU cores
+  set_async_threads(1000000);
+  cout << "set_async_threads(10^6) = " << get_async_threads();
+  check(get_async_threads() >= 1);
+
+  set_async_threads(1);
+  cout << "set_async_threads(1) = " << get_async_threads();
+  check(get_async_threads() == 1);
+
+  auto f1 = count_primes_async(0, 1000000);
+  uint64_t count = f1.get();
+  cout << "count_primes_async(0, 10^6) = " << count;
+  check(count == 78498);
+
+  // more jobs than the concurrency cap,
+  // the surplus jobs are queued
+  vector<future<uint64_t>> futures;
+  uint64_t total = 0;
+
+  for (uint64_t i = 0; i < 10; i++)
+  {
+    uint64_t start = (uint64_t) 1e9 + i * 10000000;
+    futures.emplace_back(count_primes_async(start, start + 1000000));
+  }
+
+  for (auto& f : futures)
+    total += f.get();
+
+  uint64_t expected = 0;
+  for (uint64_t i = 0; i < 10; i++)
+  {
+    uint64_t start = (uint64_t) 1e9 + i * 10000000;
+    expected += count_primes(start, start + 1000000);
+  }
+
+  cout << "sum of 10 async counts = " << total;
+  check(total == expected);
+
+  // the PiTable shortcut for tiny requests
+  auto tiny = count_primes_async(10, 30);
+  uint64_t tinyCount = tiny.get();
+  cout << "count_primes_async(10, 30) = " << tinyCount;
+  check(tinyCount == 6);
+
+  // C API callback flavor
+  int one = 1;
+  primesieve_count_primes_async(0, 100, countCallback, &one);
+  primesieve_count_primes_async(0, 1000, countCallback, &one);
+
+  // bounded wait, a dropped callback fails the
+  // test instead of hanging it forever
+  auto deadline = chrono::steady_clock::now() + chrono::seconds(60);
+  while (callbackCalls.load() < 2 &&
+         chrono::steady_clock::now() < deadline)
+    this_thread::sleep_for(chrono::milliseconds(1));
+
+  cout << "both callbacks invoked";
+  check(callbackCalls.load() == 2);
+
+  cout << "callback sum = " << callbackSum.load();
+  check(callbackSum.load() == 25 + 168);
+
+  cout << endl;
+  cout << "All tests passed successfully!" << endl;
+
+  return 0;
+}
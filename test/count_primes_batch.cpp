@@ -0,0 +1,67 @@
+///
+/// @file   count_primes_batch.cpp
+/// @brief  Test count_primes_batch() against count_primes()
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve.hpp>
+
+#include <stdint.h>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+using namespace primesieve;
+
+void check(bool OK)
+{
+  cout << "   " << (OK ? "OK" : "ERROR") << "\n";
+  if (!OK)
+    exit(1);
+}
+
+int main()
+{
+  vector<Range> ranges;
+
+  // scattered intervals of the same magnitude
+  for (uint64_t i = 0; i < 20; i++)
+  {
+    uint64_t start = (uint64_t) 1e10 + i * 400000007;
+    ranges.push_back({ start, start + 100000 });
+  }
+
+  ranges.push_back({ 0, 1000000 });
+  ranges.push_back({ 2, 2 });
+  ranges.push_back({ 100, 10 });
+  ranges.push_back({ 0, 0 });
+
+  auto counts = count_primes_batch(ranges.data(), ranges.size());
+
+  cout << "count_primes_batch() size = " << counts.size();
+  check(counts.size() == ranges.size());
+
+  for (size_t i = 0; i < ranges.size(); i++)
+  {
+    uint64_t expected = 0;
+    if (ranges[i].start <= ranges[i].stop)
+      expected = count_primes(ranges[i].start, ranges[i].stop);
+
+    cout << "counts[" << i << "] = " << counts[i];
+    check(counts[i] == expected);
+  }
+
+  auto empty = count_primes_batch(nullptr, 0);
+  cout << "count_primes_batch(nullptr, 0) size = " << empty.size();
+  check(empty.empty());
+
+  cout << endl;
+  cout << "All tests passed successfully!" << endl;
+
+  return 0;
+}
@@ -0,0 +1,82 @@
+///
+/// @file   fastdiv.cpp
+/// @brief  Test fastDiv(x, y) function.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve/pmath.hpp>
+
+#include <stdint.h>
+#include <iostream>
+#include <cstdlib>
+#include <random>
+
+using namespace std;
+using namespace primesieve;
+
+void check(bool OK)
+{
+  cout << "   " << (OK ? "OK" : "ERROR") << "\n";
+  if (!OK)
+    exit(1);
+}
+
+int main()
+{
+  uint64_t max64 = ~0ull;
+
+  cout << "fastDiv(0, 7) = " << fastDiv(0, 7);
+  check(fastDiv(0, 7) == 0);
+
+  cout << "fastDiv(6, 7) = " << fastDiv(6, 7);
+  check(fastDiv(6, 7) == 0);
+
+  cout << "fastDiv(7, 7) = " << fastDiv(7, 7);
+  check(fastDiv(7, 7) == 1);
+
+  cout << "fastDiv(2^64-1, 1) = " << fastDiv(max64, 1);
+  check(fastDiv(max64, 1) == max64);
+
+  cout << "fastDiv(2^64-1, 2^64-1) = " << fastDiv(max64, max64);
+  check(fastDiv(max64, max64) == 1);
+
+  cout << "fastDiv(2^64-1, 7) = " << fastDiv(max64, 7);
+  check(fastDiv(max64, 7) == max64 / 7);
+
+  std::mt19937_64 rng(123);
+  bool OK = true;
+
+  for (int i = 0; OK && i < 1000000; i++)
+  {
+    uint64_t x = rng();
+    uint64_t y = rng();
+
+    // mostly sieving prime sized divisors
+    if (i % 4 != 0)
+      y = (y % (1ull << 32)) | 7;
+    y |= 1;
+
+    OK = (fastDiv(x, y) == x / y);
+  }
+
+  cout << "fastDiv() vs / for 10^6 random inputs";
+  check(OK);
+
+  // quotients close to the double precision limit
+  OK = true;
+  for (uint64_t y = 1; OK && y < 100; y++)
+    for (uint64_t x = max64 - 100 * y; OK && x < max64; x++)
+      OK = (fastDiv(x, y) == x / y);
+
+  cout << "fastDiv() near 2^64";
+  check(OK);
+
+  cout << endl;
+  cout << "All tests passed successfully!" << endl;
+
+  return 0;
+}
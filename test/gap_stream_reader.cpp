@@ -0,0 +1,124 @@
+///
+/// @file   gap_stream_reader.cpp
+/// @brief  Test primesieve::GapStreamReader, the decoder for
+///         the delta encoded varint prime stream written by
+///         primesieve --binary=2.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve.hpp>
+
+#include <stdint.h>
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+using namespace primesieve;
+
+void check(bool OK)
+{
+  cout << "   " << (OK ? "OK" : "ERROR") << "\n";
+  if (!OK)
+    exit(1);
+}
+
+/// Encode a varint, same format as PrintPrimes
+void encodeVarint(vector<unsigned char>& stream, uint64_t value)
+{
+  while (value >= 0x80)
+  {
+    stream.push_back((unsigned char) (value | 0x80));
+    value >>= 7;
+  }
+  stream.push_back((unsigned char) value);
+}
+
+int main()
+{
+  vector<uint64_t> primes;
+  generate_primes(10000000, &primes);
+
+  // encode the primes as gap varints with a sync
+  // point (0x00 + absolute prime) every 2^16 primes
+  vector<unsigned char> stream;
+  uint64_t prevPrime = 0;
+
+  for (size_t i = 0; i < primes.size(); i++)
+  {
+    if ((i & 0xffff) == 0)
+    {
+      stream.push_back(0);
+      encodeVarint(stream, primes[i]);
+    }
+    else
+      encodeVarint(stream, primes[i] - prevPrime);
+
+    prevPrime = primes[i];
+  }
+
+  // decode the whole stream using the batch interface
+  GapStreamReader reader(&stream[0], stream.size());
+  vector<uint64_t> decoded;
+  uint64_t buffer[8];
+  size_t size;
+
+  while ((size = reader.read(buffer, 8)) > 0)
+    decoded.insert(decoded.end(), buffer, buffer + size);
+
+  cout << "GapStreamReader decodes " << primes.size() << " primes";
+  check(decoded == primes);
+
+  cout << "GapStreamReader::atEnd()";
+  check(reader.atEnd());
+
+  // start in the middle of the stream, sync() scans
+  // forward to the next sync point
+  GapStreamReader reader2(&stream[stream.size() / 2], stream.size() - stream.size() / 2);
+  cout << "GapStreamReader::sync() finds a sync point";
+  check(reader2.sync());
+
+  decoded.clear();
+  while ((size = reader2.read(buffer, 8)) > 0)
+    decoded.insert(decoded.end(), buffer, buffer + size);
+
+  cout << "GapStreamReader decodes a suffix after sync()";
+  check(!decoded.empty() &&
+        decoded.back() == primes.back() &&
+        equal(decoded.begin(), decoded.end(), primes.end() - decoded.size()));
+
+  // a sync point starts at a 2^16 prime boundary
+  cout << "GapStreamReader sync points every 2^16 primes";
+  check(((primes.size() - decoded.size()) & 0xffff) == 0);
+
+  // a stream ending in the middle of a multi-byte
+  // varint throws a primesieve_error
+  vector<unsigned char> truncated;
+  truncated.push_back(0);
+  encodeVarint(truncated, 1000003);
+  truncated.pop_back();
+  GapStreamReader reader3(&truncated[0], truncated.size());
+  bool error = false;
+
+  try
+  {
+    reader3.read(buffer, 8);
+  }
+  catch (const primesieve_error&)
+  {
+    error = true;
+  }
+
+  cout << "GapStreamReader throws on a truncated stream";
+  check(error);
+
+  cout << endl;
+  cout << "All tests passed successfully!" << endl;
+
+  return 0;
+}
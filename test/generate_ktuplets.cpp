@@ -0,0 +1,105 @@
+///
+/// @file   generate_ktuplets.cpp
+/// @brief  Test primesieve::generate_ktuplets() which extracts
+///         the start values of prime k-tuplets directly from
+///         the sieve bits.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve.hpp>
+
+#include <stdint.h>
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+using namespace primesieve;
+
+void check(bool OK)
+{
+  cout << "   " << (OK ? "OK" : "ERROR") << "\n";
+  if (!OK)
+    exit(1);
+}
+
+int main()
+{
+  uint64_t stop = (uint64_t) 1e7;
+
+  // count_* uses an independent code path
+  // (kCounts_ table in PrintPrimes)
+  uint64_t counts[7] = { 0, 0,
+                         count_twins(0, stop),
+                         count_triplets(0, stop),
+                         count_quadruplets(0, stop),
+                         count_quintuplets(0, stop),
+                         count_sextuplets(0, stop) };
+
+  // the largest sextuplet member is start + 16
+  vector<uint64_t> primes;
+  generate_primes(0, stop + 16, &primes);
+
+  for (int k = 2; k <= 6; k++)
+  {
+    vector<uint64_t> tuplets;
+    generate_ktuplets(0, stop, k, tuplets);
+
+    cout << "ktuplets(" << k << ") size = count";
+    check(tuplets.size() == counts[k]);
+
+    cout << "ktuplets(" << k << ") sorted ascending";
+    check(is_sorted(tuplets.begin(), tuplets.end()));
+
+    cout << "ktuplets(" << k << ") start values are prime";
+    bool allPrime = true;
+    for (uint64_t t : tuplets)
+      allPrime &= binary_search(primes.begin(), primes.end(), t);
+    check(allPrime);
+  }
+
+  // generate_twin_primes() uses a separate lookup table
+  vector<uint64_t> twins1;
+  vector<uint64_t> twins2;
+  generate_twin_primes(0, stop, twins1);
+  generate_ktuplets(0, stop, 2, twins2);
+  cout << "ktuplets(2) matches generate_twin_primes";
+  check(twins1 == twins2);
+
+  // small k-tuplets whose first prime is < 7
+  vector<uint64_t> quintuplets;
+  generate_ktuplets(0, 20, 5, quintuplets);
+  cout << "Quintuplets <= 20 are (5, ...) and (7, ...)";
+  check(quintuplets == vector<uint64_t>({ 5, 7 }));
+
+  // both members must be inside [start, stop]
+  vector<uint64_t> twins3;
+  generate_ktuplets(12, 17, 2, twins3);
+  cout << "Twins in [12, 17] is empty";
+  check(twins3.empty());
+
+  // k out of range is rejected
+  bool error = false;
+  try
+  {
+    vector<uint64_t> tuplets;
+    generate_ktuplets(0, 100, 7, tuplets);
+  }
+  catch (const primesieve_error&)
+  {
+    error = true;
+  }
+
+  cout << "ktuplets(7) is rejected";
+  check(error);
+
+  cout << endl;
+  cout << "All tests passed successfully!" << endl;
+
+  return 0;
+}
@@ -0,0 +1,90 @@
+///
+/// @file   generate_primes_buf.c
+/// @brief  Test prime number generation into a
+///         caller-allocated buffer.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve.h>
+
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// primes inside [0, 100]
+const uint64_t small_primes[25] =
+{
+   2,  3,  5,  7, 11,
+  13, 17, 19, 23, 29,
+  31, 37, 41, 43, 47,
+  53, 59, 61, 67, 71,
+  73, 79, 83, 89, 97
+};
+
+void check(int OK)
+{
+  if (OK)
+    printf("   OK\n");
+  else
+  {
+    printf("   ERROR\n");
+    exit(1);
+  }
+}
+
+int main()
+{
+  uint64_t primes64[50];
+  int primes32[50];
+  size_t n;
+  size_t i;
+
+  // normal fill, the buffer is larger than the result
+  n = primesieve_generate_primes_buf(0, 100, primes64, 50, UINT64_PRIMES);
+  printf("primes in [0, 100] = %" PRIuMAX, (uintmax_t) n);
+  check(n == 25);
+
+  for (i = 0; i < 25; i++)
+  {
+    printf("prime = %" PRIu64, primes64[i]);
+    check(primes64[i] == small_primes[i]);
+  }
+
+  // 32-bit primes with both bounds prime
+  n = primesieve_generate_primes_buf(2, 97, primes32, 50, INT_PRIMES);
+  printf("primes in [2, 97] = %" PRIuMAX, (uintmax_t) n);
+  check(n == 25 &&
+        primes32[0] == 2 &&
+        primes32[24] == 97);
+
+  // a full buffer truncates the result,
+  // the return value equals the capacity
+  n = primesieve_generate_primes_buf(0, 100, primes64, 10, UINT64_PRIMES);
+  printf("truncated to capacity = %" PRIuMAX, (uintmax_t) n);
+  check(n == 10);
+
+  for (i = 0; i < 10; i++)
+  {
+    printf("prime = %" PRIu64, primes64[i]);
+    check(primes64[i] == small_primes[i]);
+  }
+
+  // empty range
+  n = primesieve_generate_primes_buf(24, 28, primes64, 50, UINT64_PRIMES);
+  printf("primes in [24, 28] = %" PRIuMAX, (uintmax_t) n);
+  check(n == 0);
+
+  // an invalid type returns SIZE_MAX (~0)
+  n = primesieve_generate_primes_buf(0, 100, primes64, 50, -1);
+  printf("invalid type is rejected");
+  check(n == ~((size_t) 0));
+
+  printf("\nAll tests passed successfully!\n");
+
+  return 0;
+}
@@ -0,0 +1,107 @@
+///
+/// @file   generate_primes_uint32.cpp
+/// @brief  Test the native 32-bit prime generation path.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve.h>
+#include <primesieve.hpp>
+
+#include <stdint.h>
+#include <iostream>
+#include <cstddef>
+#include <cstdlib>
+#include <vector>
+
+using namespace std;
+using namespace primesieve;
+
+void check(bool OK)
+{
+  cout << "   " << (OK ? "OK" : "ERROR") << "\n";
+  if (!OK)
+    exit(1);
+}
+
+int main()
+{
+  cout << left;
+
+  const uint64_t intervals[][2] =
+  {
+    { 0, 100 },
+    { 0, 65535 },
+    { 0, 65536 },
+    { 0, 1000000 },
+    { 100, 200 },
+    { 999999000, 1000001000 },
+    { 4294966000ull, 4294967295ull },
+    { 100, 10 }
+  };
+
+  for (auto& interval : intervals)
+  {
+    uint64_t start = interval[0];
+    uint64_t stop = interval[1];
+
+    vector<uint64_t> primes64;
+    generate_primes(start, stop, &primes64);
+    vector<uint32_t> primes32;
+    generate_primes(start, stop, &primes32);
+
+    bool OK = (primes32.size() == primes64.size());
+    for (size_t i = 0; OK && i < primes32.size(); i++)
+      OK = (primes32[i] == primes64[i]);
+
+    cout << "Primes inside [" << start << ", " << stop << "] = " << primes32.size();
+    check(OK);
+  }
+
+  // the largest prime < 2^32 is 4294967291
+  vector<uint32_t> primes32;
+  generate_primes(4294967290ull, 4294967295ull, &primes32);
+  cout << "Largest prime < 2^32 = " << primes32.back();
+  check(primes32.size() == 1 && primes32.back() == 4294967291u);
+
+  // stop > 2^32 - 1 must throw
+  bool threw = false;
+  try
+  {
+    primes32.clear();
+    generate_primes(0, 1ull << 32, &primes32);
+  }
+  catch (primesieve_error&)
+  {
+    threw = true;
+  }
+  cout << "generate_primes(0, 2^32, uint32_t) throws";
+  check(threw);
+
+  // C API native 32-bit path
+  size_t size = 0;
+  uint32_t* primes = (uint32_t*) primesieve_generate_primes(0, 1000000, &size, UINT32_PRIMES);
+  vector<uint64_t> primes64;
+  generate_primes(0, 1000000, &primes64);
+
+  bool OK = (primes != NULL && size == primes64.size());
+  for (size_t i = 0; OK && i < size; i++)
+    OK = (primes[i] == primes64[i]);
+
+  cout << "primesieve_generate_primes(UINT32_PRIMES) below 10^6 = " << size;
+  check(OK);
+  primesieve_free(primes);
+
+  // C API sets errno for stop > 2^32 - 1
+  primes = (uint32_t*) primesieve_generate_primes(0, 1ull << 32, &size, UINT32_PRIMES);
+  cout << "primesieve_generate_primes(UINT32_PRIMES, 2^32) fails";
+  check(primes == NULL && size == 0);
+
+  cout << endl;
+  cout << "All tests passed successfully!" << endl;
+
+  return 0;
+}
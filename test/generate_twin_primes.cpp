@@ -0,0 +1,93 @@
+///
+/// @file   generate_twin_primes.cpp
+/// @brief  Test twin prime generation.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve.hpp>
+
+#include <stdint.h>
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+
+using namespace std;
+using namespace primesieve;
+
+void check(bool OK)
+{
+  cout << "   " << (OK ? "OK" : "ERROR") << "\n";
+  if (!OK)
+    exit(1);
+}
+
+/// Reference implementation: generate all primes
+/// and diff neighboring primes
+vector<uint64_t> twins_reference(uint64_t start, uint64_t stop)
+{
+  vector<uint64_t> primes;
+  generate_primes(start, stop, &primes);
+  vector<uint64_t> twins;
+
+  for (size_t i = 1; i < primes.size(); i++)
+    if (primes[i] - primes[i - 1] == 2)
+      twins.push_back(primes[i - 1]);
+
+  return twins;
+}
+
+int main()
+{
+  cout << left;
+
+  const uint64_t intervals[][2] =
+  {
+    { 0, 100 },
+    { 0, 13 },
+    { 3, 7 },
+    { 4, 7 },
+    { 3, 6 },
+    { 5, 13 },
+    { 6, 13 },
+    { 100, 2000 },
+    { 311, 1000 },
+    { 312, 1000 },
+    { 314, 1000 },
+    { 999999000ull, 1000001000ull },
+    { 1000000000000000ull, 1000000000100000ull }
+  };
+
+  for (auto& interval : intervals)
+  {
+    uint64_t start = interval[0];
+    uint64_t stop = interval[1];
+
+    vector<uint64_t> twins;
+    generate_twin_primes(start, stop, twins);
+    vector<uint64_t> reference = twins_reference(start, stop);
+
+    cout << "Twins inside [" << start << ", " << stop << "] = " << twins.size();
+    check(twins == reference);
+  }
+
+  // count_twins() uses the same interval semantics
+  vector<uint64_t> twins;
+  generate_twin_primes(0, 100000000, twins);
+  cout << "Twins inside [0, 10^8] = " << twins.size();
+  check(twins.size() == count_twins(0, 100000000));
+
+  // start > stop
+  twins.clear();
+  generate_twin_primes(100, 10, twins);
+  cout << "Twins inside [100, 10] = " << twins.size();
+  check(twins.empty());
+
+  cout << endl;
+  cout << "All tests passed successfully!" << endl;
+
+  return 0;
+}
@@ -0,0 +1,98 @@
+///
+/// @file   generator.cpp
+/// @brief  Test the C++20 coroutine based primesieve::generator
+///         created using prime_generator().
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve.hpp>
+
+#include <stdint.h>
+#include <cstdlib>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using namespace primesieve;
+
+void check(bool OK)
+{
+  cout << "   " << (OK ? "OK" : "ERROR") << "\n";
+  if (!OK)
+    exit(1);
+}
+
+#if !defined(PRIMESIEVE_HAS_GENERATOR)
+
+int main()
+{
+  cout << "Skipped, compiler lacks C++20 coroutines" << endl;
+  cout << endl;
+  cout << "All tests passed successfully!" << endl;
+  return 0;
+}
+
+#else
+
+int main()
+{
+  uint64_t stop = (uint64_t) 1e7;
+
+  // spans multiple batch refills
+  vector<uint64_t> primes;
+  generate_primes(0, stop, &primes);
+
+  auto gen = prime_generator(0, stop);
+  uint64_t prime;
+  size_t i = 0;
+  bool match = true;
+
+  while (gen.next(prime))
+    match &= (i < primes.size() && primes[i++] == prime);
+
+  cout << "Generator yields the primes <= 1e7";
+  check(match && i == primes.size());
+
+  cout << "Exhausted generator stays exhausted";
+  check(!gen.next(prime));
+
+  // sub-range with both bounds prime
+  auto gen2 = prime_generator(101, 997);
+  vector<uint64_t> primes2;
+  while (gen2.next(prime))
+    primes2.push_back(prime);
+
+  cout << "Generator primes in [101, 997]";
+  check(primes2.size() == 143 &&
+        primes2.front() == 101 &&
+        primes2.back() == 997);
+
+  // empty range
+  auto gen3 = prime_generator(24, 28);
+  cout << "Generator of an empty range";
+  check(!gen3.next(prime));
+
+  // move semantics, the moved-to generator resumes
+  // where the moved-from generator stopped
+  auto gen4 = prime_generator(0, 100);
+  gen4.next(prime);
+  cout << "First prime is 2";
+  check(prime == 2);
+
+  auto gen5 = std::move(gen4);
+  gen5.next(prime);
+  cout << "Moved generator continues with 3";
+  check(prime == 3);
+
+  cout << endl;
+  cout << "All tests passed successfully!" << endl;
+
+  return 0;
+}
+
+#endif
@@ -0,0 +1,119 @@
+///
+/// @file   histogram.cpp
+/// @brief  Test the prime density histogram mode, see
+///         PrimeSieve::setHistogramWidth(). The histogram
+///         lines are captured by redirecting std::cout and
+///         each interval count is compared against
+///         primesieve::count_primes().
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve.hpp>
+#include <primesieve/PrimeSieve.hpp>
+
+#include <stdint.h>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using namespace primesieve;
+
+void check(bool OK)
+{
+  cout << "   " << (OK ? "OK" : "ERROR") << "\n";
+  if (!OK)
+    exit(1);
+}
+
+/// Run a histogram sieve over [start, stop] and
+/// parse the "intervalStart primeCount" lines
+vector<pair<uint64_t, uint64_t>>
+histogram(uint64_t start, uint64_t stop, uint64_t width)
+{
+  ostringstream oss;
+  streambuf* coutBuf = cout.rdbuf(oss.rdbuf());
+
+  PrimeSieve ps;
+  ps.setHistogramWidth(width);
+  ps.sieve(start, stop, COUNT_PRIMES);
+
+  cout.rdbuf(coutBuf);
+
+  vector<pair<uint64_t, uint64_t>> intervals;
+  istringstream iss(oss.str());
+  uint64_t intervalStart, count;
+
+  while (iss >> intervalStart >> count)
+    intervals.emplace_back(intervalStart, count);
+
+  return intervals;
+}
+
+int main()
+{
+  uint64_t stop = (uint64_t) 1e9;
+  uint64_t width = (uint64_t) 1e8;
+
+  auto intervals = histogram(0, stop, width);
+
+  cout << "Histogram [0, 1e9] has 10 intervals of 1e8";
+  check(intervals.size() == 10);
+
+  for (size_t i = 0; i < intervals.size(); i++)
+  {
+    uint64_t low = i * width;
+    cout << "Histogram interval [" << low << ", " << low + width << "[";
+    check(intervals[i].first == low &&
+          intervals[i].second == count_primes(low, low + width - 1));
+  }
+
+  // start and stop inside an interval, the intervals
+  // stay aligned to multiples of the width
+  uint64_t start2 = 50;
+  uint64_t stop2 = (uint64_t) 1e9 + 12345;
+  auto intervals2 = histogram(start2, stop2, width);
+
+  cout << "Histogram [50, 1e9+12345] has 11 intervals";
+  check(intervals2.size() == 11);
+  cout << "Histogram partial first interval";
+  check(intervals2.front().first == 0 &&
+        intervals2.front().second == count_primes(start2, width - 1));
+  cout << "Histogram partial last interval";
+  check(intervals2.back().first == stop &&
+        intervals2.back().second == count_primes(stop, stop2));
+
+  // the interval counts add up to the total count
+  uint64_t sum = 0;
+  for (auto& interval : intervals2)
+    sum += interval.second;
+
+  cout << "Histogram counts sum to the prime count";
+  check(sum == count_primes(start2, stop2));
+
+  // a width below the minimum is rejected
+  bool error = false;
+  try
+  {
+    PrimeSieve ps;
+    ps.setHistogramWidth(99);
+  }
+  catch (const primesieve_error&)
+  {
+    error = true;
+  }
+
+  cout << "Histogram width < 100 is rejected";
+  check(error);
+
+  cout << endl;
+  cout << "All tests passed successfully!" << endl;
+
+  return 0;
+}
@@ -0,0 +1,100 @@
+///
+/// @file   iterator_cache_size.cpp
+/// @brief  Test the per iterator cache size policy,
+///         set_cache_size() & primesieve_set_cache_size().
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve.hpp>
+#include <primesieve.h>
+
+#include <stdint.h>
+#include <cstdlib>
+#include <iostream>
+
+using namespace std;
+
+void check(bool OK)
+{
+  cout << "   " << (OK ? "OK" : "ERROR") << "\n";
+  if (!OK)
+    exit(1);
+}
+
+int main()
+{
+  // a tiny cache must generate exactly the
+  // same primes as the default cache
+  {
+    primesieve::iterator it;
+    it.set_cache_size(1 << 16, 1 << 18);
+    primesieve::iterator ref;
+    bool OK = true;
+
+    for (int i = 0; OK && i < 100000; i++)
+      OK = (it.next_prime() == ref.next_prime());
+
+    cout << "next_prime() with 64 KiB cache";
+    check(OK);
+  }
+
+  // same backwards, the minimum governs
+  // the backward window sizing
+  {
+    primesieve::iterator it(1000000000ull);
+    it.set_cache_size(1 << 16, 1 << 18);
+    primesieve::iterator ref(1000000000ull);
+    bool OK = true;
+
+    for (int i = 0; OK && i < 100000; i++)
+      OK = (it.prev_prime() == ref.prev_prime());
+
+    cout << "prev_prime() with 64 KiB cache";
+    check(OK);
+  }
+
+  // a huge cache limit
+  {
+    primesieve::iterator it;
+    it.set_cache_size(0, 1ull << 32);
+    bool OK = true;
+
+    for (int i = 0; OK && i < 100000; i++)
+      OK = (it.next_prime() <= 1299709);
+
+    cout << "next_prime() with 4 GiB cache limit";
+    check(OK && it.prev_prime() == 1299689);
+  }
+
+  // C API
+  {
+    primesieve_iterator it;
+    primesieve_init(&it);
+    primesieve_set_cache_size(&it, 1 << 16, 1 << 18);
+    primesieve::iterator ref;
+    bool OK = true;
+
+    for (int i = 0; OK && i < 100000; i++)
+      OK = (primesieve_next_prime(&it) == ref.next_prime());
+
+    cout << "primesieve_next_prime() with 64 KiB cache";
+    check(OK);
+
+    for (int i = 0; OK && i < 50000; i++)
+      OK = (primesieve_prev_prime(&it) == ref.prev_prime());
+
+    cout << "primesieve_prev_prime() with 64 KiB cache";
+    check(OK);
+
+    primesieve_free_iterator(&it);
+  }
+
+  cout << endl;
+  cout << "All tests passed successfully!" << endl;
+
+  return 0;
+}
@@ -0,0 +1,112 @@
+///
+/// @file   iterator_flip.cpp
+/// @brief  Test alternating next_prime() / prev_prime() calls,
+///         the iterator caches the adjacent sieved window so
+///         direction flips do not re-sieve it.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve.hpp>
+
+#include <stdint.h>
+#include <iostream>
+#include <cstdlib>
+
+using namespace std;
+
+void check(bool OK)
+{
+  cout << "   " << (OK ? "OK" : "ERROR") << "\n";
+  if (!OK)
+    exit(1);
+}
+
+/// Alternate directions around the iterator's current
+/// position and verify the primes against a second
+/// iterator which never changes direction mid-window.
+///
+bool testPivot(uint64_t pivot)
+{
+  primesieve::iterator it(pivot);
+  bool OK = true;
+
+  for (int steps = 1; OK && steps <= 64; steps++)
+  {
+    uint64_t prime = 0;
+
+    for (int i = 0; i < steps; i++)
+      prime = it.next_prime();
+    {
+      primesieve::iterator ref(prime);
+      OK = (ref.next_prime() > prime);
+      primesieve::iterator ref2(prime - 1);
+      OK &= (ref2.next_prime() == prime);
+    }
+
+    for (int i = 0; OK && i < steps * 2; i++)
+      prime = it.prev_prime();
+    if (OK && prime > 2)
+    {
+      primesieve::iterator ref(prime);
+      OK &= (ref.prev_prime() < prime);
+      primesieve::iterator ref2(prime + 1);
+      OK &= (ref2.prev_prime() == prime);
+    }
+
+    for (int i = 0; OK && i < steps; i++)
+      prime = it.next_prime();
+  }
+
+  return OK;
+}
+
+int main()
+{
+  // pivots at and around sieved window boundaries
+  const uint64_t pivots[] =
+  {
+    1000,
+    100000,
+    10000000,
+    305, // PrimeGenerator::maxCachedPrime() - few
+    311, // PrimeGenerator::maxCachedPrime()
+    320  // PrimeGenerator::maxCachedPrime() + few
+  };
+
+  for (uint64_t pivot : pivots)
+  {
+    cout << "Alternating around " << pivot;
+    check(testPivot(pivot));
+  }
+
+  // long zig-zag drifting upwards
+  {
+    primesieve::iterator it(0);
+    primesieve::iterator ref(0);
+    bool OK = true;
+    uint64_t prime = 0;
+
+    for (int i = 0; OK && i < 1000; i++)
+    {
+      for (int j = 0; j < 3; j++)
+        prime = it.next_prime();
+      prime = it.prev_prime();
+      for (int j = 0; j < 2; j++)
+        OK = (ref.next_prime() <= prime);
+      OK &= (ref.prev_prime() < prime);
+      ref.next_prime();
+    }
+
+    cout << "Zig-zag upwards, last prime = " << prime;
+    check(OK && prime == primesieve::nth_prime(2000));
+  }
+
+  cout << endl;
+  cout << "All tests passed successfully!" << endl;
+
+  return 0;
+}
@@ -0,0 +1,102 @@
+///
+/// @file   milestone_cache.cpp
+/// @brief  Test the persistent (x, pi(x)) milestone cache
+///         consulted by primesieve::count_primes(), enabled
+///         via the PRIMESIEVE_MILESTONES environment variable.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve.hpp>
+
+#include <stdint.h>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+using namespace std;
+using namespace primesieve;
+
+void check(bool OK)
+{
+  cout << "   " << (OK ? "OK" : "ERROR") << "\n";
+  if (!OK)
+    exit(1);
+}
+
+#if defined(_WIN32)
+
+// setenv() is not available on Windows and the
+// milestone cache must be enabled before the first
+// count_primes() call, skip this test
+int main()
+{
+  cout << "Skipped, no setenv() on Windows" << endl;
+  cout << endl;
+  cout << "All tests passed successfully!" << endl;
+  return 0;
+}
+
+#else
+
+/// Read the milestones (skipping the magic line)
+/// from the cache file
+int countMilestones(const string& path, uint64_t x, uint64_t count)
+{
+  ifstream file(path);
+  string magic;
+  file >> magic;
+
+  int found = 0;
+  uint64_t mx, mcount;
+  while (file >> mx >> mcount)
+    found += (mx == x && mcount == count);
+
+  return found;
+}
+
+int main()
+{
+  string path = "milestones.txt";
+  remove(path.c_str());
+  setenv("PRIMESIEVE_MILESTONES", path.c_str(), 1);
+
+  uint64_t count1 = count_primes(0, (uint64_t) 1e8);
+  cout << "count_primes(0, 1e8) = " << count1;
+  check(count1 == 5761455);
+
+  cout << "Milestone (1e8, pi(1e8)) persisted";
+  check(countMilestones(path, (uint64_t) 1e8, count1) == 1);
+
+  // answered from the milestone, sieves only ]1e8, 1e8 + 1e7]
+  uint64_t count2 = count_primes(0, (uint64_t) 1e8 + 10000000);
+  cout << "count_primes(0, 1e8 + 1e7) = " << count2;
+  check(count2 == 6303309);
+
+  cout << "Milestone (1e8 + 1e7, ...) persisted";
+  check(countMilestones(path, (uint64_t) 1e8 + 10000000, count2) == 1);
+
+  // exact milestone hit, no sieving at all
+  uint64_t count3 = count_primes(0, (uint64_t) 1e8);
+  cout << "Repeated count is answered from the cache";
+  check(count3 == count1);
+
+  // queries with start > 0 bypass the cache
+  uint64_t count4 = count_primes(100, (uint64_t) 1e8);
+  cout << "count_primes(100, 1e8) bypasses the cache";
+  check(count4 == count1 - 25);
+
+  remove(path.c_str());
+
+  cout << endl;
+  cout << "All tests passed successfully!" << endl;
+
+  return 0;
+}
+
+#endif
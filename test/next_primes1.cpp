@@ -0,0 +1,91 @@
+///
+/// @file   next_primes1.cpp
+/// @brief  Test the batched iterator::next_primes().
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve.hpp>
+
+#include <stdint.h>
+#include <iostream>
+#include <cstddef>
+#include <cstdlib>
+#include <vector>
+
+using namespace std;
+
+void check(bool OK)
+{
+  cout << "   " << (OK ? "OK" : "ERROR") << "\n";
+  if (!OK)
+    exit(1);
+}
+
+int main()
+{
+  cout << left;
+
+  vector<uint64_t> primes;
+  primesieve::generate_primes(2000000, &primes);
+
+  // batch sizes around the internal block boundaries
+  const size_t sizes[] = { 1, 2, 7, 64, 100, 1000, 4096 };
+
+  for (size_t n : sizes)
+  {
+    primesieve::iterator it;
+    vector<uint64_t> batch(n);
+    size_t i = 0;
+    bool OK = true;
+
+    while (i < primes.size())
+    {
+      size_t count = it.next_primes(batch.data(), n);
+      OK &= (count == n);
+
+      for (size_t j = 0; j < count && i < primes.size(); j++, i++)
+        OK &= (batch[j] == primes[i]);
+    }
+
+    cout << "next_primes(" << n << ") returned all primes below 2*10^6";
+    check(OK);
+  }
+
+  // mixing next_prime() and next_primes() must
+  // not skip or duplicate primes
+  primesieve::iterator it;
+  uint64_t batch[10];
+  size_t i = 0;
+  bool OK = true;
+
+  while (i + 11 < primes.size())
+  {
+    OK &= (it.next_prime() == primes[i]);
+    i++;
+
+    size_t count = it.next_primes(batch, 10);
+    OK &= (count == 10);
+
+    for (size_t j = 0; j < count; j++, i++)
+      OK &= (batch[j] == primes[i]);
+  }
+
+  cout << "mixed next_prime() and next_primes()";
+  check(OK);
+
+  // the primes > 2^64 sentinel ends the batch
+  primesieve::iterator it2(18446744073709551533ull);
+  uint64_t last[4];
+  size_t count = it2.next_primes(last, 4);
+  cout << "next_primes() near 2^64 returned " << count << " primes";
+  check(count == 1 && last[0] == 18446744073709551557ull);
+
+  cout << endl;
+  cout << "All tests passed successfully!" << endl;
+
+  return 0;
+}
@@ -0,0 +1,92 @@
+/**
+ * @file   next_primes2.c
+ * @brief  Test primesieve_next_primes().
+ *
+ * Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+ *
+ * This file is distributed under the BSD License. See the COPYING
+ * file in the top level directory.
+ */
+
+#include <primesieve.h>
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+void check(int OK)
+{
+  if (OK)
+    printf("   OK\n");
+  else
+  {
+    printf("   ERROR\n");
+    exit(1);
+  }
+}
+
+int main()
+{
+  size_t size = 0;
+  uint64_t* primes = (uint64_t*) primesieve_generate_primes(0, 2000000, &size, UINT64_PRIMES);
+  uint64_t batch[1000];
+  size_t batch_sizes[] = { 1, 7, 64, 1000 };
+  size_t b, i, j, n, count;
+  int OK;
+
+  for (b = 0; b < sizeof(batch_sizes) / sizeof(size_t); b++)
+  {
+    primesieve_iterator it;
+    primesieve_init(&it);
+    n = batch_sizes[b];
+    i = 0;
+    OK = 1;
+
+    while (i < size)
+    {
+      count = primesieve_next_primes(&it, batch, n);
+      OK &= (count == n);
+
+      for (j = 0; j < count && i < size; j++, i++)
+        OK &= (batch[j] == primes[i]);
+    }
+
+    printf("primesieve_next_primes(%zu) returned all primes below 2*10^6", n);
+    check(OK);
+
+    primesieve_free_iterator(&it);
+  }
+
+  /* mixing single and batched calls must not skip primes */
+  {
+    primesieve_iterator it;
+    primesieve_init(&it);
+    i = 0;
+    OK = 1;
+
+    while (i + 11 < size)
+    {
+      OK &= (primesieve_next_prime(&it) == primes[i]);
+      i++;
+
+      count = primesieve_next_primes(&it, batch, 10);
+      OK &= (count == 10);
+
+      for (j = 0; j < count; j++, i++)
+        OK &= (batch[j] == primes[i]);
+    }
+
+    printf("mixed primesieve_next_prime() and primesieve_next_primes()");
+    check(OK);
+
+    primesieve_free_iterator(&it);
+  }
+
+  primesieve_free(primes);
+
+  printf("\n");
+  printf("All tests passed successfully!\n");
+
+  return 0;
+}
@@ -0,0 +1,108 @@
+///
+/// @file   prime_gaps.cpp
+/// @brief  Test prime gap finding.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve.hpp>
+
+#include <stdint.h>
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+
+using namespace std;
+using namespace primesieve;
+
+void check(bool OK)
+{
+  cout << "   " << (OK ? "OK" : "ERROR") << "\n";
+  if (!OK)
+    exit(1);
+}
+
+/// Reference implementation: generate all primes
+/// and diff neighboring primes
+vector<PrimeGap> gaps_reference(uint64_t start, uint64_t stop, uint64_t minGap)
+{
+  vector<uint64_t> primes;
+  generate_primes(start, stop, &primes);
+  vector<PrimeGap> gaps;
+
+  for (size_t i = 1; i < primes.size(); i++)
+    if (primes[i] - primes[i - 1] >= minGap)
+      gaps.push_back({ primes[i - 1], primes[i] });
+
+  return gaps;
+}
+
+namespace primesieve {
+
+bool operator==(const PrimeGap& a, const PrimeGap& b)
+{
+  return a.prevPrime == b.prevPrime &&
+         a.nextPrime == b.nextPrime;
+}
+
+} // namespace
+
+int main()
+{
+  cout << left;
+
+  const uint64_t intervals[][3] =
+  {
+    // start, stop, minGap
+    { 0, 1000, 1 },
+    { 0, 1000, 8 },
+    { 0, 100000, 20 },
+    { 100, 10000, 2 },
+    { 113, 127, 14 },
+    { 114, 127, 14 },
+    { 113, 126, 14 },
+    { 1000000, 2000000, 100 },
+    { 999999000ull, 1000001000ull, 1 },
+    { 1000000000000000ull, 1000000001000000ull, 500 }
+  };
+
+  for (auto& interval : intervals)
+  {
+    uint64_t start = interval[0];
+    uint64_t stop = interval[1];
+    uint64_t minGap = interval[2];
+
+    auto gaps = find_prime_gaps(start, stop, minGap);
+    auto reference = gaps_reference(start, stop, minGap);
+
+    cout << "Gaps >= " << minGap << " inside [" << start << ", " << stop << "] = " << gaps.size();
+    check(gaps == reference);
+  }
+
+  // the maximal gap below 10^4 is 36, between 9551 and 9587
+  PrimeGap maxGap = max_prime_gap(0, 10000);
+  cout << "Maximal gap inside [0, 10^4] = " << (maxGap.nextPrime - maxGap.prevPrime);
+  check(maxGap.prevPrime == 9551 && maxGap.nextPrime == 9587);
+
+  // the maximal gap below 10^8 is 220, between 47326693 and 47326913
+  maxGap = max_prime_gap(0, 100000000);
+  cout << "Maximal gap inside [0, 10^8] = " << (maxGap.nextPrime - maxGap.prevPrime);
+  check(maxGap.prevPrime == 47326693 && maxGap.nextPrime == 47326913);
+
+  // intervals with < 2 primes have no gap
+  maxGap = max_prime_gap(24, 28);
+  cout << "Maximal gap inside [24, 28] = " << (maxGap.nextPrime - maxGap.prevPrime);
+  check(maxGap.prevPrime == 0 && maxGap.nextPrime == 0);
+
+  maxGap = max_prime_gap(100, 10);
+  cout << "Maximal gap inside [100, 10] = " << (maxGap.nextPrime - maxGap.prevPrime);
+  check(maxGap.prevPrime == 0 && maxGap.nextPrime == 0);
+
+  cout << endl;
+  cout << "All tests passed successfully!" << endl;
+
+  return 0;
+}
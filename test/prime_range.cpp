@@ -0,0 +1,87 @@
+///
+/// @file   prime_range.cpp
+/// @brief  Test the lazy prime_range() STL adaptor.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve.hpp>
+
+#include <stdint.h>
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+#include <cstdlib>
+#include <vector>
+
+using namespace std;
+using namespace primesieve;
+
+void check(bool OK)
+{
+  cout << "   " << (OK ? "OK" : "ERROR") << "\n";
+  if (!OK)
+    exit(1);
+}
+
+int main()
+{
+  cout << left;
+
+  // range-based for loop
+  uint64_t count = 0;
+  for (uint64_t prime : prime_range(1000000))
+  {
+    (void) prime;
+    count++;
+  }
+  cout << "Primes below 10^6 = " << count;
+  check(count == 78498);
+
+  // STL algorithm on a subinterval
+  auto range = prime_range(100, 200);
+  count = count_if(range.begin(), range.end(),
+                   [](uint64_t prime) { return prime % 10 == 1; });
+  cout << "Primes inside [100, 200] ending in 1 = " << count;
+  check(count == 5);
+
+  // std::copy matches generate_primes()
+  vector<uint64_t> expected;
+  generate_primes(1000, 100000, &expected);
+  vector<uint64_t> primes;
+  auto range2 = prime_range(1000, 100000);
+  copy(range2.begin(), range2.end(), back_inserter(primes));
+  cout << "prime_range(1000, 100000) matches generate_primes()";
+  check(primes == expected);
+
+  // both interval bounds are inclusive
+  vector<uint64_t> bounds;
+  auto range3 = prime_range(11, 13);
+  copy(range3.begin(), range3.end(), back_inserter(bounds));
+  cout << "prime_range(11, 13) = { 11, 13 }";
+  check(bounds.size() == 2 && bounds[0] == 11 && bounds[1] == 13);
+
+  // empty ranges
+  auto range4 = prime_range(24, 28);
+  cout << "prime_range(24, 28) is empty";
+  check(range4.begin() == range4.end());
+
+  auto range5 = prime_range(100, 10);
+  cout << "prime_range(100, 10) is empty";
+  check(range5.begin() == range5.end());
+
+  // primes up to 2^64 terminate
+  uint64_t last = 0;
+  for (uint64_t prime : prime_range(18446744073709551533ull, ~0ull))
+    last = prime;
+  cout << "Largest prime < 2^64 = " << last;
+  check(last == 18446744073709551557ull);
+
+  cout << endl;
+  cout << "All tests passed successfully!" << endl;
+
+  return 0;
+}
@@ -0,0 +1,102 @@
+///
+/// @file   resize_sieve.cpp
+/// @brief  Test Erat::resizeSieve() which changes the segment
+///         size in the middle of a run, re-distributing
+///         EratBig's stored sieving primes into bucket lists
+///         matching the new sieve size.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve.hpp>
+#include <primesieve/Erat.hpp>
+#include <primesieve/PreSieve.hpp>
+#include <primesieve/SievingPrimes.hpp>
+#include <primesieve/pmath.hpp>
+#include <primesieve/types.hpp>
+
+#include <stdint.h>
+#include <cstdlib>
+#include <iostream>
+
+using namespace std;
+using namespace primesieve;
+
+void check(bool OK)
+{
+  cout << "   " << (OK ? "OK" : "ERROR") << "\n";
+  if (!OK)
+    exit(1);
+}
+
+/// Sieves [start, stop] and counts the primes while
+/// repeatedly stepping the sieve size up and back down
+/// between segments
+class ResizingErat : public Erat
+{
+public:
+  ResizingErat(uint64_t start,
+               uint64_t stop,
+               uint64_t sieveSize,
+               PreSieve& preSieve)
+  {
+    init(start, stop, sieveSize, preSieve);
+    initialSieveSize_ = getSieveSize();
+  }
+
+  uint64_t count(PreSieve& preSieve)
+  {
+    SievingPrimes sievingPrimes(this, preSieve);
+    uint64_t prime = sievingPrimes.next();
+    uint64_t count = 0;
+    uint64_t segments = 0;
+
+    while (hasNextSegment())
+    {
+      // grow and shrink mid-run, EratBig's bucket lists
+      // are re-distributed at every resize
+      segments++;
+      if (segments % 8 == 4 &&
+          sieveSize_ < (512u << 10))
+        resizeSieve(sieveSize_ * 2);
+      if (segments % 8 == 0 &&
+          sieveSize_ > initialSieveSize_)
+        resizeSieve(sieveSize_ / 2);
+
+      uint64_t sqrtHigh = isqrt(segmentHigh_);
+      for (; prime <= sqrtHigh; prime = sievingPrimes.next())
+        addSievingPrime(prime);
+
+      sieveSegment();
+      count += popcount((const uint64_t*) sieve_, ceilDiv(sieveSize_, 8));
+    }
+
+    return count;
+  }
+
+private:
+  uint64_t initialSieveSize_;
+};
+
+int main()
+{
+  // sqrt(stop) is far above EratMedium's limit for a
+  // 16 kilobyte sieve, most sieving primes are in EratBig
+  uint64_t start = (uint64_t) 9e9;
+  uint64_t stop = (uint64_t) 9e9 + 200000000;
+
+  PreSieve preSieve(start, stop);
+  ResizingErat erat(start, stop, 16, preSieve);
+  uint64_t count = erat.count(preSieve);
+
+  cout << "Prime count with mid-run sieve resizing";
+  check(count == count_primes(start, stop));
+
+  cout << endl;
+  cout << "All tests passed successfully!" << endl;
+
+  return 0;
+}
@@ -0,0 +1,80 @@
+///
+/// @file   running_count.cpp
+/// @brief  Test PrimeSieve::getRunningCount() which exposes
+///         the number of primes found so far during sieve().
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve/PrimeSieve.hpp>
+#include <primesieve/ParallelSieve.hpp>
+
+#include <stdint.h>
+#include <cstdlib>
+#include <iostream>
+
+using namespace std;
+using namespace primesieve;
+
+void check(bool OK)
+{
+  cout << "   " << (OK ? "OK" : "ERROR") << "\n";
+  if (!OK)
+    exit(1);
+}
+
+int main()
+{
+  // after sieve() the running count must equal pi(stop)
+  {
+    PrimeSieve ps;
+    ps.sieve(0, (uint64_t) 1e6, COUNT_PRIMES);
+    cout << "getRunningCount() = " << ps.getRunningCount();
+    check(ps.getRunningCount() == 78498);
+    check(ps.getRunningCount() == ps.getCount(0));
+  }
+
+  // the running count is maintained even
+  // without the COUNT_PRIMES flag
+  {
+    PrimeSieve ps;
+    ps.sieve(0, (uint64_t) 1e6, COUNT_TWINS);
+    cout << "getRunningCount() without COUNT_PRIMES = " << ps.getRunningCount();
+    check(ps.getRunningCount() == 78498);
+  }
+
+  // sub range, small primes <= 5 are included
+  {
+    PrimeSieve ps;
+    ps.sieve(3, 1000, COUNT_PRIMES);
+    cout << "getRunningCount() in [3, 1000] = " << ps.getRunningCount();
+    check(ps.getRunningCount() == ps.getCount(0));
+  }
+
+  // worker threads add into their parent's counter,
+  // the chunk overlap must not be counted twice
+  {
+    ParallelSieve ps;
+    ps.setNumThreads(4);
+    ps.sieve(0, (uint64_t) 1e8, COUNT_PRIMES);
+    cout << "ParallelSieve getRunningCount() = " << ps.getRunningCount();
+    check(ps.getRunningCount() == ps.getCount(0));
+  }
+
+  // reset between runs
+  {
+    PrimeSieve ps;
+    ps.sieve(0, (uint64_t) 1e6, COUNT_PRIMES);
+    ps.sieve(0, 1000, COUNT_PRIMES);
+    cout << "getRunningCount() after 2nd sieve() = " << ps.getRunningCount();
+    check(ps.getRunningCount() == 168);
+  }
+
+  cout << endl;
+  cout << "All tests passed successfully!" << endl;
+
+  return 0;
+}
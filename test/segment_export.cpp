@@ -0,0 +1,94 @@
+///
+/// @file   segment_export.cpp
+/// @brief  Test PrimeGenerator::forEachSegment() which hands
+///         out the raw sieve bitmap of each segment.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve/PrimeGenerator.hpp>
+
+#include <stdint.h>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+using namespace primesieve;
+
+void check(bool OK)
+{
+  cout << "   " << (OK ? "OK" : "ERROR") << "\n";
+  if (!OK)
+    exit(1);
+}
+
+const uint64_t bitValues[8] = { 7, 11, 13, 17, 19, 23, 29, 31 };
+
+/// Decode the primes of a raw segment bitmap
+void decode(const uint8_t* sieve,
+            size_t bytes,
+            uint64_t low,
+            vector<uint64_t>& primes)
+{
+  for (size_t i = 0; i < bytes; i++, low += 30)
+    for (int bit = 0; bit < 8; bit++)
+      if (sieve[i] & (1 << bit))
+        primes.push_back(low + bitValues[bit]);
+}
+
+int main()
+{
+  // the bitmap of [0, 10^6] must decode
+  // to all primes >= 7
+  vector<uint64_t> primes;
+  uint64_t segments = 0;
+
+  PrimeGenerator gen(0, 1000000);
+  gen.forEachSegment(
+    [&](const uint8_t* sieve, size_t bytes, uint64_t low)
+    {
+      segments++;
+      decode(sieve, bytes, low, primes);
+    });
+
+  cout << "segments sieved = " << segments;
+  check(segments >= 1);
+
+  // + 3 for the primes 2, 3, 5 which are not
+  // representable in the modulo 30 bitmap
+  cout << "primes in bitmap(0, 10^6) = " << primes.size();
+  check(primes.size() + 3 == 78498);
+
+  cout << "1st prime = " << primes.front();
+  check(primes.front() == 7);
+
+  cout << "last prime = " << primes.back();
+  check(primes.back() == 999983);
+
+  // bits outside [start, stop] must be zeroed
+  primes.clear();
+  PrimeGenerator gen2(100, 1000);
+  gen2.forEachSegment(
+    [&](const uint8_t* sieve, size_t bytes, uint64_t low)
+    {
+      decode(sieve, bytes, low, primes);
+    });
+
+  cout << "primes in bitmap(100, 1000) = " << primes.size();
+  check(primes.size() == 143);
+
+  cout << "1st prime = " << primes.front();
+  check(primes.front() == 101);
+
+  cout << "last prime = " << primes.back();
+  check(primes.back() == 997);
+
+  cout << endl;
+  cout << "All tests passed successfully!" << endl;
+
+  return 0;
+}
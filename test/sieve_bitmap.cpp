@@ -0,0 +1,174 @@
+///
+/// @file   sieve_bitmap.cpp
+/// @brief  Test the SieveBitmap on-disk sieve bitmap files.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve.hpp>
+#include <primesieve/SieveBitmap.hpp>
+#include <primesieve/primesieve_error.hpp>
+
+#include <stdint.h>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace primesieve;
+
+void check(bool OK)
+{
+  cout << "   " << (OK ? "OK" : "ERROR") << "\n";
+  if (!OK)
+    exit(1);
+}
+
+int main()
+{
+  string path = "primes.bitmap";
+
+  {
+    SieveBitmap::write(path, 0, 1000000);
+    SieveBitmap bitmap(path);
+
+    cout << "getStart() = " << bitmap.getStart();
+    check(bitmap.getStart() == 0);
+
+    cout << "getStop() = " << bitmap.getStop();
+    check(bitmap.getStop() == 1000000);
+
+    uint64_t count = bitmap.countPrimes(0, 1000000);
+    cout << "countPrimes(0, 10^6) = " << count;
+    check(count == 78498);
+
+    count = bitmap.countPrimes(100, 1000);
+    cout << "countPrimes(100, 1000) = " << count;
+    check(count == 143);
+
+    count = bitmap.countPrimes(17, 17);
+    cout << "countPrimes(17, 17) = " << count;
+    check(count == 1);
+
+    count = bitmap.countPrimes(100, 10);
+    cout << "countPrimes(100, 10) = " << count;
+    check(count == 0);
+
+    // compare against the sieve for many small ranges
+    uint64_t errors = 0;
+    for (uint64_t i = 0; i < 3000; i += 97)
+      if (bitmap.countPrimes(i, i + 530) != count_primes(i, i + 530))
+        errors++;
+    cout << "countPrimes() small ranges errors = " << errors;
+    check(errors == 0);
+
+    vector<uint64_t> primes;
+    bitmap.forEachPrime(0, 1000000,
+      [&](uint64_t prime) {
+        primes.push_back(prime);
+      });
+
+    cout << "forEachPrime() primes = " << primes.size();
+    check(primes.size() == 78498);
+
+    cout << "1st prime = " << primes.front();
+    check(primes.front() == 2);
+
+    cout << "Last prime = " << primes.back();
+    check(primes.back() == 999983);
+
+    vector<uint64_t> primes2;
+    generate_primes(1000, 2000, &primes2);
+    primes.clear();
+    bitmap.forEachPrime(1000, 2000,
+      [&](uint64_t prime) {
+        primes.push_back(prime);
+      });
+
+    cout << "forEachPrime(1000, 2000) matches generate_primes()";
+    check(primes == primes2);
+
+    uint64_t prime = bitmap.nthPrime(1, 0);
+    cout << "nthPrime(1, 0) = " << prime;
+    check(prime == 2);
+
+    prime = bitmap.nthPrime(78498, 0);
+    cout << "nthPrime(78498, 0) = " << prime;
+    check(prime == 999983);
+
+    // compare against nth_prime() for many (n, start)
+    errors = 0;
+    for (uint64_t n = 1; n < 10000; n += 97)
+      for (uint64_t start : { 0ull, 5ull, 1000ull, 500000ull })
+        if (bitmap.nthPrime(n, start) != nth_prime((int64_t) n, start))
+          errors++;
+    cout << "nthPrime() errors = " << errors;
+    check(errors == 0);
+
+    bool hasThrown = false;
+    try {
+      bitmap.countPrimes(0, 1000001);
+    } catch (const primesieve_error&) {
+      hasThrown = true;
+    }
+    cout << "countPrimes() outside the file's range throws";
+    check(hasThrown);
+
+    hasThrown = false;
+    try {
+      bitmap.nthPrime(78499, 0);
+    } catch (const primesieve_error&) {
+      hasThrown = true;
+    }
+    cout << "nthPrime() past the file's last prime throws";
+    check(hasThrown);
+  }
+
+  {
+    // a high band, start & stop not multiples of 30
+    uint64_t start = (uint64_t) 1e12 + 7;
+    uint64_t stop = start + 100000;
+    SieveBitmap::write(path, start, stop);
+    SieveBitmap bitmap(path);
+
+    uint64_t count = bitmap.countPrimes(start, stop);
+    cout << "countPrimes(10^12+7, 10^12+100007) = " << count;
+    check(count == count_primes(start, stop));
+
+    vector<uint64_t> primes;
+    vector<uint64_t> primes2;
+    generate_primes(start, stop, &primes2);
+    bitmap.forEachPrime(start, stop,
+      [&](uint64_t prime) {
+        primes.push_back(prime);
+      });
+
+    cout << "forEachPrime() matches generate_primes()";
+    check(primes == primes2);
+
+    uint64_t prime = bitmap.nthPrime(100, start);
+    cout << "nthPrime(100, 10^12+7) = " << prime;
+    check(prime == nth_prime(100, start));
+  }
+
+  bool hasThrown = false;
+  try {
+    SieveBitmap bitmap("does-not-exist.bitmap");
+  } catch (const primesieve_error&) {
+    hasThrown = true;
+  }
+  cout << "Missing bitmap file throws";
+  check(hasThrown);
+
+  remove(path.c_str());
+
+  cout << endl;
+  cout << "All tests passed successfully!" << endl;
+
+  return 0;
+}
@@ -0,0 +1,76 @@
+///
+/// @file   sieving_primes_cache.cpp
+/// @brief  Test SievingPrimesCache::preGenerate(), the shared
+///         in-memory sieving primes bitmap that ParallelSieve
+///         generates using multiple threads.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve.hpp>
+#include <primesieve/SievingPrimesCache.hpp>
+
+#include <stdint.h>
+#include <cstdlib>
+#include <iostream>
+
+using namespace std;
+using namespace primesieve;
+
+void check(bool OK)
+{
+  cout << "   " << (OK ? "OK" : "ERROR") << "\n";
+  if (!OK)
+    exit(1);
+}
+
+int main()
+{
+  // preGenerate(1e8) rounds the limit
+  // up to whole sieve bytes
+  uint64_t limit = ((uint64_t) 1e8 / 30 + 1) * 30 + 6;
+
+  // reference counts, sieved before the shared bitmap
+  // exists. stop3 is chosen so that sqrt(stop3) is just
+  // below the bitmap limit, its sieve uses the very
+  // last bitmap byte.
+  uint64_t stop3 = limit * limit;
+  uint64_t count1 = count_primes((uint64_t) 1e15, (uint64_t) 1e15 + 10000000);
+  uint64_t count2 = count_primes((uint64_t) 4e16, (uint64_t) 4e16 + 10000000);
+  uint64_t count3 = count_primes(stop3 - 2000000, stop3);
+
+  SievingPrimesCache::getInstance().preGenerate((uint64_t) 1e8, 2);
+
+  cout << "preGenerate(1e8) covers " << limit;
+  check(SievingPrimesCache::getInstance().coveringBits(limit) != nullptr);
+  cout << "preGenerate(1e8) covers " << limit << " + 1";
+  check(SievingPrimesCache::getInstance().coveringBits(limit + 1) == nullptr);
+
+  // the sieving primes are now copied from the bitmap,
+  // the counts must not change
+  cout << "count_primes(1e15, 1e15+1e7) using the bitmap";
+  check(count_primes((uint64_t) 1e15, (uint64_t) 1e15 + 10000000) == count1);
+
+  // sqrt(stop3) is just below the bitmap limit, the last
+  // bitmap byte must contain all primes <= limit
+  cout << "count_primes(" << stop3 - 2000000 << ", " << stop3 << ")";
+  check(count_primes(stop3 - 2000000, stop3) == count3);
+
+  // sqrt(4e16) = 2e8 exceeds the bitmap limit, the
+  // segments above the limit are sieved instead of copied
+  cout << "count_primes(4e16, 4e16+1e7) partially cached";
+  check(count_primes((uint64_t) 4e16, (uint64_t) 4e16 + 10000000) == count2);
+
+  // growing the bitmap keeps the counts correct
+  SievingPrimesCache::getInstance().preGenerate((uint64_t) 2e8, 2);
+  cout << "count_primes(4e16, 4e16+1e7) after growing to 2e8";
+  check(count_primes((uint64_t) 4e16, (uint64_t) 4e16 + 10000000) == count2);
+
+  cout << endl;
+  cout << "All tests passed successfully!" << endl;
+
+  return 0;
+}
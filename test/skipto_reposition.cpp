@@ -0,0 +1,109 @@
+///
+/// @file   skipto_reposition.cpp
+/// @brief  Test iterator::skipto(), repeated calls inside the
+///         same sieved window reposition instead of re-sieving.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve.hpp>
+
+#include <stdint.h>
+#include <iostream>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+void check(bool OK)
+{
+  cout << "   " << (OK ? "OK" : "ERROR") << "\n";
+  if (!OK)
+    exit(1);
+}
+
+int main()
+{
+  // reference primes covering the test band
+  vector<uint64_t> primes;
+  primesieve::generate_primes(1000000, 1100000, &primes);
+
+  std::mt19937_64 rng(42);
+  std::uniform_int_distribution<uint64_t> dist(1000100, 1099000);
+
+  // many skipto() calls within the same magnitude band,
+  // alternating between next_prime() and prev_prime()
+  {
+    primesieve::iterator it;
+    bool OK = true;
+
+    for (int i = 0; OK && i < 10000; i++)
+    {
+      uint64_t n = dist(rng);
+      it.skipto(n);
+
+      if (i % 2 == 0)
+      {
+        uint64_t prime = it.next_prime();
+        auto p = upper_bound(primes.begin(), primes.end(), n);
+        OK = (prime == *p);
+        // keep iterating, the position must be consistent
+        OK &= (it.next_prime() == *(p + 1));
+        OK &= (it.prev_prime() == *p);
+      }
+      else
+      {
+        uint64_t prime = it.prev_prime();
+        auto p = lower_bound(primes.begin(), primes.end(), n);
+        OK = (prime == *(p - 1));
+        OK &= (it.prev_prime() == *(p - 2));
+        OK &= (it.next_prime() == *(p - 1));
+      }
+    }
+
+    cout << "10000 skipto() calls inside one band";
+    check(OK);
+  }
+
+  // skipto() far away and back again
+  {
+    primesieve::iterator it(1050000);
+    bool OK = (it.next_prime() > 1050000);
+
+    it.skipto(0);
+    OK &= (it.next_prime() == 2);
+    it.skipto(1050000);
+    auto p = upper_bound(primes.begin(), primes.end(), 1050000ull);
+    OK &= (it.next_prime() == *p);
+
+    cout << "skipto() far away and back";
+    check(OK);
+  }
+
+  // skipto() to the window boundaries
+  {
+    primesieve::iterator it;
+    it.skipto(primes.front());
+    bool OK = true;
+
+    uint64_t last = primes.back();
+    it.skipto(last - 1);
+    OK &= (it.next_prime() == last);
+    it.skipto(last);
+    OK &= (it.prev_prime() < last);
+    it.skipto(primes.front());
+    OK &= (it.prev_prime() < primes.front());
+
+    cout << "skipto() at window boundaries";
+    check(OK);
+  }
+
+  cout << endl;
+  cout << "All tests passed successfully!" << endl;
+
+  return 0;
+}
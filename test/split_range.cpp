@@ -0,0 +1,87 @@
+///
+/// @file   split_range.cpp
+/// @brief  Test primesieve::split_range() which exposes
+///         ParallelSieve's chunking to external schedulers.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve.hpp>
+
+#include <stdint.h>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+using namespace primesieve;
+
+void check(bool OK)
+{
+  cout << "   " << (OK ? "OK" : "ERROR") << "\n";
+  if (!OK)
+    exit(1);
+}
+
+int main()
+{
+  uint64_t start = 0;
+  uint64_t stop = (uint64_t) 1e9;
+  auto ranges = split_range(start, stop, 8);
+
+  cout << "split_range(0, 1e9, 8) returns multiple subranges";
+  check(ranges.size() > 1);
+
+  // the subranges tile [start, stop]
+  cout << "The first subrange starts at start";
+  check(ranges.front().start == start);
+  cout << "The last subrange ends at stop";
+  check(ranges.back().stop == stop);
+
+  bool contiguous = true;
+  for (size_t i = 1; i < ranges.size(); i++)
+    contiguous &= (ranges[i].start == ranges[i - 1].stop + 1);
+  cout << "The subranges are contiguous";
+  check(contiguous);
+
+  // the inner boundaries are aligned to modulo (30 + 2)
+  // so that no prime k-tuplet spans two subranges
+  bool aligned = true;
+  for (size_t i = 0; i + 1 < ranges.size(); i++)
+    aligned &= (ranges[i].stop % 30 == 2);
+  cout << "The subrange boundaries are (30 + 2) aligned";
+  check(aligned);
+
+  // summing per-subrange counts gives the exact totals
+  uint64_t primes = 0;
+  uint64_t twins = 0;
+
+  for (auto& range : ranges)
+  {
+    primes += count_primes(range.start, range.stop);
+    twins += count_twins(range.start, range.stop);
+  }
+
+  cout << "Sum of subrange prime counts";
+  check(primes == count_primes(start, stop));
+  cout << "Sum of subrange twin counts";
+  check(twins == count_twins(start, stop));
+
+  // a small interval is returned as a single subrange
+  ranges = split_range(100, 200, 4);
+  cout << "split_range(100, 200, 4) returns [100, 200]";
+  check(ranges.size() == 1 &&
+        ranges[0].start == 100 &&
+        ranges[0].stop == 200);
+
+  cout << "split_range(200, 100, 4) returns no subranges";
+  check(split_range(200, 100, 4).empty());
+
+  cout << endl;
+  cout << "All tests passed successfully!" << endl;
+
+  return 0;
+}
@@ -0,0 +1,110 @@
+///
+/// @file   store_primes_parallel.cpp
+/// @brief  Test multi-threaded prime number generation.
+///
+/// Copyright (C) 2018 Kim Walisch, <kim.walisch@gmail.com>
+///
+/// This file is distributed under the BSD License. See the COPYING
+/// file in the top level directory.
+///
+
+#include <primesieve.hpp>
+
+#include <stdint.h>
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+
+using namespace std;
+using namespace primesieve;
+
+void check(bool OK)
+{
+  cout << "   " << (OK ? "OK" : "ERROR") << "\n";
+  if (!OK)
+    exit(1);
+}
+
+int main()
+{
+  vector<uint64_t> primes;
+  vector<uint64_t> primes2;
+
+  // range large enough to use multiple threads
+  uint64_t start = 0;
+  uint64_t stop = (uint64_t) 5e7;
+  store_primes(start, stop, primes);
+  store_primes_parallel(start, stop, primes2);
+
+  cout << "store_primes_parallel(" << start << ", " << stop << ") size = " << primes2.size();
+  check(primes.size() == primes2.size());
+
+  cout << "store_primes_parallel(" << start << ", " << stop << ") primes";
+  check(primes == primes2);
+
+  primes.clear();
+  primes2.clear();
+
+  // small range, falls back to store_primes()
+  start = 100;
+  stop = 200;
+  store_primes(start, stop, primes);
+  store_primes_parallel(start, stop, primes2);
+
+  cout << "store_primes_parallel(" << start << ", " << stop << ") primes";
+  check(primes == primes2);
+
+  // appending to a non-empty vector
+  store_primes_parallel(0, (uint64_t) 3e7, primes2);
+
+  primes.clear();
+  store_primes(100, 200, primes);
+  store_primes(0, (uint64_t) 3e7, primes);
+
+  cout << "store_primes_parallel() append primes";
+  check(primes == primes2);
+
+  // start > stop
+  primes2.clear();
+  store_primes_parallel(200, 100, primes2);
+
+  cout << "store_primes_parallel(200, 100) size = " << primes2.size();
+  check(primes2.empty());
+
+  // n large enough to use multiple threads
+  uint64_t n = 3000000;
+  primes.clear();
+  primes2.clear();
+  store_n_primes(n, 0, primes);
+  store_n_primes_parallel(n, 0, primes2);
+
+  cout << "store_n_primes_parallel(" << n << ", 0) size = " << primes2.size();
+  check(primes2.size() == n);
+
+  cout << "store_n_primes_parallel(" << n << ", 0) primes";
+  check(primes == primes2);
+
+  // non-zero start
+  start = (uint64_t) 1e9;
+  primes.clear();
+  primes2.clear();
+  store_n_primes(n, start, primes);
+  store_n_primes_parallel(n, start, primes2);
+
+  cout << "store_n_primes_parallel(" << n << ", " << start << ") primes";
+  check(primes == primes2);
+
+  // small n, falls back to store_n_primes()
+  primes.clear();
+  primes2.clear();
+  store_n_primes(100, 0, primes);
+  store_n_primes_parallel(100, 0, primes2);
+
+  cout << "store_n_primes_parallel(100, 0) primes";
+  check(primes == primes2);
+
+  cout << endl;
+  cout << "All tests passed successfully!" << endl;
+
+  return 0;
+}